@@ -4,8 +4,14 @@ set(include_files_h5geo_private
   ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5deviation.h
   ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5easyhull.h
   ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5interpolation.h
+  ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5ioqueue.h
   ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5sort.h
   ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5polyfit.h
+  ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5profiler.h
+  ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5surveyinfo.h
+  ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5trajectory.h
+  ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5units.h
+  ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5transpose.h
   ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5enum.h
   ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5enum_operators.h
   ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5coreimpl.h
@@ -36,6 +42,10 @@ if(H5GEO_USE_GDAL)
   list(APPEND include_files_h5geo_private ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5core_sr_settings.h)
 endif()
 
+if(H5GEO_USE_MPI)
+  list(APPEND include_files_h5geo_private ${CMAKE_SOURCE_DIR}/include/h5geo/private/h5core_mpi.h)
+endif()
+
 set(include_files_h5geo_public
   ${CMAKE_SOURCE_DIR}/include/h5geo/h5core.h
   ${CMAKE_SOURCE_DIR}/include/h5geo/h5base.h
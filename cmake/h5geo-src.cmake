@@ -1,7 +1,13 @@
 set(src_files_h5geo
   ${CMAKE_SOURCE_DIR}/src/h5geo/h5core.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geo/h5core_segy.cpp
+  ${CMAKE_SOURCE_DIR}/src/h5geo/h5deviation.cpp
+  ${CMAKE_SOURCE_DIR}/src/h5geo/h5ioqueue.cpp
+  ${CMAKE_SOURCE_DIR}/src/h5geo/h5profiler.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geo/h5sort.cpp
+  ${CMAKE_SOURCE_DIR}/src/h5geo/h5surveyinfo.cpp
+  ${CMAKE_SOURCE_DIR}/src/h5geo/h5trajectory.cpp
+  ${CMAKE_SOURCE_DIR}/src/h5geo/h5units.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geo/h5baseimpl.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geo/h5basecontainerimpl.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geo/h5baseobjectimpl.cpp
@@ -27,3 +33,7 @@ set(src_files_h5geo
 if(H5GEO_USE_GDAL)
   list(APPEND src_files_h5geo ${CMAKE_SOURCE_DIR}/src/h5geo/h5core_sr_settings.cpp)
 endif()
+
+if(H5GEO_USE_MPI)
+  list(APPEND src_files_h5geo ${CMAKE_SOURCE_DIR}/src/h5geo/h5core_mpi.cpp)
+endif()
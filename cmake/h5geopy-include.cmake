@@ -10,6 +10,8 @@ set(include_files_h5geopy
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5geofunctions_py.h
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5horizon_py.h
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5interpolation_py.h
+  ${CMAKE_SOURCE_DIR}/include/h5geopy/h5ioqueue_py.h
+  ${CMAKE_SOURCE_DIR}/include/h5geopy/h5profiler_py.h
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5logcurve_py.h
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5map_py.h
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5mapcontainer_py.h
@@ -22,6 +24,7 @@ set(include_files_h5geopy
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5volcontainer_py.h
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5core_segy_py.h
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5sort_py.h
+  ${CMAKE_SOURCE_DIR}/include/h5geopy/h5surveyinfo_py.h
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5well_py.h
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5wellcontainer_py.h
   ${CMAKE_SOURCE_DIR}/include/h5geopy/h5welltops_py.h
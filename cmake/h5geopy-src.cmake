@@ -10,6 +10,8 @@ set(src_files_h5geopy
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5geofunctions_py.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5horizon_py.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5interpolation_py.cpp
+  ${CMAKE_SOURCE_DIR}/src/h5geopy/h5ioqueue_py.cpp
+  ${CMAKE_SOURCE_DIR}/src/h5geopy/h5profiler_py.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5logcurve_py.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5map_py.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5mapcontainer_py.cpp
@@ -22,6 +24,7 @@ set(src_files_h5geopy
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5volcontainer_py.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5core_segy_py.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5sort_py.cpp
+  ${CMAKE_SOURCE_DIR}/src/h5geopy/h5surveyinfo_py.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5well_py.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5wellcontainer_py.cpp
   ${CMAKE_SOURCE_DIR}/src/h5geopy/h5welltops_py.cpp
@@ -9,6 +9,10 @@
 #include "private/h5core_sr_settings.h"
 #endif
 
+#ifdef H5GEO_USE_MPI
+#include <mpi.h>
+#endif
+
 #include "h5geo_export.h"
 #include "private/h5enum.h"
 #include "private/h5point.h"
@@ -89,6 +93,8 @@ struct H5HorizonParam : public H5BaseObjectParam{
   size_t nPoints; ///< number of points (columns within HDF5 DataSet)
   std::map<std::string, size_t> components; ///< component name and corresponding HDF5 row number
   hsize_t pointsChunkSize = 10; ///< see HDF5 chunking
+  bool floatData = false; ///< store points as 32-bit float (they are still read/written as double)
+  unsigned compression_level = 0; ///< shuffle + deflate level (0 - no compression)
 };
 
 /// \struct H5MapParam
@@ -105,8 +111,10 @@ struct H5MapParam : public H5BaseObjectParam{
   size_t nX; ///< number of columns in column-major Eigen matrix
   size_t nY; ///< number of rows in column-major Eigen matrix
   h5geo::Domain domain; ///< time or depth (TWT, TVD etc)
-  hsize_t xChunkSize = 10; ///< see HDF5 chunking
-  hsize_t yChunkSize = 10; ///< see HDF5 chunking
+  hsize_t xChunkSize = 256; ///< see HDF5 chunking (square tiles suit windowed access)
+  hsize_t yChunkSize = 256; ///< see HDF5 chunking (square tiles suit windowed access)
+  bool floatData = false; ///< store data as 32-bit float (it is still read/written as double)
+  unsigned compression_level = 0; ///< shuffle + deflate level (0 - no compression)
 };
 
 /// \struct H5VolParam
@@ -148,6 +156,7 @@ struct H5WellParam : public H5BaseObjectParam{
 /// DevCurve parameters are needed when creating any DevCurve geo-object.
 struct H5DevCurveParam : public H5BaseObjectParam{
   hsize_t chunkSize = 10; ///< see HDF5 chunking
+  size_t nSamp = 0; ///< if not `0` then fixed-size unchunked curve is created (compact if small, contiguous otherwise): it is cheaper to store and read but can't be resized
 };
 
 /// \struct H5LogCurveParam
@@ -156,6 +165,7 @@ struct H5DevCurveParam : public H5BaseObjectParam{
 /// LogCurve parameters are needed when creating any LogCurve geo-object.
 struct H5LogCurveParam : public H5BaseObjectParam{
   hsize_t chunkSize = 10; ///< see HDF5 chunking
+  size_t nSamp = 0; ///< if not `0` then fixed-size unchunked curve is created (compact if small, contiguous otherwise): it is cheaper to store and read but can't be resized
 };
 
 /// \struct H5SeisParam
@@ -175,6 +185,61 @@ struct H5SeisParam : public H5BaseObjectParam{
   std::vector<std::string> segyFiles; ///< used to map SEGY files (use in pair with `mapSEGY`)
 };
 
+/// \struct H5ChunkCacheParam
+/// \brief HDF5 raw data chunk cache (see `H5Pset_chunk_cache`)
+///
+/// Chunks bigger than the cache are read/decompressed on every access.
+struct H5ChunkCacheParam{
+  size_t nBytes = 0; ///< cache size (0 - pick automatically from dataset's chunk size)
+  size_t nSlots = 0; ///< number of hash table slots, prime is preferred (0 - pick automatically)
+  double w0 = 0.75; ///< preemption policy: `1` - evict fully read/written chunks first
+};
+
+/// \struct H5FileAccessParam
+/// \brief HDF5 file access (performance) settings used to open containers
+///
+/// Zero (or negative) values keep HDF5 defaults.
+/// See h5geo::getDefaultFileAccessParam() to get settings for container type.
+struct H5FileAccessParam{
+  H5ChunkCacheParam chunkCache; ///< file-level chunk cache used by each opened dataset
+  size_t mdcInitSize = 0; ///< initial metadata cache size
+  size_t mdcMaxSize = 0; ///< maximal metadata cache size
+  size_t pageBufferSize = 0; ///< page buffer size (works only for files with paged file space strategy)
+  hsize_t alignThreshold = 1; ///< objects bigger than threshold are aligned (see `H5Pset_alignment`)
+  hsize_t alignment = 1; ///< alignment in bytes (see `H5Pset_alignment`)
+  int libverLow = -1; ///< lower bound of `H5F_libver_t` (see `H5Pset_libver_bounds`)
+  int libverHigh = -1; ///< upper bound of `H5F_libver_t` (see `H5Pset_libver_bounds`)
+#ifdef H5GEO_USE_MPI
+  /// open file with MPI-IO driver (parallel HDF5) shared by the communicator's ranks.
+  /// Page buffer is not supported in this mode
+  MPI_Comm mpiComm = MPI_COMM_NULL;
+  MPI_Info mpiInfo = MPI_INFO_NULL; ///< hints passed to MPI-IO
+#endif
+};
+
+/// \struct H5FileCreateParam
+/// \brief HDF5 file creation settings (file space management)
+///
+/// Paged aggregation packs metadata and small raw data of thousands
+/// of objects (wells, curves) into a few pages, so that opening a container
+/// and reading an object touches few file regions. Page buffer
+/// (H5FileAccessParam::pageBufferSize) works only for such files.
+/// See h5geo::getDefaultFileCreateParam() to get settings for container type.
+struct H5FileCreateParam{
+  bool pagedAggregation = false; ///< use `H5F_FSPACE_STRATEGY_PAGE` file space strategy
+  hsize_t pageSize = 64*1024; ///< file space page size (see `H5Pset_file_space_page_size`)
+  bool persistFreeSpace = false; ///< keep free-space info in the file so that freed space is reused after reopening
+  hsize_t freeSpaceThreshold = 1; ///< free-space sections smaller than this are not tracked
+};
+
+/// \struct H5CatalogEntry
+/// \brief Geo-object record of the container's catalog (see h5geo::readCatalog())
+struct H5CatalogEntry{
+  std::string path; ///< full path to the object's group
+  h5geo::ObjectType objType; ///< object type
+  std::string uwi; ///< Unique Well Identifier (wells only)
+};
+
 /// \class H5Base
 /// \brief Base class for all geo-containers and geo-objects
 ///
@@ -83,6 +83,26 @@ public:
 	/// \brief Get HDF5 file
   virtual h5gt::File getH5File() const = 0;
 
+  /// \brief Begin batch session: geo-objects within the container's file
+  /// don't flush after every write until H5BaseContainer::endBatch() is called
+  ///
+  /// Use it for bulk loading of many objects (wells, logs, horizons etc).
+  /// Sessions may be nested. See also H5BatchSession and h5geo::beginBatch()
+  virtual bool beginBatch() = 0;
+  /// \brief End batch session and flush the file once
+  virtual bool endBatch() = 0;
+  /// \brief Check if batch session is active for the container's file
+  virtual bool isBatchActive() const = 0;
+
+  /// \brief Unlink geo-object (with geo-objects within it) and remove it from the catalog
+  ///
+  /// HDF5 doesn't shrink the file: use `h5repack` to reclaim the space
+  virtual bool removeObject(const std::string& name) = 0;
+  /// \brief Rebuild the catalog of geo-objects (see h5geo::hasCatalog())
+  ///
+  /// Needed only if the container was modified by other tools
+  virtual bool rebuildCatalog() = 0;
+
 	/// \brief Find all geo-objects of specified type within current container and return them as vector of Groups
   virtual std::vector<h5gt::Group> getObjGroupList(const h5geo::ObjectType& objType, bool recursive) = 0;
 	/// \brief Find all geo-objects of specified type within current container and return them as vector of names
@@ -105,4 +125,32 @@ public:
 
 using H5BaseCnt_ptr = std::unique_ptr<H5BaseContainer, h5geo::ObjectDeleter>;
 
+/// \class H5BatchSession
+/// \brief RAII batch session (see H5BaseContainer::beginBatch())
+///
+/// The file is flushed once when the session is committed or destroyed.
+class H5BatchSession
+{
+public:
+  explicit H5BatchSession(H5BaseContainer* cnt) : cnt(cnt){
+    active = cnt && cnt->beginBatch();
+  }
+  ~H5BatchSession(){ commit(); }
+
+  H5BatchSession(const H5BatchSession&) = delete;
+  H5BatchSession& operator=(const H5BatchSession&) = delete;
+
+  /// \brief End session before going out of scope
+  bool commit(){
+    if (!active)
+      return false;
+    active = false;
+    return cnt->endBatch();
+  }
+
+private:
+  H5BaseContainer* cnt;
+  bool active = false;
+};
+
 #endif // H5BASECONTAINER_H
@@ -73,15 +73,23 @@ public:
   /// \brief Create GDAL coordinate transformtation object
   ///
   /// Transformation is prepared to transform data from geo-object's CRS 
-  /// to h5geo::sr::SpatialReference
+  /// to the CRS of getSRContext()
   virtual OGRCoordinateTransformation* createCoordinateTransformationToReadData(
       const std::string& unitsTo) = 0;
   /// \brief Create GDAL coordinate transformtation object
   ///
-  /// Transformation is prepared to transform data from h5geo::sr::SpatialReference
+  /// Transformation is prepared to transform data from the CRS of getSRContext()
   /// to geo-object's CRS 
   virtual OGRCoordinateTransformation* createCoordinateTransformationToWriteData(
       const std::string& unitsFrom) = 0;
+
+  /// \brief Set spatial reference context used to read/write data
+  ///
+  /// Each object may have its own context thus different threads may work
+  /// with different CRS/units. `nullptr` resets to h5geo::sr::getDefaultContext()
+  virtual void setSRContext(const std::shared_ptr<h5geo::SRContext>& ctx) = 0;
+  /// \brief Get spatial reference context (never `nullptr`)
+  virtual std::shared_ptr<h5geo::SRContext> getSRContext() const = 0;
 #endif
 
   /// \brief Set spatial reference for current geo-object using `authName:code` form
@@ -118,6 +126,19 @@ public:
   /// \brief Get HDF5 Group
   virtual h5gt::Group getObjG() const = 0;
 
+  /// \brief Set raw data chunk cache used to open geo-object's datasets
+  /// (overrides file-level cache, see H5FileAccessParam)
+  ///
+  /// Zero `nBytes` picks cache size from the dataset's chunks
+  /// (see h5geo::getAutoChunkCacheParam()), zero `nSlots` picks
+  /// number of slots for the cache size (see h5geo::getAutoChunkCacheSlots())
+  /// \param datasetName dataset within geo-object (empty - all datasets)
+  virtual void setChunkCache(
+      const H5ChunkCacheParam& p,
+      const std::string& datasetName = "") = 0;
+  /// \brief Remove chunk cache overrides (file-level cache is used)
+  virtual void resetChunkCache() = 0;
+
   /// \brief Get geo-object's name without path
   virtual std::string getName() const = 0;
   /// \brief Get geo-object's name with full path to that object
@@ -11,7 +11,10 @@
 #include "private/h5interpolation.h"
 #include "private/h5polyfit.h"
 #include "private/h5sort.h"
+#include "private/h5surveyinfo.h"
+#include "private/h5transpose.h"
 
+#include <functional>
 #include <map>
 #include <type_traits>
 #include <string>
@@ -34,6 +37,12 @@
 #include <h5gt/H5Attribute.hpp>
 
 class H5Seis;
+class H5Map;
+class H5Horizon;
+struct H5ChunkCacheParam;
+struct H5FileAccessParam;
+struct H5FileCreateParam;
+struct H5CatalogEntry;
 
 #if CHAR_BIT != 8
 #error "unsupported char size"
@@ -56,6 +65,9 @@ static const union {
 namespace h5geo
 {
 
+class Trajectory;
+struct TimeDepthCurve;
+
 /// \brief Resize and overwrite DataSet or create it if not exists
 template<typename Object, typename T,
          typename std::enable_if<
@@ -505,6 +517,21 @@ Eigen::VectorX<T> getDataFromIndexedDataset(
     h5gt::DataSet& dataset,
     const std::string& attrName);
 
+/// \brief Write `data` multiplied by `coef` to hyperslab without modifying `data`
+///
+/// `data` must be contiguous and ordered the same way as the hyperslab
+/// (i.e. Eigen column-major matrix with `count.back()` rows). \n
+/// Scaled data is copied to a buffer of at most `bufferSize` elements
+/// and the hyperslab is written by parts (if `coef` is 1 `data` is written as is).
+template<typename T>
+bool writeScaledHyperslab(
+    h5gt::DataSet& dataset,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    const T* data,
+    double coef,
+    size_t bufferSize = 1048576);
+
 // UTIL
 
 H5GEO_EXPORT std::optional<h5gt::File> openFile(
@@ -516,6 +543,171 @@ H5GEO_EXPORT std::optional<h5gt::DataSet> openDataSet(
     const std::string& fileName,
     const std::string& dsetName);
 
+/// \brief Begin batch session for the file: geo-objects stop
+/// flushing the file after every write until h5geo::endBatch() is called.
+/// The metadata cache is enlarged for the session. \n
+/// Sessions may be nested: only the outermost h5geo::endBatch() flushes. \n
+/// Session is dropped if the file is closed before h5geo::endBatch()
+/// (reopened file isn't treated as being in session).
+/// \return false if file is invalid
+H5GEO_EXPORT bool beginBatch(const h5gt::File& file);
+
+/// \brief End batch session (see h5geo::beginBatch()):
+/// restore metadata cache and flush the file once
+/// \return false if no session was started or flush failed
+H5GEO_EXPORT bool endBatch(const h5gt::File& file);
+
+/// \brief Check if batch session is active for the file
+/// (see h5geo::beginBatch())
+H5GEO_EXPORT bool isBatchActive(const h5gt::File& file);
+
+/// \brief Flush the file unless batch session is active for it
+/// (see h5geo::beginBatch())
+H5GEO_EXPORT void flushUnlessBatch(const h5gt::File& file);
+
+/// \brief Tune file access property list for bulk ingestion:
+/// metadata of closed objects is evicted from cache (`H5Pset_evict_on_close`)
+/// so that memory doesn't grow while thousands of objects are written,
+/// and metadata cache is enlarged. Use it to open the file that is going
+/// to be filled within batch session (see h5geo::beginBatch()). \n
+/// HDF5 refuses to open the same file with different evict-on-close settings.
+/// \param fapl file access property list id
+H5GEO_EXPORT bool setBatchFileAccessProps(hid_t fapl);
+
+/// \brief Open HDF5 file with access (performance) settings. \n
+/// If the file can't be opened with page buffer (file was created
+/// without paged aggregation) it is reopened without page buffer.
+/// \param openFlags h5gt::File open flags
+/// \throw h5gt::Exception same as h5gt::File constructor
+H5GEO_EXPORT h5gt::File openH5File(
+    const std::string& fileName,
+    unsigned openFlags,
+    const H5FileAccessParam& p);
+
+/// \brief Open HDF5 file with creation (file space) and access settings.
+/// Creation settings are used only if the file is created.
+/// \param openFlags h5gt::File open flags
+/// \throw h5gt::Exception same as h5gt::File constructor
+H5GEO_EXPORT h5gt::File openH5File(
+    const std::string& fileName,
+    unsigned openFlags,
+    const H5FileCreateParam& cp,
+    const H5FileAccessParam& ap);
+
+/// \brief Create (truncate if exists) HDF5 file with creation
+/// (file space) and access settings
+H5GEO_EXPORT std::optional<h5gt::File> createFile(
+    const std::string& fileName,
+    const H5FileCreateParam& cp,
+    const H5FileAccessParam& ap);
+
+/// \brief Open existing HDF5 file for read/write with access settings
+H5GEO_EXPORT std::optional<h5gt::File> openFile(
+    const std::string& fileName,
+    const H5FileAccessParam& p);
+
+/// \brief Fill file access property list (chunk cache, metadata cache,
+/// page buffer, alignment and library version bounds)
+/// \param fapl file access property list id
+H5GEO_EXPORT bool setFileAccessProps(
+    hid_t fapl, const H5FileAccessParam& p);
+
+/// \brief File access settings suited for the container type:
+/// seismic and volume containers get chunk cache big enough
+/// for trace chunks and bricks, well containers get bigger metadata cache
+/// as they hold thousands of small objects
+H5GEO_EXPORT H5FileAccessParam getDefaultFileAccessParam(
+    h5geo::ContainerType cntType);
+
+/// \brief Fill file creation property list (file space strategy and page size)
+/// \param fcpl file creation property list id
+H5GEO_EXPORT bool setFileCreateProps(
+    hid_t fcpl, const H5FileCreateParam& p);
+
+/// \brief Set layout for fixed-size (not resizable) dataset:
+/// compact (raw data is kept in the object header) if it is
+/// not bigger than 32 KB and contiguous otherwise
+/// \param dcpl dataset creation property list id
+/// \param nBytes dataset size in bytes
+H5GEO_EXPORT bool setFixedSizeLayout(hid_t dcpl, size_t nBytes);
+
+/// \brief File creation settings suited for the container type:
+/// well containers get paged aggregation as they hold thousands
+/// of small objects, other containers keep HDF5 defaults
+H5GEO_EXPORT H5FileCreateParam getDefaultFileCreateParam(
+    h5geo::ContainerType cntType);
+
+/// \brief Calculate chunk cache for the dataset: it should hold
+/// all chunks intersected by the plane orthogonal to the slowest axis
+/// (i.e. trace chunk or a layer of volume bricks), but not less than one chunk
+/// \param maxBytes upper limit of cache size (unless single chunk is bigger)
+/// \return zero-sized cache if dataset is not chunked
+H5GEO_EXPORT H5ChunkCacheParam getAutoChunkCacheParam(
+    h5gt::DataSet& dset,
+    size_t maxBytes = 256*1024*1024);
+
+/// \brief Calculate number of hash table slots for the chunk cache
+/// of the given size: it keeps user defined cache size
+/// \return zero if dataset is not chunked
+H5GEO_EXPORT size_t getAutoChunkCacheSlots(
+    h5gt::DataSet& dset,
+    size_t nBytes);
+
+// CATALOG
+
+/// \brief Check if the file has catalog of geo-objects
+///
+/// Catalog is kept at the file root and maps full path of each
+/// geo-object to its type (and UWI for wells). It is maintained
+/// when objects are created or removed by h5geo, thus listing
+/// geo-objects of the container takes a single read.
+H5GEO_EXPORT bool hasCatalog(const h5gt::File& file);
+
+/// \brief Find all geo-objects within the file and (re)write the catalog
+///
+/// Use it if the file was modified by other tools
+/// \return false if the file is read-only or writing failed
+H5GEO_EXPORT bool rebuildCatalog(h5gt::File file);
+
+/// \brief Read the catalog of geo-objects (see h5geo::hasCatalog())
+///
+/// The file is never modified: if there is no catalog (the file was
+/// created by older version) use h5geo::rebuildCatalog().
+/// \return std::nullopt if there is no catalog or it is broken
+H5GEO_EXPORT std::optional<std::vector<H5CatalogEntry>> readCatalog(
+    h5gt::File file);
+
+/// \brief Append just created geo-object to the catalog.
+/// Does nothing if the file has no catalog.
+H5GEO_EXPORT bool addToCatalog(
+    const h5gt::Group& objG,
+    const h5geo::ObjectType& objType);
+
+/// \brief Remove geo-object and geo-objects within it from the catalog
+///
+/// Entries are marked removed in place, the catalog is compacted
+/// when removed entries outnumber the others.
+/// \param objPath full path to the object
+H5GEO_EXPORT bool removeFromCatalog(
+    h5gt::File file,
+    const std::string& objPath);
+
+/// \brief Update well's UWI in the catalog
+H5GEO_EXPORT bool setCatalogUWI(
+    const h5gt::Group& wellG,
+    const std::string& uwi);
+
+/// \brief Select catalog paths of given type within the parent group. \n
+/// The rules are the same as for H5BaseImpl::getChildGroupList():
+/// recursive search doesn't look inside geo-objects of the same type.
+/// Paths are sorted in the HDF5 link name order.
+/// \param parentPath full path to the parent group
+H5GEO_EXPORT std::vector<std::string> findInCatalog(
+    const std::vector<H5CatalogEntry>& catalog,
+    const std::string& parentPath,
+    const h5geo::ObjectType& objType,
+    bool recursive);
+
 H5GEO_EXPORT std::vector<std::string> getRawBinHeaderNames();
 H5GEO_EXPORT std::vector<std::string> getRawTraceHeaderNames();
 
@@ -566,6 +758,95 @@ H5GEO_EXPORT std::map<std::string, Eigen::VectorXd>
         double z,
         double orientation);
 
+/// \brief Find the nearest nodes of rotated regular XY grid (like `H5Vol` plan).
+///
+/// Node `(iX, iY)` is placed at: \n
+/// `X = x0 + iX*dx*cos(orientation) - iY*dy*sin(orientation)` \n
+/// `Y = y0 + iX*dx*sin(orientation) + iY*dy*cos(orientation)`
+/// \param orientation counter clock (radians)
+/// \return node indexes `iY*nx + iX` (`-1` for points outside the grid)
+H5GEO_EXPORT Eigen::VectorX<ptrdiff_t> calcGridNodeIndexes(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y,
+    double x0, double dx, size_t nx,
+    double y0, double dy, size_t ny,
+    double orientation);
+
+/// \brief Calculate amplitude attribute of the samples window.
+///
+/// `NaN` samples and samples equal to `nullValue` are skipped.
+/// \return `NaN` if there are no valid samples
+H5GEO_EXPORT double calcWindowAttribute(
+    const Eigen::Ref<const Eigen::VectorXf>& v,
+    const WindowAttribute& attribute,
+    double nullValue = std::nan("nan"));
+
+/// \brief Linearly interpolate samples at fractional index `pos`.
+///
+/// \return `NaN` if `pos` is outside of `v` or neighbour samples
+/// are `NaN` or equal to `nullValue`
+H5GEO_EXPORT double interpolateSample(
+    const Eigen::Ref<const Eigen::VectorXf>& v,
+    double pos,
+    double nullValue = std::nan("nan"));
+
+/// \brief Reduces samples window to a value (i.e. calcWindowAttribute()),
+/// second argument is fractional index of point's `Z` within the window.
+///
+/// H5Seis and H5Vol read samples `[z-windowAbove-padSamples, z+windowBelow+padSamples]`
+/// around points chunk by chunk and call it in parallel for the windows
+/// of each chunk.
+typedef std::function<double(const Eigen::Ref<const Eigen::VectorXf>&, double)> WindowReducer;
+
+/// \brief Reads amplitudes at `x`, `y`, `z` points given in `lengthUnits`
+/// and `zUnits` (`NaN` where there is no data). \n
+/// H5Seis and H5Vol pass their window attribute or interpolated amplitudes.
+typedef std::function<Eigen::VectorXd(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y,
+    const Eigen::Ref<const Eigen::VectorXd>& z,
+    const std::string& lengthUnits,
+    const std::string& zUnits)> AmplitudeReader;
+
+/// \brief Read amplitudes at horizon points and write them as horizon
+/// component `componentName` (added if needed).
+/// \param domain domain of amplitudes (must be the same as horizon's one)
+H5GEO_EXPORT bool calcHorizonWindowAttribute(
+    H5Horizon* horizon,
+    const std::string& componentName,
+    const Domain& domain,
+    const AmplitudeReader& reader,
+    const std::string& xComponent = "X",
+    const std::string& yComponent = "Y",
+    const std::string& zComponent = "Z");
+
+/// \brief Read amplitudes at map nodes (map data is `Z`) and write
+/// them as a new map within the same container.
+///
+/// If writing fails the created map is removed.
+/// \param domain domain of amplitudes (must be the same as map's one)
+/// \param dataUnits units of amplitudes
+H5GEO_EXPORT H5Map* calcMapWindowAttribute(
+    H5Map* map,
+    std::string& mapName,
+    const Domain& domain,
+    const std::string& dataUnits,
+    const AmplitudeReader& reader,
+    CreationType createFlag = CreationType::CREATE_OR_OVERWRITE);
+
+/// \brief Read amplitudes along trajectory at measured depths `md`
+///
+/// `Z` is TVDSS or time (calculated by `tdCurve`) depending on `domain`.
+/// \param temporalUnits used for `Z` in time domain
+H5GEO_EXPORT Eigen::VectorXd extractAlongTrajectory(
+    const Trajectory& traj,
+    const Eigen::Ref<const Eigen::VectorXd>& md,
+    const TimeDepthCurve& tdCurve,
+    const Domain& domain,
+    const std::string& lengthUnits,
+    const std::string& temporalUnits,
+    const AmplitudeReader& reader);
+
 /// \brief compareStrings Return `true` if strings are equal.
 /// \param bigger
 /// \param smaller
@@ -678,6 +959,11 @@ H5GEO_EXPORT ptrdiff_t getIndexFromAttribute(
     h5gt::DataSet& dataset,
     const std::string& attrName);
 
+/// \brief Get deflate (gzip) compression level of chunked dataset
+/// \return 0 if dataset is not compressed
+H5GEO_EXPORT unsigned getDeflateLevel(
+    const h5gt::DataSetCreateProps& props);
+
 /// \brief getSurveyInfoFromSortedData It is assumed that `il, xl, x, y` are IL_XL sorted:
 /// ind=sort_rows(il_xl), il=il(ind,all).eval(), xl=xl(ind,all).eval(), x=x(ind,all).eval(), y=y(ind,all).eval()
 /// \param il vector of inlines
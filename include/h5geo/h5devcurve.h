@@ -2,9 +2,12 @@
 #define H5DEVCURVE_H
 
 #include "h5baseobject.h"
+#include "private/h5trajectory.h"
 
 #include <Eigen/Dense>
 
+#include <memory>
+
 class H5WellContainer;
 class H5Well;
 
@@ -83,6 +86,40 @@ public:
       const std::string& units = "",
       bool doCoordTransform = false) = 0;
 
+	/// \brief Get trajectory built from `MD`, `AZIM`, `INCL`, `TVD`, `DX`, `DY`
+	///
+	/// Curves are loaded once and the trajectory is cached per well:
+	/// subsequent calls return the same object until any dev curve of the well,
+	/// its head coordinates, `KB` or active dev curve are changed. \n
+	/// Trajectories with `doCoordTransform` enabled are not cached
+	/// as they depend on current spatial reference settings.
+	/// \param lengthUnits units of `MD`, `X`, `Y`, `TVD`
+	/// \param resampleStep if positive then stations are resampled
+	/// with this `MD` step using minimum curvature
+	/// \param doCoordTransform transform well head coordinates
+	/// \return nullptr if the trajectory can't be built
+  virtual std::shared_ptr<const h5geo::Trajectory> getTrajectory(
+      const std::string& lengthUnits = "",
+      double resampleStep = 0,
+      bool doCoordTransform = false) = 0;
+	/// \brief Calculate `X`, `Y`, `TVD`, `TVDSS` (columns) at given `MD`
+	///
+	/// Uses cached trajectory (see H5DevCurve::getTrajectory()
+	/// and h5geo::Trajectory::mdToXYTvd())
+  virtual Eigen::MatrixXd mdToXYTvd(
+      const Eigen::Ref<const Eigen::VectorXd>& md,
+      const std::string& lengthUnits = "",
+      bool minCurvature = true,
+      bool doCoordTransform = false) = 0;
+	/// \brief Calculate `MD` at given `TVD`
+	///
+	/// Uses cached trajectory (see H5DevCurve::getTrajectory()
+	/// and h5geo::Trajectory::tvdToMd())
+  virtual Eigen::VectorXd tvdToMd(
+      const Eigen::Ref<const Eigen::VectorXd>& tvd,
+      const std::string& lengthUnits = "",
+      bool minCurvature = true) = 0;
+
 	/// \brief Get current dev curve's name
 	///
 	/// Returned curve name is relative to `DEV` Group within H5Well.
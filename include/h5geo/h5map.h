@@ -5,6 +5,8 @@
 
 #include <Eigen/Dense>
 
+#include <future>
+
 class H5MapContainer;
 
 /// \class H5Map
@@ -55,6 +57,44 @@ public:
 	/// \brief Read data from DataSet
   virtual Eigen::MatrixXd getData(const std::string& dataUnits = "") = 0;
 
+  /// \brief Write block of data starting from `iX0, iY0` indices
+  ///
+  /// `M` matrix is of size: nRows=nX, nCols=nY (see H5Map::getNX() and H5Map::getNY()).
+  /// The block must fit the map (the map is not resized).
+  virtual bool writeData(
+      Eigen::Ref<Eigen::MatrixXd> M,
+      const size_t& iX0,
+      const size_t& iY0,
+      const std::string& dataUnits = "") = 0;
+
+  /// \brief Read window `[iX0, iX0+nX) x [iY0, iY0+nY)` taking every `stride` node
+  ///
+  /// Returned matrix is of size: nRows=ceil(nX/stride), nCols=ceil(nY/stride).
+  /// Only the chunks covering the window are read, thus use it to
+  /// stream big maps tile by tile or to get decimated preview.
+  virtual Eigen::MatrixXd getData(
+      const size_t& iX0,
+      const size_t& iY0,
+      const size_t& nX,
+      const size_t& nY,
+      const size_t& stride = 1,
+      const std::string& dataUnits = "") = 0;
+
+  /// \brief Read window of data asynchronously
+  ///
+  /// The same as H5Map::getData() but the read is queued to the
+  /// dedicated I/O thread (see h5geo::IOQueue). \n
+  /// Synchronous reads and writes of data of this object wait for its pending requests.
+  /// Other HDF5 calls must not be made until the requests are done unless
+  /// HDF5 is thread-safe (see h5geo::HDF5Lock).
+  virtual std::future<Eigen::MatrixXd> getDataAsync(
+      const size_t& iX0,
+      const size_t& iY0,
+      const size_t& nX,
+      const size_t& nY,
+      const size_t& stride = 1,
+      const std::string& dataUnits = "") = 0;
+
 	/// \brief Set domain for the map (`TVD`, `TVDSS`, `TWT`, `OWT`)
   virtual bool setDomain(const h5geo::Domain& domain) = 0;
 	/// \brief Set coordinates of upper-left matrix corner
@@ -2,9 +2,13 @@
 #define H5SEIS_H
 
 #include "h5baseobject.h"
+#include "private/h5surveyinfo.h"
+#include "private/h5trajectory.h"
 
 #include <Eigen/Dense>
 
+#include <future>
+
 #ifndef _USE_MATH_DEFINES
 #define _USE_MATH_DEFINES   // should be before <cmath>, include 'pi' val
 #endif
@@ -12,6 +16,8 @@
 
 class H5SeisContainer;
 class H5Vol;
+class H5Horizon;
+class H5Map;
 
 /// \class H5Seis
 /// \brief Provides API to work with seismic
@@ -107,6 +113,8 @@ public:
       const std::string& unitsFrom = "",
       const std::string& unitsTo = "") = 0;
   /// \brief Write block of traces starting from trace `fromTrc` and from sample `fromSampInd`
+  ///
+  /// `TRACE` isn't modified: units conversion is applied while writing.
   virtual bool writeTrace(
       Eigen::Ref<Eigen::MatrixXf> TRACE,
       const size_t& fromTrc = 0,
@@ -144,7 +152,8 @@ public:
 
   /// \brief Write `XY` trace headers (two columns in Eigen column-major matrix)
   ///
-  /// Same as H5Seis::writeTraceHeaders() but also able to do a coordinate transformation.
+  /// Same as H5Seis::writeTraceHeaders() but also able to do a coordinate transformation. \n
+  /// `xy` isn't modified (units conversion and transformation are applied to a copy).
   virtual bool writeXYTraceHeaders(
       const std::vector<std::string>& xyHdrNames,
       Eigen::Ref<Eigen::MatrixX2d>& xy,
@@ -154,7 +163,8 @@ public:
   /// \brief Write `XY` trace headers (two columns in Eigen column-major matrix)
   ///
   /// Same as H5Seis::writeTraceHeaders() but also able to do a coordinate transformation. \n
-  /// Return `true` even if max `trcInd` exceeds `nTrc`.
+  /// Return `true` even if max `trcInd` exceeds `nTrc`. \n
+  /// `xy` isn't modified (units conversion and transformation are applied to a copy).
   virtual bool writeXYTraceHeaders(
       const std::vector<std::string>& xyHdrNames,
       Eigen::Ref<Eigen::MatrixX2d>& xy,
@@ -162,6 +172,29 @@ public:
       const std::string& lengthUnits = "",
       bool doCoordTransform = false) = 0;
 
+  /// \brief Reproject `XY` trace headers in place to `srTo` CRS
+  ///
+  /// Headers are read by blocks of `nTrcBuffer` traces, transformed in
+  /// parallel (see h5geo::transformCoordinates()) while the next block
+  /// is being read and written back. Length units are kept. \n
+  /// Seis spatial reference is set to `srTo` only if all the pairs
+  /// `SRCX/SRCY`, `GRPX/GRPY` and `CDP_X/CDP_Y` are reprojected, otherwise it
+  /// is kept (i.e. to bring some headers to the seis CRS).
+  /// \warning Blocks are written back one by one: if reading, writing or
+  /// transforming of some block fails, the function stops and the headers
+  /// of the previous blocks stay reprojected (spatial reference isn't changed).
+  /// The failed block itself is never written.
+  /// \param srTo target CRS (i.e. `EPSG:32631` or WKT)
+  /// \param xyHdrNames pairs of `X`, `Y` header names
+  /// \param nTrcBuffer number of traces processed at once
+  /// \return false if GDAL isn't used, transformation can't be created or
+  /// some points fail to transform
+  virtual bool reprojectXYTraceHeaders(
+      const std::string& srTo,
+      const std::vector<std::pair<std::string, std::string>>& xyHdrNames =
+      {{"SRCX", "SRCY"}, {"GRPX", "GRPY"}, {"CDP_X", "CDP_Y"}},
+      size_t nTrcBuffer = 1e6) = 0;
+
   /// \brief Resize trace and trace header DataSets
   virtual bool setNTrc(size_t nTrc) = 0;
   /// \brief Resize trace DataSet
@@ -200,6 +233,38 @@ public:
       size_t nSamp = std::numeric_limits<size_t>::max(),
       const std::string& dataUnits = "") = 0;
 
+  /// \brief Read block of traces to preallocated `TRACE` (`nSamp x nTrc`)
+  ///
+  /// The same as H5Seis::getTrace() but number of traces and samples
+  /// are taken from `TRACE` size and no memory is allocated.
+  /// `TRACE` must be contiguous. \n
+  /// Return `false` if the block exceeds the limits or units are incompatible.
+  /// \note If the file is opened with MPI-IO driver (H5FileAccessParam::mpiComm)
+  /// block reads/writes of traces and trace headers are collective: every
+  /// rank passes its own block (rank without data passes zero traces).
+  virtual bool readTrace(
+      Eigen::Ref<Eigen::MatrixXf> TRACE,
+      const size_t& fromTrc,
+      const size_t& fromSampInd = 0,
+      const std::string& dataUnits = "") = 0;
+
+  /// \brief Get block of traces asynchronously
+  ///
+  /// The same as H5Seis::getTrace() but the read is queued to the
+  /// dedicated I/O thread (see h5geo::IOQueue). Requests queued while
+  /// the thread is busy having the same samples window and units and
+  /// overlapping or adjacent trace ranges are coalesced into one
+  /// hyperslab read. \n
+  /// Synchronous reads and writes of traces and headers of this object wait for its pending requests.
+  /// Other HDF5 calls must not be made until the requests are done unless
+  /// HDF5 is thread-safe (see h5geo::HDF5Lock).
+  virtual std::future<Eigen::MatrixXf> getTraceAsync(
+      const size_t& fromTrc,
+      size_t nTrc = 1,
+      const size_t& fromSampInd = 0,
+      size_t nSamp = std::numeric_limits<size_t>::max(),
+      const std::string& dataUnits = "") = 0;
+
   /// \brief Get block of trace headers
   ///
   /// If `nTrc` or `nHdr` exceed max values then these values are
@@ -211,6 +276,27 @@ public:
       size_t nHdr = std::numeric_limits<size_t>::max(),
       const std::vector<std::string>& unitsFrom = std::vector<std::string>(),
       const std::vector<std::string>& unitsTo = std::vector<std::string>()) = 0;
+  /// \brief Read block of trace headers to preallocated `HDR` (`nTrc x nHdr`)
+  ///
+  /// The same as H5Seis::getTraceHeader() but number of traces and headers
+  /// are taken from `HDR` size and no memory is allocated.
+  /// `HDR` must be contiguous. \n
+  /// Return `false` if the block exceeds the limits.
+  virtual bool readTraceHeader(
+      Eigen::Ref<Eigen::MatrixXd> HDR,
+      const size_t& fromTrc,
+      const size_t& fromHdr = 0,
+      const std::vector<std::string>& unitsFrom = std::vector<std::string>(),
+      const std::vector<std::string>& unitsTo = std::vector<std::string>()) = 0;
+  /// \brief Read block of trace header by name to preallocated `hdr`
+  ///
+  /// Number of traces is taken from `hdr` size.
+  virtual bool readTraceHeader(
+      const std::string& hdrName,
+      Eigen::Ref<Eigen::VectorXd> hdr,
+      const size_t& fromTrc,
+      const std::string& unitsFrom = "",
+      const std::string& unitsTo = "") = 0;
   /// \brief Get block of trace header by name
   ///
   /// If `nTrc` exceeds max value then this value is
@@ -286,6 +372,8 @@ public:
   /// \brief Get sorted data based on precalculated primary sort keys
   ///
   /// Before using it one should prepare primary sort keys with H5Seis::addPKeySort() method.
+  /// If composite sort was prepared for the same `keyList` with H5Seis::addCompositeSort()
+  /// then it is used instead and no sorting is done.
   /// \param TRACE not Eigen::Ref<> because Eigen::Ref<> doesn't allow to resize matrices
   /// \param HDR not Eigen::Ref<> because Eigen::Ref<> doesn't allow to resize matrices
   /// \param keyList trace header names to be worked with (first is treated as `PKey`)
@@ -480,6 +568,21 @@ public:
   /// If you plan to get `CDP-DSREG` data, you have to call H5Seis::addPKeySort("CDP") first.
   virtual bool addPKeySort(const std::string& pKeyName) = 0;
 
+  /// \brief Check if composite sort is prepared for a given list of keys
+  virtual bool hasCompositeSort(const std::vector<std::string>& keyList) = 0;
+  /// \brief Remove composite sort
+  virtual bool removeCompositeSort(const std::vector<std::string>& keyList) = 0;
+  /// \brief Prepare composite sort (for ex. `{"INLINE", "XLINE"}` or `{"CDP", "OFFSET"}`)
+  ///
+  /// Trace order and unique key combinations are calculated once and stored
+  /// on disk. H5Seis::getSortedData() with exactly the same `keyList`
+  /// then becomes a range lookup instead of sorting at every call. \n
+  /// Writing any of the keys (or changing number of traces) removes the sort. \n
+  /// Key names must not contain `-` (it separates keys in the sort name).
+  virtual bool addCompositeSort(const std::vector<std::string>& keyList) = 0;
+  /// \brief Get names of prepared composite sorts (keys are separated by `-`)
+  virtual std::vector<std::string> getCompositeSortNames() = 0;
+
   /// \brief Set trace header samp rate from binary header
   virtual bool updateTraceHeaderSampRate() = 0;
   /// \brief Set trace header number of samples from binary header
@@ -502,6 +605,8 @@ public:
   virtual std::optional<h5gt::Group> getUValG() = 0;
   /// \brief Get sorting indexes Group
   virtual std::optional<h5gt::Group> getIndexesG() = 0;
+  /// \brief Get composite sorting Group
+  virtual std::optional<h5gt::Group> getCompositeG() = 0;
 
   /// \brief Get `SEGY` Group (for mapped H5Seis only)
   virtual std::optional<h5gt::Group> getSEGYG() = 0;
@@ -522,24 +627,184 @@ public:
   virtual bool updateTraceHeaderLimits(size_t nTrcBuffer = 1e7) = 0;
   /// \brief Update sorting for prepared `PKey`
   virtual bool updatePKeySort(const std::string& pKeyName) = 0;
+  /// \brief Update prepared composite sorting
+  virtual bool updateCompositeSort(const std::vector<std::string>& keyList) = 0;
 
   /// \brief Calculate `XY` boundary around the survey
   ///
-  /// Return two cols Eigen matrix. Use it to write as H5Horizon.
+  /// Return two cols Eigen matrix. Use it to write as H5Horizon. \n
+  /// Boundary saved within seis group is returned if it exists.
+  /// Otherwise convex boundary is calculated but not saved
+  /// (use H5Seis::updateBoundary() to save it).
   virtual Eigen::MatrixXd calcBoundary(
       const std::string& lengthUnits = "",
       bool doCoordTransform = false) = 0;
 
+  /// \brief Calculate `XY` boundary and save it within seis group
+  ///
+  /// `CDP_X` and `CDP_Y` are read by `nTrcBuffer` traces and hulls of
+  /// the blocks are calculated in parallel (see h5geo::convexHull2D()),
+  /// thus memory doesn't depend on number of traces.
+  /// Concave boundary takes the second pass over headers
+  /// (see h5geo::ConcaveBoundaryEstimator). \n
+  /// 2D stack boundary is always the line of sorted `CDP`
+  /// (saved as h5geo::BoundaryType::LINE). \n
+  /// Saved boundary is removed when `CDP_X`, `CDP_Y` or number of traces change.
+  /// \param boundaryType convex hull or concave boundary
+  /// \param cellSize resolution of concave boundary (`0` means 1/64 of the survey extent)
+  /// \param nTrcBuffer number of traces read at once
+  virtual bool updateBoundary(
+      const h5geo::BoundaryType& boundaryType = h5geo::BoundaryType::CONVEX,
+      double cellSize = 0,
+      size_t nTrcBuffer = 1e6) = 0;
+  /// \brief Remove boundary saved by H5Seis::updateBoundary()
+  virtual bool removeBoundary() = 0;
+  /// \brief Get boundary DataSet (`X` and `Y` rows)
+  virtual std::optional<h5gt::DataSet> getBoundaryD() const = 0;
+
+  /// \brief Estimate post-stack survey geometry (bin grid)
+  ///
+  /// Trace headers are read in blocks of `nTrcBuffer` traces and
+  /// passed to h5geo::SurveyInfoEstimator, thus neither sorting
+  /// nor the whole header table in memory is needed. \n
+  /// Only traces within `[ilMin, ilMax]` and `[xlMin, xlMax]` are used.
+  virtual bool calcSurveyInfo(
+      h5geo::SurveyInfo& info,
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE",
+      double ilMin = std::numeric_limits<double>::lowest(),
+      double ilMax = std::numeric_limits<double>::max(),
+      double xlMin = std::numeric_limits<double>::lowest(),
+      double xlMax = std::numeric_limits<double>::max(),
+      size_t nTrcBuffer = 1e6) = 0;
+
+  /// \brief Map each trace to the survey grid cell (see h5geo::getSurveyCellIndexes())
+  ///
+  /// Return vector of size `nTrc`. Traces outside the grid get `-1`.
+  virtual Eigen::VectorX<ptrdiff_t> calcTraceCellIndexes(
+      const h5geo::SurveyInfo& info,
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE",
+      size_t nTrcBuffer = 1e6) = 0;
+
+  /// \brief Calculate amplitude attribute within window around points
+  ///
+  /// Each point is snapped to the nearest trace of the survey grid
+  /// (see H5Seis::calcSurveyInfo()) and only samples within
+  /// `[z-windowAbove, z+windowBelow]` are read. Traces are read in
+  /// chunk order and attributes are calculated in parallel. \n
+  /// Points outside the survey or the sample range get `NaN`.
+  /// \param lengthUnits units of `x` and `y`
+  /// \param zUnits units of `z`, `windowAbove` and `windowBelow`
+  virtual Eigen::VectorXd calcWindowAttribute(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y,
+      const Eigen::Ref<const Eigen::VectorXd>& z,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      const std::string& lengthUnits = "",
+      const std::string& zUnits = "",
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE") = 0;
+
+  /// \brief Interpolate amplitudes at points
+  ///
+  /// Each point is snapped to the nearest trace of the survey grid and
+  /// amplitude is interpolated linearly between two neighbouring samples.
+  /// Only traces containing points are read (see H5Seis::calcWindowAttribute()). \n
+  /// Points outside the survey or next to null samples get `NaN`.
+  /// \param lengthUnits units of `x` and `y`
+  /// \param zUnits units of `z`
+  virtual Eigen::VectorXd interpolateAmplitudes(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y,
+      const Eigen::Ref<const Eigen::VectorXd>& z,
+      const std::string& lengthUnits = "",
+      const std::string& zUnits = "",
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE") = 0;
+
+  /// \brief Extract amplitudes along deviated well path (synthetic trace)
+  ///
+  /// Trajectory is sampled at `md` (see h5geo::Trajectory::mdToXYZ()) and
+  /// amplitudes are interpolated at resulting points
+  /// (see H5Seis::interpolateAmplitudes()). For time data `TVDSS` is
+  /// converted to `TWT` by `tdCurve`.
+  /// \param traj trajectory (see H5DevCurve::getTrajectory())
+  /// \param md measured depths to sample
+  /// \param tdCurve time-depth curve (needed for `TWT` and `OWT` domains)
+  /// \param lengthUnits units of trajectory, `md` and `tdCurve` depths
+  /// \param temporalUnits units of `tdCurve` times
+  virtual Eigen::VectorXd extractAlongTrajectory(
+      const h5geo::Trajectory& traj,
+      const Eigen::Ref<const Eigen::VectorXd>& md,
+      const h5geo::TimeDepthCurve& tdCurve = h5geo::TimeDepthCurve(),
+      const std::string& lengthUnits = "",
+      const std::string& temporalUnits = "",
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE") = 0;
+
+  /// \brief Calculate amplitude attribute along horizon (see H5Seis::calcWindowAttribute())
+  ///
+  /// Result is written to horizon component `componentName` (it is added if needed).
+  /// Windows are in horizon units and domain must be the same as seismic domain.
+  virtual bool calcHorizonWindowAttribute(
+      H5Horizon* horizon,
+      const std::string& componentName,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      const std::string& xComponent = "X",
+      const std::string& yComponent = "Y",
+      const std::string& zComponent = "Z",
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE") = 0;
+
+  /// \brief Calculate amplitude attribute along map (see H5Seis::calcWindowAttribute())
+  ///
+  /// Map values are treated as `Z`. Result is written to new map `mapName` that has
+  /// the same geometry and resides in the same container as `map`.
+  /// Windows are in map data units and domain must be the same as seismic domain.
+  /// \return new map or `nullptr`
+  virtual H5Map* calcMapWindowAttribute(
+      H5Map* map,
+      std::string& mapName,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      h5geo::CreationType createFlag = h5geo::CreationType::CREATE_OR_OVERWRITE,
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE") = 0;
+
   /// \brief Export seismic to `H5Vol`. 
-  /// \note Selected traces must shape a rectangle.
+  ///
+  /// Traces are binned to the survey grid (see H5Seis::calcSurveyInfo()),
+  /// thus missing traces and ragged edges are allowed. Missing cells
+  /// are read as `nullValue` and chunks without traces are not allocated.
+  /// \note Volume dataset is recreated. Return false if IL/XL are duplicated.
+  /// \note If `vol` file is opened with MPI-IO driver the call is collective:
+  /// work units (groups of chunks) are dealt round-robin between the ranks.
   virtual bool exportToVol(H5Vol* vol, 
       const std::string& xHeader = "CDP_X",
       const std::string& yHeader = "CDP_Y",
       const std::string& ilHeader = "INLINE",
       const std::string& xlHeader = "XLINE",
-      double ilMin = std::numeric_limits<double>::min(),
+      double ilMin = std::numeric_limits<double>::lowest(),
       double ilMax = std::numeric_limits<double>::max(),
-      double xlMin = std::numeric_limits<double>::min(),
+      double xlMin = std::numeric_limits<double>::lowest(),
       double xlMax = std::numeric_limits<double>::max(),
       size_t fromSampInd = 0,
       size_t nSamp = std::numeric_limits<size_t>::max(),
@@ -2,10 +2,15 @@
 #define H5VOL_H
 
 #include "h5baseobject.h"
+#include "private/h5trajectory.h"
 
 #include <Eigen/Dense>
 
+#include <future>
+
 class H5VolContainer;
+class H5Horizon;
+class H5Map;
 
 /// \class H5Vol
 /// \brief Provides API to work with volumes
@@ -19,7 +24,11 @@ protected:
 public:
 
   /// \brief Write subvolume starting from iX0, iY0, iZ0 indices.
-  /// `data` matrix is of size: nRows=nX, nCols=nY*nZ
+  /// `data` matrix is of size: nRows=nX, nCols=nY*nZ.
+  /// `data` isn't modified: units conversion is applied while writing.
+  /// \note If the file is opened with MPI-IO driver (H5FileAccessParam::mpiComm)
+  /// writeData(), readData() and getData() are collective: every rank passes
+  /// its own brick (rank without data passes `nZ = 0`)
   virtual bool writeData(
       Eigen::Ref<Eigen::MatrixXf> data,
       const size_t& iX0,
@@ -87,6 +96,20 @@ public:
   virtual bool resize(
       size_t nx, size_t ny, size_t nz) = 0;
 
+  /// \brief Read subvolume to preallocated `data` (no memory is allocated)
+  ///
+  /// The same as H5Vol::getData() but `data` must be contiguous matrix
+  /// of size: nRows=nX*nY, nCols=nZ
+  virtual bool readData(
+      Eigen::Ref<Eigen::MatrixXf> data,
+      const size_t& iX0,
+      const size_t& iY0,
+      const size_t& iZ0,
+      const size_t& nX,
+      const size_t& nY,
+      const size_t& nZ,
+      const std::string& dataUnits = "") = 0;
+
   /// \brief Read subvolume starting from iX0, iY0, iZ0 indices.
   /// `data` matrix is of size: nRows=nX, nCols=nY*nZ
   virtual Eigen::MatrixXf getData(
@@ -98,6 +121,25 @@ public:
       const size_t& nZ,
       const std::string& dataUnits = "") = 0;
 
+  /// \brief Read subvolume asynchronously
+  ///
+  /// The same as H5Vol::getData() but the read is queued to the
+  /// dedicated I/O thread (see h5geo::IOQueue). Requests queued while
+  /// the thread is busy having the same `X`, `Y` window and units and
+  /// overlapping or adjacent `Z` ranges are coalesced into one
+  /// hyperslab read. \n
+  /// Synchronous reads and writes of data of this object wait for its pending requests.
+  /// Other HDF5 calls must not be made until the requests are done unless
+  /// HDF5 is thread-safe (see h5geo::HDF5Lock).
+  virtual std::future<Eigen::MatrixXf> getDataAsync(
+      const size_t& iX0,
+      const size_t& iY0,
+      const size_t& iZ0,
+      const size_t& nX,
+      const size_t& nY,
+      const size_t& nZ,
+      const std::string& dataUnits = "") = 0;
+
   /// \brief Get domain (`TVD`, `TVDSS`, `TWT`, `OWT`)
   virtual h5geo::Domain getDomain() = 0;
   /// \brief Get coordinates of origin
@@ -128,12 +170,93 @@ public:
   /// \brief Get current vol's DataSet
   virtual std::optional<h5gt::DataSet> getVolD() const = 0;
 
+  /// \brief Calculate amplitude attribute within window around points
+  ///
+  /// Each point is snapped to the nearest XY node and only samples within
+  /// `[z-windowAbove, z+windowBelow]` are read. Points are processed
+  /// XY chunk by chunk and attributes are calculated in parallel. \n
+  /// Points outside the volume get `NaN`.
+  /// \param lengthUnits units of `x` and `y`
+  /// \param zUnits units of `z`, `windowAbove` and `windowBelow`
+  virtual Eigen::VectorXd calcWindowAttribute(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y,
+      const Eigen::Ref<const Eigen::VectorXd>& z,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      const std::string& lengthUnits = "",
+      const std::string& zUnits = "") = 0;
+
+  /// \brief Interpolate amplitudes at points
+  ///
+  /// Each point is snapped to the nearest XY node and amplitude is
+  /// interpolated linearly between two neighbouring `Z` samples.
+  /// Only XY chunks containing points are read (see H5Vol::calcWindowAttribute()). \n
+  /// Points outside the volume or next to null samples get `NaN`.
+  /// \param lengthUnits units of `x` and `y`
+  /// \param zUnits units of `z`
+  virtual Eigen::VectorXd interpolateAmplitudes(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y,
+      const Eigen::Ref<const Eigen::VectorXd>& z,
+      const std::string& lengthUnits = "",
+      const std::string& zUnits = "") = 0;
+
+  /// \brief Extract amplitudes along deviated well path (synthetic trace)
+  ///
+  /// Trajectory is sampled at `md` (see h5geo::Trajectory::mdToXYZ()) and
+  /// amplitudes are interpolated at resulting points
+  /// (see H5Vol::interpolateAmplitudes()). For time volumes `TVDSS` is
+  /// converted to `TWT` by `tdCurve`.
+  /// \param traj trajectory (see H5DevCurve::getTrajectory())
+  /// \param md measured depths to sample
+  /// \param tdCurve time-depth curve (needed for `TWT` and `OWT` domains)
+  /// \param lengthUnits units of trajectory, `md` and `tdCurve` depths
+  /// \param temporalUnits units of `tdCurve` times
+  virtual Eigen::VectorXd extractAlongTrajectory(
+      const h5geo::Trajectory& traj,
+      const Eigen::Ref<const Eigen::VectorXd>& md,
+      const h5geo::TimeDepthCurve& tdCurve = h5geo::TimeDepthCurve(),
+      const std::string& lengthUnits = "",
+      const std::string& temporalUnits = "") = 0;
+
+  /// \brief Calculate amplitude attribute along horizon (see H5Vol::calcWindowAttribute())
+  ///
+  /// Result is written to horizon component `componentName` (it is added if needed).
+  /// Windows are in horizon units and domain must be the same as volume domain.
+  virtual bool calcHorizonWindowAttribute(
+      H5Horizon* horizon,
+      const std::string& componentName,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      const std::string& xComponent = "X",
+      const std::string& yComponent = "Y",
+      const std::string& zComponent = "Z") = 0;
+
+  /// \brief Calculate amplitude attribute along map (see H5Vol::calcWindowAttribute())
+  ///
+  /// Map values are treated as `Z`. Result is written to new map `mapName` that has
+  /// the same geometry and resides in the same container as `map`.
+  /// Windows are in map data units and domain must be the same as volume domain.
+  /// \return new map or `nullptr`
+  virtual H5Map* calcMapWindowAttribute(
+      H5Map* map,
+      std::string& mapName,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      h5geo::CreationType createFlag = h5geo::CreationType::CREATE_OR_OVERWRITE) = 0;
+
   virtual bool exportToSEGY(
       const std::string& segyFile,
       h5geo::Endian endian = h5geo::Endian::Big,
       std::function<void(double)> progressCallback = nullptr) = 0;
 
   /// \brief Unlink and create new dataset without copying data
+  ///
+  /// Chunks that are never written stay unallocated and are read as `nullValue`.
   virtual bool recreateVolD(
       size_t nX, size_t nY, size_t nZ,
       size_t xChunk, size_t yChunk, size_t zChunk,
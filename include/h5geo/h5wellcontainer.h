@@ -6,8 +6,25 @@
 
 #include <memory>
 
+#include <Eigen/Dense>
+
 class H5Well;
 
+/// \struct H5WellLogs
+/// \brief Log curves of many wells in CSR-like (columnar) layout
+///
+/// Samples of `i`-th well are `[offsets(i), offsets(i+1))`
+/// both in `md` and `val`. See H5WellContainer::getLogCurves()
+struct H5WellLogs{
+  std::vector<std::string> wellNames; ///< full names of wells (well ids)
+  Eigen::VectorX<ptrdiff_t> offsets; ///< `wellNames.size()+1` offsets to the first sample of each well
+  Eigen::VectorXd md; ///< measured depth of all wells
+  Eigen::VectorXd val; ///< log values of all wells
+
+  /// \brief Number of wells
+  size_t getNWells() const { return wellNames.size(); }
+};
+
 /// \class H5WellContainer
 /// \brief A container built around HDF5 file and used 
 /// for storing and manipulating H5Well objects
@@ -39,6 +56,21 @@ public:
 	/// Works much slower than using H5WellContainer::openWell()
   virtual H5Well* openWellByUWI(
       const std::string& name) = 0;
+
+  /// \brief Read `MD` and `VAL` of the same log curve from many wells at once
+  ///
+  /// The curve is looked for as `LOG/logType/logName` within each well.
+  /// Wells without the curve (or with not convertible units) are skipped.
+  /// Unit conversion factors are calculated once per units pair.
+  /// \param wellNames wells to read (all wells of the container if empty)
+  /// \param lengthUnits units of `MD` (not converted if empty)
+  /// \param dataUnits units of `VAL` (not converted if empty)
+  virtual H5WellLogs getLogCurves(
+      const std::string& logType,
+      const std::string& logName,
+      const std::vector<std::string>& wellNames = {},
+      const std::string& lengthUnits = "",
+      const std::string& dataUnits = "") = 0;
 };
 
 using H5WellCnt_ptr = std::unique_ptr<H5WellContainer, h5geo::ObjectDeleter>;
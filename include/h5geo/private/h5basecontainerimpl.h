@@ -75,6 +75,13 @@ public:
 
   virtual h5gt::File getH5File() const override;
 
+  virtual bool beginBatch() override;
+  virtual bool endBatch() override;
+  virtual bool isBatchActive() const override;
+
+  virtual bool removeObject(const std::string& name) override;
+  virtual bool rebuildCatalog() override;
+
   virtual std::vector<h5gt::Group> getObjGroupList(const h5geo::ObjectType& objType, bool recursive) override;
   virtual std::vector<std::string> getObjNameList(const h5geo::ObjectType& objType, bool recursive) override;
   virtual size_t getObjCount(const h5geo::ObjectType& objType, bool recursive) override;
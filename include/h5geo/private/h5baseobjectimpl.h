@@ -79,6 +79,9 @@ public:
   /// exist and they are used to create transfromation
   virtual OGRCoordinateTransformation* createCoordinateTransformationToWriteData(
       const std::string& unitsFrom) override;
+
+  virtual void setSRContext(const std::shared_ptr<h5geo::SRContext>& ctx) override;
+  virtual std::shared_ptr<h5geo::SRContext> getSRContext() const override;
 #endif
 
   virtual bool setSpatialReference(const std::string& str) override;
@@ -100,6 +103,11 @@ public:
   virtual h5gt::File getH5File() const override;
   virtual h5gt::Group getObjG() const override;
 
+  virtual void setChunkCache(
+      const H5ChunkCacheParam& p,
+      const std::string& datasetName = "") override;
+  virtual void resetChunkCache() override;
+
   virtual std::string getName() const override;
   virtual std::string getFullName() const override;
 
@@ -135,6 +143,10 @@ protected:
 
 protected:
   h5gt::Group objG;
+  std::map<std::string, H5ChunkCacheParam> chunkCache; // dataset name -> cache
+#ifdef H5GEO_USE_GDAL
+  std::shared_ptr<h5geo::SRContext> srContext; // nullptr -> default context
+#endif
 };
 
 #endif // H5BASEOBJECTIMPL_H
@@ -0,0 +1,96 @@
+#ifndef H5CORE_MPI_H
+#define H5CORE_MPI_H
+
+#include "h5geo_export.h"
+
+#include <mpi.h>
+
+#include <vector>
+
+namespace h5gt {
+class File;
+class DataSet;
+}
+
+namespace h5geo
+{
+
+/// \brief File is opened with MPI-IO driver (see H5FileAccessParam::mpiComm)
+///
+/// In this mode block reads and writes of traces, trace headers and
+/// volume data are collective: every rank of the file's communicator
+/// must call them (rank without data passes an empty block).
+H5GEO_EXPORT bool isMPIFile(const h5gt::File& file);
+
+/// \class MPIFileComm
+/// \brief Communicator of the file opened with MPI-IO driver
+///
+/// Construction is collective (communicator is duplicated).
+/// If the file doesn't use MPI-IO then the object is invalid and
+/// acts as a single rank.
+class H5GEO_EXPORT MPIFileComm
+{
+public:
+  explicit MPIFileComm(const h5gt::File& file);
+  ~MPIFileComm();
+
+  MPIFileComm(const MPIFileComm&) = delete;
+  MPIFileComm& operator=(const MPIFileComm&) = delete;
+
+  bool isValid() const;
+  MPI_Comm get() const;
+  int getRank() const;
+  int getSize() const;
+
+  /// \brief `true` if `val` is `true` on every rank (collective)
+  bool all(bool val) const;
+
+private:
+  MPI_Comm comm = MPI_COMM_NULL;
+  int rank = 0, size = 1;
+};
+
+/// \brief Split `n` items to `size` contiguous parts and get
+/// part `[from, from+count)` of the `rank`
+///
+/// Parts differ in size by one item at most.
+H5GEO_EXPORT void partitionMPI(
+    size_t n, int rank, int size,
+    size_t& from, size_t& count);
+
+/// \brief Collective read of hyperslab `offset, count` (row-major
+/// dataset dims) to contiguous `data`
+///
+/// Rank with nothing to read passes `count` with zero product.
+/// Must be called by every rank of the file's communicator.
+H5GEO_EXPORT bool readCollective(
+    const h5gt::DataSet& dset,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    float* data);
+H5GEO_EXPORT bool readCollective(
+    const h5gt::DataSet& dset,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    double* data);
+
+/// \brief Collective write of contiguous `data` to hyperslab `offset, count`
+///
+/// Rank with nothing to write passes `count` with zero product.
+/// Must be called by every rank of the file's communicator.
+H5GEO_EXPORT bool writeCollective(
+    const h5gt::DataSet& dset,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    const float* data);
+H5GEO_EXPORT bool writeCollective(
+    const h5gt::DataSet& dset,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    const double* data);
+
+
+} // h5geo
+
+
+#endif // H5CORE_MPI_H
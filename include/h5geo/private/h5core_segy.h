@@ -285,6 +285,9 @@ H5GEO_EXPORT Eigen::MatrixXf readSEGYTraces(
 /// \param nThreads number of threads (to use all threads pass any number `<1`)
 /// \param progressCallback callback function of form `void foo(double progress)`
 /// \note Memory Mappings works only if the SEGY file resides on the internal hardware
+/// \note If `seis` file is opened with MPI-IO driver (H5FileAccessParam::mpiComm)
+/// the call is collective: blocks of `trcBuffer` traces are dealt round-robin
+/// between the ranks and written collectively
 /// \return
 H5GEO_EXPORT bool readSEGYTracesMMap(
     H5Seis* seis,
@@ -5,17 +5,156 @@
 #include "h5geo/h5core.h"
 
 #include <string>
+#include <memory>
 
 #include <Eigen/Dense>
 
 class OGRSpatialReference;
+class OGRCoordinateTransformation;
 
 namespace h5geo
 {
 
+/// \brief Create coordinate transformation between two CRS
+///
+/// CRS are given as any string accepted by
+/// `OGRSpatialReference::SetFromUserInput` (i.e. `EPSG:32631` or WKT).
+/// Creating transformation (PROJ database lookups, operation search)
+/// takes milliseconds thus prepared transformations are cached by
+/// `(srFrom, unitsFrom, srTo, unitsTo)`. Each thread keeps its own cache
+/// (and thus uses its own PROJ context) of 64 least recently used
+/// transformations and the caller gets a cheap clone.
+/// \return new object that must be deleted by the caller (use `OGRCT_ptr`)
+/// or `nullptr` if transformation can't be created
+H5GEO_EXPORT OGRCoordinateTransformation* createCoordinateTransformation(
+    const std::string& srFrom,
+    const std::string& unitsFrom,
+    const std::string& srTo,
+    const std::string& unitsTo);
+
+/// \brief Remove cached coordinate transformations in all threads
+H5GEO_EXPORT void clearCoordinateTransformations();
+
+/// \brief Transform coordinates in place using several threads
+///
+/// Points are split to chunks of `chunkSize` and each thread transforms
+/// its chunks with its own clone of `coordTrans` made on that thread
+/// (OGRCoordinateTransformation isn't thread-safe). The calling thread
+/// uses `coordTrans` itself.
+/// \return false if `coordTrans` is `nullptr` or some points failed
+/// to transform (such points are set to `HUGE_VAL` by GDAL)
+H5GEO_EXPORT bool transformCoordinates(
+    OGRCoordinateTransformation* coordTrans,
+    size_t n, double* x, double* y,
+    size_t chunkSize = 65536);
+
+
+/// \class SRContext
+/// \brief Spatial reference settings: CRS, units and domain
+/// used to read/write geo-objects data
+///
+/// All methods are thread-safe so single context may be shared between
+/// threads while each service (or thread) may also have its own context.
+/// Functions from `h5geo::sr` namespace work with the default context
+/// (see h5geo::sr::getDefaultContext()).
+class H5GEO_EXPORT SRContext
+{
+public:
+  SRContext();
+  SRContext(const SRContext& other);
+  SRContext& operator=(const SRContext& other);
+  ~SRContext();
+
+  /// \brief If True then coord transform will be omited on failure.
+  /// Otherwise invalid transformation will be given.
+  /// Default value is False
+  void setIgnoreCoordTransformOnFailure(bool val);
+  bool getIgnoreCoordTransformOnFailure() const;
+
+  /// \brief Set spatial reference from OGRSpatialReference.
+  /// \note consider using other API through `std::string` to
+  /// avoid problems with returning back AuthName, AuthCode or SRName
+  void setSpatialReference(const OGRSpatialReference& sr);
+  /// \note Length and Angular units must be set separately before or after calling this
+  void setSpatialReferenceFromUserInput(
+      const std::string& name);
+  /// \note Length and Angular units must be set separately before or after calling this
+  void setSpatialReferenceFromUserInput(
+      const std::string& authName, const std::string& code);
+  OGRSpatialReference getSpatialReference() const;
+  /// \brief String used to recreate CRS (user input or WKT)
+  std::string getSpatialReferenceDefinition() const;
+
+  void setLengthUnits(const std::string& units);
+  void setAngularUnits(const std::string& units);
+  void setTemporalUnits(const std::string& units);
+
+  /// \brief may return empty string if spatial reference were set through OGRSpatialReference
+  std::string getAuthName() const;
+  /// \brief may return empty string if spatial reference were set through OGRSpatialReference
+  std::string getAuthCode() const;
+  /// \brief may return empty string if spatial reference were set through OGRSpatialReference
+  std::string getSRName() const;
+  std::string getLengthUnits() const;
+  std::string getAngularUnits() const;
+  std::string getTemporalUnits() const;
+
+  void setDomain(const std::string& domain);
+  void setDomain(const h5geo::Domain& domain);
+
+  std::string getDomain() const;
+  h5geo::Domain getDomainEnum() const;
+
+  /// \brief Create transformation from given CRS to the context CRS
+  /// (see h5geo::createCoordinateTransformation())
+  OGRCoordinateTransformation* createCoordinateTransformationFrom(
+      const std::string& srFrom,
+      const std::string& unitsFrom,
+      const std::string& unitsTo) const;
+  /// \brief Create transformation from the context CRS to the given CRS
+  /// (see h5geo::createCoordinateTransformation())
+  OGRCoordinateTransformation* createCoordinateTransformationTo(
+      const std::string& srTo,
+      const std::string& unitsTo,
+      const std::string& unitsFrom) const;
+
+  /// Transform from given CRS to the context CRS
+  bool transformCoordFrom(
+      Eigen::Ref<Eigen::MatrixXd> x,
+      Eigen::Ref<Eigen::MatrixXd> y,
+      const std::string& unitsFrom,
+      const std::string& srAuthAndCodeFrom) const;
+  /// Transform from given CRS to the context CRS
+  bool transformCoordFrom(
+      Eigen::Ref<Eigen::MatrixXf> x,
+      Eigen::Ref<Eigen::MatrixXf> y,
+      const std::string& unitsFrom,
+      const std::string& srAuthAndCodeFrom) const;
+  /// Transform from the context CRS to the given CRS
+  bool transformCoordTo(
+      Eigen::Ref<Eigen::MatrixXd> x,
+      Eigen::Ref<Eigen::MatrixXd> y,
+      const std::string& unitsTo,
+      const std::string& srAuthAndCodeTo) const;
+  /// Transform from the context CRS to the given CRS
+  bool transformCoordTo(
+      Eigen::Ref<Eigen::MatrixXf> x,
+      Eigen::Ref<Eigen::MatrixXf> y,
+      const std::string& unitsTo,
+      const std::string& srAuthAndCodeTo) const;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> d;
+};
+
 
 namespace sr {
 
+/// \brief Context used by `h5geo::sr` functions and by geo-objects
+/// that don't have their own context
+H5GEO_EXPORT std::shared_ptr<SRContext> getDefaultContext();
+
 /// \brief If True then coord transform will be omited on failure.
 /// Otherwise invalid transformation will be given.
 /// Default value is False
@@ -3,6 +3,7 @@
 
 #include "h5enum.h"
 
+#include <algorithm>
 #include <type_traits>
 #include <string>
 #include <vector>
@@ -20,7 +21,7 @@
 #include <h5gt/H5DataSpace.hpp>
 #include <h5gt/H5Attribute.hpp>
 
-#include <units/units.hpp>
+#include "h5units.h"
 
 
 namespace h5geo
@@ -55,22 +56,20 @@ inline bool _overwriteResizableDataset(
     return false;
   }
 
-  if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::unit_from_string(unitsTo));
-    for(size_t i = 0; i < nH5Rows*nH5Cols; i++)
-      M[i] *= coef;
-  }
+  double coef = 1;
+  if (!unitsFrom.empty() && !unitsTo.empty())
+    coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
 
   try {
     std::vector<size_t> dims = {nH5Rows, nH5Cols};
     dset.resize(dims);
-    dset.write_raw(M);
-    return true;
   } catch (h5gt::Exception e) {
     return false;
   }
+
+  // `M` isn't modified
+  return h5geo::writeScaledHyperslab(
+        dset, {0, 0}, {nH5Rows, nH5Cols}, M, coef);
 }
 
 template<typename Object, typename D,
@@ -154,16 +153,14 @@ inline bool _overwriteDataset(
         datasetPath, h5gt::DataSpace({nH5Rows, nH5Cols}));
   }
 
-  if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::unit_from_string(unitsTo));
-    for(size_t i = 0; i < nH5Rows*nH5Cols; i++)
-      M[i] *= coef;
-  }
+  double coef = 1;
+  if (!unitsFrom.empty() && !unitsTo.empty())
+    coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
 
-  node.getDataSet(datasetPath).write_raw(M);
-  return true;
+  // `M` isn't modified
+  h5gt::DataSet dset = node.getDataSet(datasetPath);
+  return h5geo::writeScaledHyperslab(
+        dset, {0, 0}, {nH5Rows, nH5Cols}, M, coef);
 }
 
 
@@ -243,9 +240,7 @@ inline bool _readDataset(
   dset.read(M);
 
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::unit_from_string(unitsTo));
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
     for(size_t i = 0; i < nElem; i++)
       M[i] *= coef;
   }
@@ -342,9 +337,7 @@ inline bool _readAttribute(
   attr.read(v);
 
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::unit_from_string(unitsTo));
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
     for(size_t i = 0; i < nElem; i++)
       v[i] *= coef;
   }
@@ -530,9 +523,7 @@ inline bool _overwriteAttribute(
   }
 
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::unit_from_string(unitsTo));
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
     for(size_t i = 0; i < nElem; i++)
       v[i] *= coef;
   }
@@ -834,8 +825,12 @@ inline bool writeDataToIndexedDataset(
     return false;
 
   if (resize == true  &&
-      dims[1] != v.size())
+      dims[1] != v.size()){
+    // compact and contiguous datasets have fixed size
+    if (!dataset.getCreateProps().isChunked())
+      return false;
     dataset.resize({dims[0], size_t(v.size())});
+  }
 
   try {
     dataset.select({size_t(ind), 0}, {1, size_t(v.size())}).
@@ -871,6 +866,64 @@ inline Eigen::VectorX<T> getDataFromIndexedDataset(
   return v;
 }
 
+template<typename T>
+inline bool writeScaledHyperslab(
+    h5gt::DataSet& dataset,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    const T* data,
+    double coef,
+    size_t bufferSize)
+{
+  if (count.empty() || offset.size() != count.size())
+    return false;
+
+  // split along the first dimension whose count isn't 1:
+  // then every part is a contiguous piece of `data`
+  size_t d = 0;
+  while (d+1 < count.size() && count[d] == 1)
+    d++;
+
+  size_t nInner = 1;
+  for (size_t i = d+1; i < count.size(); i++)
+    nInner *= count[i];
+
+  if (count[d] == 0 || nInner == 0)
+    return true;
+
+  try {
+    if (coef == 1){
+      dataset.select(offset, count).write_raw(data);
+      return true;
+    }
+  } catch (h5gt::Exception e) {
+    return false;
+  }
+
+  size_t nOuterMax = std::max<size_t>(1, bufferSize / nInner);
+  nOuterMax = std::min(nOuterMax, count[d]);
+  Eigen::VectorX<T> buf(nOuterMax*nInner);
+  std::vector<size_t> partOffset(offset);
+  std::vector<size_t> partCount(count);
+  try {
+    for (size_t i = 0; i < count[d]; i += nOuterMax){
+      partCount[d] = std::min(nOuterMax, count[d]-i);
+      partOffset[d] = offset[d]+i;
+      size_t n = partCount[d]*nInner;
+      Eigen::Map<const Eigen::VectorX<T>> part(data + i*nInner, n);
+      if constexpr (std::is_floating_point<T>::value)
+        buf.head(n) = part*T(coef);
+      else
+        buf.head(n) = (part.template cast<double>()*coef).template cast<T>();
+      dataset.select(partOffset, partCount).write_raw(buf.data());
+    }
+  } catch (h5gt::Exception e) {
+    return false;
+  }
+
+  return true;
+}
+
 // UTIL
 
 template<typename Object,
@@ -50,6 +50,20 @@ public:
       const std::string& units = "",
       bool doCoordTransform = false) override;
 
+  virtual std::shared_ptr<const h5geo::Trajectory> getTrajectory(
+      const std::string& lengthUnits = "",
+      double resampleStep = 0,
+      bool doCoordTransform = false) override;
+  virtual Eigen::MatrixXd mdToXYTvd(
+      const Eigen::Ref<const Eigen::VectorXd>& md,
+      const std::string& lengthUnits = "",
+      bool minCurvature = true,
+      bool doCoordTransform = false) override;
+  virtual Eigen::VectorXd tvdToMd(
+      const Eigen::Ref<const Eigen::VectorXd>& tvd,
+      const std::string& lengthUnits = "",
+      bool minCurvature = true) override;
+
   virtual std::string getRelativeName() override;
 
   virtual H5DevCurveParam getParam() override;
@@ -73,6 +87,9 @@ protected:
       const std::string& name,
       Eigen::Ref<Eigen::VectorXd> v,
       const std::string& units = "");
+
+  /// \brief Drop cached trajectories of all dev curves within the well
+  static void invalidateTrajectories(const h5gt::Group& wellG);
 };
 
 #endif // H5DEVCURVEIMPL_H
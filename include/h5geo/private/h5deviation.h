@@ -1,13 +1,16 @@
 #ifndef H5DEVIATION_H
 #define H5DEVIATION_H
 
+#include "h5geo_export.h"
 #include "../private/h5enum.h"
 
 #define _USE_MATH_DEFINES   // should be before <cmath>, include 'pi' val
 
 #include <math.h>
+#include <numeric>
+#include <vector>
 #include <Eigen/Dense>
-#include <units/units.hpp>
+#include "h5units.h"
 
 namespace h5geo
 {
@@ -57,6 +60,27 @@ Eigen::MatrixX<typename D::Scalar> traj2ALL(
     const h5geo::TrajectoryFormat& trajFormat,
     const bool& XNorth);
 
+/// \brief Batched h5geo::traj2ALL() for many wells
+///
+/// Wells are converted in parallel (when built with `H5GEO_USE_THREADS`)
+/// and angular units are parsed once per batch rather than once per well.
+/// \param M trajectory of each well (3 columns according to `trajFormat`)
+/// \param x0 well head `X` of each well
+/// \param y0 well head `Y` of each well
+/// \param kb `KB` of each well
+/// \return `MD_X_Y_Z_TVD_DX_DY_AZ_INCL` of each well
+/// (empty matrix for a well with wrong input), empty vector if
+/// sizes mismatch or units can't be converted
+H5GEO_EXPORT std::vector<Eigen::MatrixXd> traj2ALL(
+    const std::vector<Eigen::MatrixXd>& M,
+    const Eigen::Ref<const Eigen::VectorXd>& x0,
+    const Eigen::Ref<const Eigen::VectorXd>& y0,
+    const Eigen::Ref<const Eigen::VectorXd>& kb,
+    const std::string& angularUnitsFrom,
+    const std::string& angularUnitsTo,
+    const h5geo::TrajectoryFormat& trajFormat,
+    const bool& XNorth);
+
 /* */
 template<typename D>
 Eigen::MatrixX<typename D::Scalar> MdAzIncl2MdXYTvd(
@@ -130,9 +154,7 @@ inline double _betaAngle(
     const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     I1 *= coef;
     I2 *= coef;
     A1 *= coef;
@@ -146,9 +168,7 @@ inline double _betaAngle(
 inline double _ratioFactor(double B, const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     B *= coef;
   }
 
@@ -169,9 +189,7 @@ inline double _deltaEast(
     const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     I1 *= coef;
     I2 *= coef;
     A1 *= coef;
@@ -192,9 +210,7 @@ inline double _deltaNorth(
     const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     I1 *= coef;
     I2 *= coef;
     A1 *= coef;
@@ -213,9 +229,7 @@ inline double _deltaZ(
     const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     I1 *= coef;
     I2 *= coef;
   }
@@ -234,9 +248,7 @@ inline double _dMDFromDeltaEast(
     const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     I1 *= coef;
     I2 *= coef;
     A1 *= coef;
@@ -257,9 +269,7 @@ inline double _dMDFromDeltaNorth(
     const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     I1 *= coef;
     I2 *= coef;
     A1 *= coef;
@@ -278,9 +288,7 @@ inline double _dMDFromDeltaZ(
     const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     I1 *= coef;
     I2 *= coef;
   }
@@ -296,9 +304,7 @@ inline double _fa(
     const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     a *= coef;
   }
 
@@ -313,9 +319,7 @@ inline double _dfa(
     const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     a *= coef;
   }
 
@@ -329,15 +333,29 @@ inline double _ddfa(
     const std::string& angularUnits)
 {
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    double coef = h5geo::getConversionFactor(angularUnits, "radian");
     a *= coef;
   }
 
   return arc*sin(a/2)/2;
 }
 
+
+template<typename T>
+/// \brief Ratio factors (see h5geo::_ratioFactor()) from cosines of dogleg angles
+///
+/// Cosine of dogleg angle is the dot product of station tangents,
+/// thus no trigonometry is needed per pair of stations.
+inline Eigen::ArrayX<T> _ratioFactorsFromCos(const Eigen::ArrayX<T>& cosB)
+{
+  Eigen::ArrayX<T> c = cosB.max(T(-1)).min(T(1));
+  Eigen::ArrayX<T> B = c.acos();
+  // tan(B/2) = sqrt((1-cos(B))/(1+cos(B)))
+  return (B == T(0)).select(
+        Eigen::ArrayX<T>::Ones(B.size()),
+        2 / B * ((1 - c) / (1 + c)).sqrt());
+}
+
 };
 
 
@@ -368,9 +386,7 @@ Eigen::MatrixX<typename D::Scalar> h5geo::MdAzIncl2ALL(
   M_OUT.col(6) = M_MdXYTvd.col(2).array() - y0; // DY
 
   if (!angularUnitsTo.empty()){
-    double coef = units::convert(
-          units::unit_from_string(angularUnitsFrom),
-          units::unit_from_string(angularUnitsTo));
+    double coef = h5geo::getConversionFactor(angularUnitsFrom, angularUnitsTo);
     M_OUT.col(7) = M.col(1)*coef; // AZ
     M_OUT.col(8) = M.col(2)*coef; // INCL
   } else {
@@ -522,53 +538,52 @@ Eigen::MatrixX<typename D::Scalar> h5geo::MdAzIncl2MdXYTvd(
 
   double coef = 1;
   if (!angularUnits.empty()){
-    coef = units::convert(
-          units::unit_from_string(angularUnits),
-          units::unit_from_string("radian"));
+    coef = h5geo::getConversionFactor(angularUnits, "radian");
   }
 
-  Eigen::MatrixX<typename D::Scalar> M_OUT(M.rows(), 4);
-  M_OUT.col(0) = M.col(0);
-  typename D::Scalar I1, I2, A1, A2, dMD, B, RF, dx, dy, dz;
-
-  for (size_t i = 0; i < M.rows(); i++){
-    if (i == 0){
-      A1 = M(0, 1) * coef;
-      A2 = M(0, 1) * coef;
-      I1 = M(0, 2) * coef;
-      I2 = M(0, 2) * coef;
-      dMD = M(0, 0);
-    } else {
-      A1 = M(i, 1) * coef;
-      A2 = M(i-1, 1) * coef;
-      I1 = M(i, 2) * coef;
-      I2 = M(i-1, 2) * coef;
-      dMD = M(i, 0) - M(i-1, 0);
-    }
-
-    B = _betaAngle(I1, I2, A1, A2, "");
-    RF = _ratioFactor(B, "");
+  using T = typename D::Scalar;
+  Eigen::Index n = M.rows();
+  Eigen::MatrixX<T> M_OUT(n, 4);
+  if (n < 1)
+    return M_OUT;
 
-    if (XNorth){
-      dx = _deltaNorth(dMD, I1, I2, A1, A2, RF, "");
-      dy = _deltaEast(dMD, I1, I2, A1, A2, RF, "");
-    } else {
-      dx = _deltaEast(dMD, I1, I2, A1, A2, RF, "");
-      dy = _deltaNorth(dMD, I1, I2, A1, A2, RF, "");
-    }
-
-    dz = _deltaZ(dMD, I1, I2, RF, "");
+  M_OUT.col(0) = M.col(0);
 
-    if (i == 0){
-      M_OUT(0, 1) = x0 + dx;
-      M_OUT(0, 2) = y0 + dy;
-      M_OUT(0, 3) = dz;
-    } else {
-      M_OUT(i, 1) = M_OUT(i-1, 1) + dx;
-      M_OUT(i, 2) = M_OUT(i-1, 2) + dy;
-      M_OUT(i, 3) = M_OUT(i-1, 3) + dz;
-    }
-  }
+  // each angle's sin/cos is evaluated once on contiguous arrays
+  // (vectorized by Eigen); station `i` is joined with station `i-1`
+  // and the first station - with itself
+  Eigen::ArrayX<T> A = M.col(1) * T(coef);
+  Eigen::ArrayX<T> I = M.col(2) * T(coef);
+  Eigen::ArrayX<T> sinI = I.sin();
+  Eigen::ArrayX<T> tEast = sinI * A.sin();
+  Eigen::ArrayX<T> tNorth = sinI * A.cos();
+  Eigen::ArrayX<T> tZ = I.cos();
+
+  Eigen::ArrayX<T> dMD(n), cosB(n);
+  dMD(0) = M(0, 0);
+  cosB(0) = 1;
+  dMD.tail(n-1) = M.col(0).tail(n-1) - M.col(0).head(n-1);
+  cosB.tail(n-1) =
+      tEast.tail(n-1)*tEast.head(n-1) +
+      tNorth.tail(n-1)*tNorth.head(n-1) +
+      tZ.tail(n-1)*tZ.head(n-1);
+
+  Eigen::ArrayX<T> h = dMD / 2 * _ratioFactorsFromCos(cosB);
+  Eigen::ArrayX<T> dEast(n), dNorth(n), dz(n);
+  dEast(0) = h(0) * 2 * tEast(0);
+  dNorth(0) = h(0) * 2 * tNorth(0);
+  dz(0) = h(0) * 2 * tZ(0);
+  dEast.tail(n-1) = h.tail(n-1) * (tEast.tail(n-1) + tEast.head(n-1));
+  dNorth.tail(n-1) = h.tail(n-1) * (tNorth.tail(n-1) + tNorth.head(n-1));
+  dz.tail(n-1) = h.tail(n-1) * (tZ.tail(n-1) + tZ.head(n-1));
+
+  Eigen::ArrayX<T>& dx = XNorth ? dNorth : dEast;
+  Eigen::ArrayX<T>& dy = XNorth ? dEast : dNorth;
+  dx(0) += x0;
+  dy(0) += y0;
+  std::partial_sum(dx.data(), dx.data() + n, M_OUT.col(1).data());
+  std::partial_sum(dy.data(), dy.data() + n, M_OUT.col(2).data());
+  std::partial_sum(dz.data(), dz.data() + n, M_OUT.col(3).data());
   return M_OUT;
 }
 
@@ -684,58 +699,50 @@ Eigen::MatrixX<typename D::Scalar> h5geo::TvdDxDy2MdAzIncl(
   if (M.cols() != 3)
     return Eigen::MatrixX<typename D::Scalar>();
 
-  Eigen::MatrixX<typename D::Scalar> M_OUT(M.rows(), 3);
-  typename D::Scalar I1, I2, A1, A2, dMD, B, RF, dx, dy, dz;
-
-  for (size_t i = 0; i < M.rows(); i++){
-    if (i == 0){
-      dx = M(0, 1);
-      dy = M(0, 2);
-      dz = M(0, 0);
-
-      if (XNorth){
-        A1 = atan2(dy, dx);
-      } else {
-        A1 = atan2(dx, dy);
-      }
-
-      A2 = A1;
-      I1 = atan2(sqrt(pow(dx,2)+pow(dy,2)), dz);
-      I2 = I1;
-    } else {
-      dx = M(i, 1) - M(i-1, 1);
-      dy = M(i, 2) - M(i-1, 2);
-      dz = M(i, 0) - M(i-1, 0);
-      A1 = M_OUT(i-1, 1);
-
-      if (XNorth){
-        A2 = atan2(dy, dx);
-      } else {
-        A2 = atan2(dx, dy);
-      }
-
-      I1 = M_OUT(i-1, 2);
-      I2 = atan2(sqrt(pow(dx,2)+pow(dy,2)), dz);
-    }
-
-    B = _betaAngle(I1, I2, A1, A2, "");
-    RF = _ratioFactor(B, "");
-
-    dMD = _dMDFromDeltaZ(dz, I1, I2, RF, "");
-
-    if (i == 0)
-      M_OUT(0, 0) = dMD;
-    else
-      M_OUT(i, 0) = M_OUT(i-1, 0) + dMD;
-
-    M_OUT(i, 1) = A2;
-    M_OUT(i, 2) = I2;
-  }
+  using T = typename D::Scalar;
+  Eigen::Index n = M.rows();
+  Eigen::MatrixX<T> M_OUT(n, 3);
+  if (n < 1)
+    return M_OUT;
+
+  // increments between station `i` and `i-1` (the first one - from the origin)
+  Eigen::ArrayX<T> dz(n), dx(n), dy(n);
+  dz(0) = M(0, 0);
+  dx(0) = M(0, 1);
+  dy(0) = M(0, 2);
+  dz.tail(n-1) = M.col(0).tail(n-1) - M.col(0).head(n-1);
+  dx.tail(n-1) = M.col(1).tail(n-1) - M.col(1).head(n-1);
+  dy.tail(n-1) = M.col(2).tail(n-1) - M.col(2).head(n-1);
+
+  // station direction is the direction of its own increment thus the
+  // previous station's direction is just shifted array and cosine of
+  // dogleg angle is the dot product of adjoint unit increments
+  Eigen::ArrayX<T> len = (dx.square() + dy.square() + dz.square()).sqrt();
+  // zero increment: azimuth and inclination are zero (pointing down)
+  Eigen::ArrayX<T> uz = (len > T(0)).select(dz / len, T(1));
+  Eigen::ArrayX<T> ux = (len > T(0)).select(dx / len, T(0));
+  Eigen::ArrayX<T> uy = (len > T(0)).select(dy / len, T(0));
+
+  Eigen::ArrayX<T> cosB(n), cosISum(n);
+  cosB(0) = 1;
+  cosISum(0) = 2 * uz(0);
+  cosB.tail(n-1) =
+      ux.tail(n-1)*ux.head(n-1) +
+      uy.tail(n-1)*uy.head(n-1) +
+      uz.tail(n-1)*uz.head(n-1);
+  cosISum.tail(n-1) = uz.tail(n-1) + uz.head(n-1);
+
+  Eigen::ArrayX<T> dMD = 2*dz / (cosISum*_ratioFactorsFromCos(cosB));
+
+  auto atan2Op = [](T a, T b){ return T(std::atan2(a, b)); };
+  M_OUT.col(1) = XNorth ?
+        dy.binaryExpr(dx, atan2Op) : dx.binaryExpr(dy, atan2Op);
+  M_OUT.col(2) =
+      (dx.square() + dy.square()).sqrt().binaryExpr(dz, atan2Op);
+  std::partial_sum(dMD.data(), dMD.data() + n, M_OUT.col(0).data());
 
   if (!angularUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string("radian"),
-          units::unit_from_string(angularUnits));
+    double coef = h5geo::getConversionFactor("radian", angularUnits);
     M_OUT.col(1) = M_OUT.col(1).array() * coef;
     M_OUT.col(2) = M_OUT.col(2).array() * coef;
   }
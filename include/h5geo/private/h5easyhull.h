@@ -7,6 +7,7 @@
 // duplicate or collinear points.
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <vector>
 
@@ -304,33 +305,45 @@ void quickHull2D(
 
   Eigen::Vector2<T> f = v.row(_getFarthestInd(a, b, v));
 
-  // Collect points to the left of segment (a, f)
-  Eigen::MatrixX2<T> left(v.rows(), 2);
+  // Collect points to the left of segment (a, f).
+  // Points are counted first: allocating `v.rows()` at each
+  // recursion level makes peak memory grow with the depth
   ptrdiff_t il = 0;
-  for (ptrdiff_t i = 0; i < v.rows(); i++){
-    if (_ccw(a, f, v.row(i)) > 0) {
-      left.row(il) = v.row(i);
-      il++;
+  for (ptrdiff_t i = 0; i < v.rows(); i++)
+    il += _ccw(a, f, v.row(i)) > 0;
+
+  if (il > 0){
+    Eigen::MatrixX2<T> left(il, 2);
+    il = 0;
+    for (ptrdiff_t i = 0; i < v.rows(); i++){
+      if (_ccw(a, f, v.row(i)) > 0) {
+        left.row(il) = v.row(i);
+        il++;
+      }
     }
+    quickHull2D(left, a, f, hull, ih);
   }
-  left.conservativeResize(il, 2);
-  quickHull2D(left, a, f, hull, ih);
 
   // Add f to the hull
   hull.row(ih) = f;
   ih++;
 
   // Collect points to the left of segment (f, b)
-  Eigen::MatrixX2<T> right(v.rows(), 2);
   ptrdiff_t ir = 0;
-  for (ptrdiff_t i = 0; i < v.rows(); i++){
-    if (_ccw(f, b, v.row(i)) > 0) {
-      right.row(ir) = v.row(i);
-      ir++;
+  for (ptrdiff_t i = 0; i < v.rows(); i++)
+    ir += _ccw(f, b, v.row(i)) > 0;
+
+  if (ir > 0){
+    Eigen::MatrixX2<T> right(ir, 2);
+    ir = 0;
+    for (ptrdiff_t i = 0; i < v.rows(); i++){
+      if (_ccw(f, b, v.row(i)) > 0) {
+        right.row(ir) = v.row(i);
+        ir++;
+      }
     }
+    quickHull2D(right, f, b, hull, ih);
   }
-  right.conservativeResize(ir, 2);
-  quickHull2D(right, f, b, hull, ih);
 };
 
 /// \brief quickHull2D Quick Hull 2D algorithm https://en.wikipedia.org/wiki/quickHull.
@@ -340,6 +353,9 @@ template<typename T>
 Eigen::MatrixX2<T> quickHull2D(
     const Eigen::MatrixX2<T>& v)
 {
+  if (v.rows() < 1)
+    return Eigen::MatrixX2<T>();
+
   // initialize original index locations
   Eigen::VectorX<ptrdiff_t> idx =
       Eigen::ArrayX<ptrdiff_t>::LinSpaced(
@@ -372,15 +388,17 @@ Eigen::MatrixX2<T> quickHull2D(
       _isLeftOf<T>);
 
   // Split the points on either side of segment (a, b)
+  // (points on the segment can't be hull vertices)
   Eigen::MatrixX2<T> left(v.rows(), 2);
   Eigen::MatrixX2<T> right(v.rows(), 2);
   ptrdiff_t il = 0;
   ptrdiff_t ir = 0;
   for (ptrdiff_t i = 0; i < v.rows(); i++){
-    if (_ccw(a, b, v.row(i)) > 0){
+    T ccw = _ccw(a, b, v.row(i));
+    if (ccw > 0){
       left.row(il) = v.row(i);
       il++;
-    } else {
+    } else if (ccw < 0) {
       right.row(ir) = v.row(i);
       ir++;
     }
@@ -389,7 +407,9 @@ Eigen::MatrixX2<T> quickHull2D(
   right.conservativeResize(ir, 2);
 
 
-  Eigen::MatrixX2<T> hull(v.rows(), 2);
+  // all points may lie on the hull and the first one is repeated
+  // (or `a` and `b` coincide)
+  Eigen::MatrixX2<T> hull(v.rows()+2, 2);
   ptrdiff_t ih = 0;
 
   // Be careful to add points to the hull
@@ -416,6 +436,285 @@ Eigen::MatrixX2<T> quickHull2D(
   return hull;
 }
 
+/// \brief aklToussaint Akl-Toussaint heuristic: remove points that lie strictly
+/// inside the octagon of extreme points (min/max of `x`, `y`, `x+y`, `x-y`).
+/// Such points can't belong to the convex hull.
+/// Non-finite points are removed as well.
+/// \param v
+/// \return
+template<typename T>
+Eigen::MatrixX2<T> aklToussaint(
+    const Eigen::MatrixX2<T>& v)
+{
+  // extremes in counter clockwise order: W, SW, S, SE, E, NE, N, NW
+  ptrdiff_t ext[8];
+  ptrdiff_t i0 = 0;
+  while (i0 < v.rows() && !(std::isfinite(v(i0,0)) && std::isfinite(v(i0,1))))
+    i0++;
+  if (i0 >= v.rows())
+    return Eigen::MatrixX2<T>();
+
+  std::fill(ext, ext+8, i0);
+  for (ptrdiff_t i = i0+1; i < v.rows(); i++){
+    T x = v(i,0), y = v(i,1);
+    if (!std::isfinite(x) || !std::isfinite(y))
+      continue;
+    if (x < v(ext[0],0)) ext[0] = i;
+    if (x+y < v(ext[1],0)+v(ext[1],1)) ext[1] = i;
+    if (y < v(ext[2],1)) ext[2] = i;
+    if (x-y > v(ext[3],0)-v(ext[3],1)) ext[3] = i;
+    if (x > v(ext[4],0)) ext[4] = i;
+    if (x+y > v(ext[5],0)+v(ext[5],1)) ext[5] = i;
+    if (y > v(ext[6],1)) ext[6] = i;
+    if (x-y < v(ext[7],0)-v(ext[7],1)) ext[7] = i;
+  }
+
+  std::vector<Eigen::Vector2<T>> poly;
+  for (size_t k = 0; k < 8; k++){
+    Eigen::Vector2<T> p = v.row(ext[k]);
+    if (poly.empty() || poly.back() != p)
+      poly.push_back(p);
+  }
+  while (poly.size() > 1 && poly.back() == poly.front())
+    poly.pop_back();
+
+  // edges as half-planes: `p` is strictly inside if `nx*x + ny*y > c` for all edges
+  size_t nEdges = poly.size() > 2 ? poly.size() : 0;
+  std::vector<T> ex(nEdges), ey(nEdges), ec(nEdges);
+  for (size_t k = 0; k < nEdges; k++){
+    const Eigen::Vector2<T>& a = poly[k];
+    const Eigen::Vector2<T>& b = poly[(k+1) % nEdges];
+    ex[k] = a.y() - b.y();
+    ey[k] = b.x() - a.x();
+    ec[k] = ex[k]*a.x() + ey[k]*a.y();
+  }
+
+  Eigen::MatrixX2<T> out(v.rows() - i0, 2);
+  ptrdiff_t n = 0;
+  for (ptrdiff_t i = i0; i < v.rows(); i++){
+    T x = v(i,0), y = v(i,1);
+    if (!std::isfinite(x) || !std::isfinite(y))
+      continue;
+    // degenerate octagon (less than three vertices) has no interior
+    bool inside = nEdges > 0;
+    for (size_t k = 0; k < nEdges && inside; k++)
+      inside = ex[k]*x + ey[k]*y > ec[k];
+    if (!inside){
+      out(n,0) = x;
+      out(n,1) = y;
+      n++;
+    }
+  }
+  out.conservativeResize(n, 2);
+  return out;
+}
+
+/// \brief convexHull2D Chunked parallel convex hull.
+///
+/// Points are split into chunks of `chunkSize` rows. Hulls of the chunks are
+/// calculated in parallel (Akl-Toussaint filter followed by quickHull2D) and
+/// merged at the end. Non-finite points are skipped.
+/// Closed hull is returned (see quickHull2D()).
+/// \param v
+/// \param chunkSize
+/// \return
+template<typename T>
+Eigen::MatrixX2<T> convexHull2D(
+    const Eigen::MatrixX2<T>& v,
+    ptrdiff_t chunkSize = 1 << 16)
+{
+  if (v.rows() < 1)
+    return Eigen::MatrixX2<T>();
+
+  chunkSize = std::max<ptrdiff_t>(chunkSize, 3);
+  ptrdiff_t nChunks = (v.rows() + chunkSize - 1) / chunkSize;
+  std::vector<Eigen::MatrixX2<T>> hulls(nChunks);
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (ptrdiff_t c = 0; c < nChunks; c++){
+    ptrdiff_t from = c*chunkSize;
+    ptrdiff_t n = std::min(chunkSize, ptrdiff_t(v.rows()) - from);
+    Eigen::MatrixX2<T> filtered = aklToussaint<T>(v.middleRows(from, n));
+    hulls[c] = quickHull2D(filtered);
+  }
+
+  // chunk hulls are closed: skip repeated last point
+  ptrdiff_t nMerged = 0;
+  for (const auto& h : hulls)
+    nMerged += std::max<ptrdiff_t>(h.rows()-1, 0);
+
+  Eigen::MatrixX2<T> merged(nMerged, 2);
+  nMerged = 0;
+  for (const auto& h : hulls){
+    if (h.rows() < 2)
+      continue;
+    merged.middleRows(nMerged, h.rows()-1) = h.topRows(h.rows()-1);
+    nMerged += h.rows()-1;
+  }
+
+  if (nChunks == 1)
+    return hulls[0];
+
+  return quickHull2D(merged);
+}
+
+/// \class ConcaveBoundaryEstimator
+/// \brief Streaming concave boundary of points.
+///
+/// Points are accumulated in regular grid with `cellSize` cells that
+/// keep only one point: the farthest from the center of the extent.
+/// Boundary goes through points of the outer cells of the 8-connected
+/// region of occupied cells that contains the lowest left cell
+/// (Moore neighbor tracing). Thus concavities narrower than `cellSize`
+/// are not resolved and holes are ignored. \n
+/// Memory doesn't depend on number of points: cell size is increased
+/// when the grid exceeds `maxCells`.
+template<typename T>
+class ConcaveBoundaryEstimator
+{
+public:
+  /// \param xMin extent of points
+  /// \param yMin extent of points
+  /// \param xMax extent of points
+  /// \param yMax extent of points
+  /// \param cellSize size of the grid cell (`0` means 1/64 of the extent)
+  /// \param maxCells max number of cells
+  ConcaveBoundaryEstimator(
+      T xMin, T yMin, T xMax, T yMax,
+      T cellSize = 0,
+      size_t maxCells = size_t(1) << 22) :
+    x0(xMin), y0(yMin)
+  {
+    T w = std::max(xMax - xMin, T(0));
+    T h = std::max(yMax - yMin, T(0));
+    cx = xMin + w/2;
+    cy = yMin + h/2;
+    if (!(cellSize > 0))
+      cellSize = std::max(w, h) / 64;
+    if (!(cellSize > 0))
+      cellSize = 1;
+
+    maxCells = std::max<size_t>(maxCells, 1);
+    for (;;){
+      nx = size_t(std::floor(w / cellSize)) + 1;
+      ny = size_t(std::floor(h / cellSize)) + 1;
+      if (nx*ny <= maxCells)
+        break;
+      cellSize *= std::sqrt(T(nx*ny) / T(maxCells)) * T(1.01);
+    }
+    cell = cellSize;
+    pts.resize(nx*ny, 2);
+    score = Eigen::VectorX<T>::Constant(nx*ny, T(-1));
+  }
+
+  /// \brief Add points (non-finite ones are skipped)
+  void add(const Eigen::Ref<const Eigen::MatrixX2<T>>& v){
+    for (ptrdiff_t i = 0; i < v.rows(); i++){
+      T x = v(i,0), y = v(i,1);
+      if (!std::isfinite(x) || !std::isfinite(y))
+        continue;
+      ptrdiff_t ix = std::clamp<ptrdiff_t>(ptrdiff_t(std::floor((x - x0) / cell)), 0, nx-1);
+      ptrdiff_t iy = std::clamp<ptrdiff_t>(ptrdiff_t(std::floor((y - y0) / cell)), 0, ny-1);
+      size_t ind = iy*nx + ix;
+      T d = (x-cx)*(x-cx) + (y-cy)*(y-cy);
+      if (d > score(ind)){
+        score(ind) = d;
+        pts(ind,0) = x;
+        pts(ind,1) = y;
+      }
+    }
+  }
+
+  /// \brief Cell size that is actually used
+  T getCellSize() const {
+    return cell;
+  }
+
+  /// \brief Closed counter clockwise boundary (empty if no points were added)
+  Eigen::MatrixX2<T> getBoundary() const {
+    // lowest left occupied cell is on the outer boundary
+    ptrdiff_t start = -1;
+    for (ptrdiff_t i = 0; i < score.size(); i++){
+      if (score(i) >= 0){
+        start = i;
+        break;
+      }
+    }
+    if (start < 0)
+      return Eigen::MatrixX2<T>();
+
+    // E, NE, N, NW, W, SW, S, SE
+    const ptrdiff_t dx[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+    const ptrdiff_t dy[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+    auto isOccupied = [this](ptrdiff_t ix, ptrdiff_t iy){
+      return ix >= 0 && iy >= 0 &&
+          ix < ptrdiff_t(nx) && iy < ptrdiff_t(ny) &&
+          score(iy*nx + ix) >= 0;
+    };
+
+    std::vector<ptrdiff_t> cells{start};
+    ptrdiff_t cur = start;
+    // direction to the last visited empty cell (below the start cell is empty)
+    int back = 6;
+    ptrdiff_t second = -1;
+    for (size_t iter = 0; iter < 4*size_t(score.size()) + 8; iter++){
+      ptrdiff_t ix = cur % nx, iy = cur / nx;
+      int d = -1;
+      for (int k = 1; k <= 8; k++){
+        int dir = (back + k) % 8;
+        if (isOccupied(ix + dx[dir], iy + dy[dir])){
+          d = dir;
+          break;
+        }
+      }
+      // isolated cell
+      if (d < 0)
+        break;
+
+      ptrdiff_t next = (iy + dy[d])*nx + ix + dx[d];
+      if (cur == start && next == second)
+        break;
+      if (second < 0)
+        second = next;
+
+      // empty cell checked before `d` seen from the `next` cell
+      int prev = (d + 7) % 8;
+      ptrdiff_t ex = ix + dx[prev] - (ix + dx[d]);
+      ptrdiff_t ey = iy + dy[prev] - (iy + dy[d]);
+      for (int k = 0; k < 8; k++)
+        if (dx[k] == ex && dy[k] == ey)
+          back = k;
+
+      cells.push_back(next);
+      cur = next;
+    }
+
+    // the first cell is repeated thus the boundary is closed
+    Eigen::MatrixX2<T> boundary(cells.size(), 2);
+    ptrdiff_t n = 0;
+    for (ptrdiff_t c : cells){
+      if (n > 0 && boundary.row(n-1) == pts.row(c))
+        continue;
+      boundary.row(n) = pts.row(c);
+      n++;
+    }
+    if (n > 0 && boundary.row(n-1) != boundary.row(0)){
+      boundary.conservativeResize(n+1, 2);
+      boundary.row(n) = boundary.row(0);
+      n++;
+    }
+    boundary.conservativeResize(n, 2);
+    return boundary;
+  }
+
+private:
+  Eigen::MatrixX2<T> pts;
+  Eigen::VectorX<T> score;
+  T x0, y0, cx, cy, cell;
+  size_t nx, ny;
+};
+
 }
 
 
@@ -99,14 +99,16 @@ inline h5gt::EnumType<SeisDatasetsUType> create_enum_SeisDatasets() {
 enum class SeisGroups : unsigned{
   sort = 1,
   indexes = 2,
-  unique_values = 3
+  unique_values = 3,
+  composite = 4
 };
 
 typedef std::underlying_type<SeisGroups>::type SeisGroupsUType;
 inline h5gt::EnumType<SeisGroupsUType> create_enum_SeisGroups() {
   return {{"sort", static_cast<SeisGroupsUType>(SeisGroups::sort)},
           {"indexes", static_cast<SeisGroupsUType>(SeisGroups::indexes)},
-          {"unique_values", static_cast<SeisGroupsUType>(SeisGroups::unique_values)}};
+          {"unique_values", static_cast<SeisGroupsUType>(SeisGroups::unique_values)},
+          {"composite", static_cast<SeisGroupsUType>(SeisGroups::composite)}};
 }
 
 enum class SeisSEGYGroups : unsigned{
@@ -511,6 +513,36 @@ inline h5gt::EnumType<DelimiterUType> create_enum_Delimiter() {
           {"COMMA", static_cast<DelimiterUType>(Delimiter::COMMA)}};
 }
 
+enum class WindowAttribute : unsigned{
+  RMS = 1,
+  MEAN = 2,
+  MAX = 3,
+  MIN = 4,
+  MAX_ABS = 5
+};
+
+typedef std::underlying_type<WindowAttribute>::type WindowAttributeUType;
+inline h5gt::EnumType<WindowAttributeUType> create_enum_WindowAttribute() {
+  return {{"RMS", static_cast<WindowAttributeUType>(WindowAttribute::RMS)},
+          {"MEAN", static_cast<WindowAttributeUType>(WindowAttribute::MEAN)},
+          {"MAX", static_cast<WindowAttributeUType>(WindowAttribute::MAX)},
+          {"MIN", static_cast<WindowAttributeUType>(WindowAttribute::MIN)},
+          {"MAX_ABS", static_cast<WindowAttributeUType>(WindowAttribute::MAX_ABS)}};
+}
+
+enum class BoundaryType : unsigned{
+  CONVEX = 1,
+  CONCAVE = 2,
+  LINE = 3 ///< sorted `CDP` line of 2D stack
+};
+
+typedef std::underlying_type<BoundaryType>::type BoundaryTypeUType;
+inline h5gt::EnumType<BoundaryTypeUType> create_enum_BoundaryType() {
+  return {{"CONVEX", static_cast<BoundaryTypeUType>(BoundaryType::CONVEX)},
+          {"CONCAVE", static_cast<BoundaryTypeUType>(BoundaryType::CONCAVE)},
+          {"LINE", static_cast<BoundaryTypeUType>(BoundaryType::LINE)}};
+}
+
 
 } // h5geo
 
@@ -551,6 +583,8 @@ H5GT_REGISTER_TYPE(h5geo::TrajectoryFormat, h5geo::create_enum_TrajectoryFormat)
 H5GT_REGISTER_TYPE(h5geo::CreationType, h5geo::create_enum_CreationType)
 H5GT_REGISTER_TYPE(h5geo::CaseSensitivity, h5geo::create_enum_CaseSensitivity)
 H5GT_REGISTER_TYPE(h5geo::Delimiter, h5geo::create_enum_Delimiter)
+H5GT_REGISTER_TYPE(h5geo::WindowAttribute, h5geo::create_enum_WindowAttribute)
+H5GT_REGISTER_TYPE(h5geo::BoundaryType, h5geo::create_enum_BoundaryType)
 
 
 #endif // H5CORE_ENUM_H
@@ -65,6 +65,11 @@ inline constexpr auto& seis_groups =
 inline constexpr auto sort = magic_enum::enum_name(h5geo::detail::SeisGroups::sort);
 inline constexpr auto indexes = magic_enum::enum_name(h5geo::detail::SeisGroups::indexes);
 inline constexpr auto unique_values = magic_enum::enum_name(h5geo::detail::SeisGroups::unique_values);
+inline constexpr auto composite = magic_enum::enum_name(h5geo::detail::SeisGroups::composite);
+inline constexpr auto unique_rows = "unique_rows";
+inline constexpr auto unique_rows_from_size = "unique_rows_from_size";
+inline constexpr auto trace_order = "trace_order";
+inline constexpr auto boundary = "boundary";
 inline constexpr auto& seis_segy_groups =
     magic_enum::enum_names<h5geo::detail::SeisSEGYGroups>();
 inline constexpr auto segy = magic_enum::enum_name(h5geo::detail::SeisSEGYGroups::segy);
@@ -106,6 +111,10 @@ inline constexpr auto dev_data = magic_enum::enum_name(h5geo::detail::DevDataset
 inline constexpr auto& log_dsets =
     magic_enum::enum_names<h5geo::detail::LogDatasets>();
 inline constexpr auto log_data = magic_enum::enum_name(h5geo::detail::LogDatasets::log_data);
+inline constexpr auto catalog = "h5geo_catalog";
+inline constexpr auto catalog_path = "path";
+inline constexpr auto catalog_type = "type";
+inline constexpr auto catalog_uwi = "uwi";
 
 
 
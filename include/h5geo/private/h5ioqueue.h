@@ -0,0 +1,228 @@
+#ifndef H5IOQUEUE_H
+#define H5IOQUEUE_H
+
+#include "h5geo_export.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace h5geo
+{
+
+/// \class IOQueue
+/// \brief Dedicated thread executing queued I/O tasks one by one
+///
+/// HDF5 is not thread-safe unless it is built with `threadsafe` option,
+/// thus asynchronous reads (i.e. H5Seis::getTraceAsync()) are never run
+/// in parallel: they are serialized on this single thread while the
+/// caller is free to compute. \n
+/// Batches (see IOBatch) hold HDF5Lock while running. Synchronous reads
+/// and writes of the object owning the batch wait for its pending requests
+/// (see IOBatch::wait()). Other HDF5 calls must not be made while requests
+/// are running unless HDF5 is thread-safe or the caller holds HDF5Lock.
+class H5GEO_EXPORT IOQueue
+{
+public:
+  /// \brief Process-wide queue (the thread is started on first use)
+  static IOQueue& instance();
+
+  /// \brief Put task to the end of the queue
+  void post(std::function<void()> task);
+
+  /// \brief Put task to the end of the queue and get future to its result
+  template<typename F>
+  std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& f)
+  {
+    typedef std::invoke_result_t<std::decay_t<F>> R;
+    auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(f));
+    std::future<R> fut = task->get_future();
+    post([task](){ (*task)(); });
+    return fut;
+  }
+
+  /// \brief Block until all the tasks posted before the call are done
+  void wait();
+
+  /// \brief Calling thread is the I/O thread
+  bool isIOThread() const;
+
+  IOQueue(const IOQueue&) = delete;
+  IOQueue& operator=(const IOQueue&) = delete;
+
+private:
+  IOQueue();
+  ~IOQueue();
+
+  void run();
+
+private:
+  std::mutex m;
+  std::condition_variable cv;
+  std::deque<std::function<void()>> tasks;
+  bool stop = false;
+  std::thread worker;
+};
+
+
+/// \class HDF5Lock
+/// \brief Process-wide lock owning HDF5 while in scope
+///
+/// Held by the I/O thread while IOBatch is running. Take it to call
+/// HDF5 from another thread while asynchronous requests may be running.
+class H5GEO_EXPORT HDF5Lock
+{
+public:
+  HDF5Lock() : lock(mutex()){}
+
+  HDF5Lock(const HDF5Lock&) = delete;
+  HDF5Lock& operator=(const HDF5Lock&) = delete;
+
+  static std::recursive_mutex& mutex();
+
+private:
+  std::lock_guard<std::recursive_mutex> lock;
+};
+
+
+/// \class IOBatch
+/// \brief Requests of one object waiting for the IOQueue
+///
+/// Requests enqueued while the previous ones are still waiting for
+/// the I/O thread are passed together to one call of `processor`
+/// which gives it a chance to coalesce them into fewer hyperslab reads. \n
+/// Object owning IOBatch must keep it as its last member: destructor
+/// waits for the running batch and fails requests not yet started.
+template<typename Request, typename Result>
+class IOBatch
+{
+public:
+  /// \brief Must set a value to every promise (if it throws then the
+  /// exception is passed to the promises not satisfied yet)
+  typedef std::function<void(
+      const std::vector<Request>&,
+      std::vector<std::promise<Result>>&)> Processor;
+
+  explicit IOBatch(Processor processor) :
+    state(std::make_shared<State>())
+  {
+    state->processor = std::move(processor);
+  }
+
+  ~IOBatch(){
+    close();
+  }
+
+  IOBatch(const IOBatch&) = delete;
+  IOBatch& operator=(const IOBatch&) = delete;
+
+  std::future<Result> enqueue(Request req){
+    std::promise<Result> prom;
+    std::future<Result> fut = prom.get_future();
+    std::unique_lock<std::mutex> lock(state->m);
+    if (state->closed){
+      prom.set_exception(std::make_exception_ptr(std::runtime_error(
+          "h5geo: request to closed object")));
+      return fut;
+    }
+
+    state->reqs.push_back(std::move(req));
+    state->proms.push_back(std::move(prom));
+    if (!state->scheduled){
+      state->scheduled = true;
+      lock.unlock();
+      std::shared_ptr<State> s = state;
+      IOQueue::instance().post([s](){ s->process(); });
+    }
+    return fut;
+  }
+
+  /// \brief Block until the queued and running requests are done
+  /// (does nothing on the I/O thread)
+  void wait() const {
+    if (IOQueue::instance().isIOThread())
+      return;
+
+    std::unique_lock<std::mutex> lock(state->m);
+    state->cv.wait(lock, [this](){
+      return !state->scheduled && !state->running; });
+  }
+
+  /// \brief Wait for the running batch and fail the rest of requests
+  void close(){
+    std::vector<std::promise<Result>> proms;
+    {
+      std::unique_lock<std::mutex> lock(state->m);
+      state->closed = true;
+      // processor itself may close the object
+      if (!IOQueue::instance().isIOThread())
+        state->cv.wait(lock, [this](){ return !state->running; });
+      proms.swap(state->proms);
+      state->reqs.clear();
+    }
+    for (auto& prom : proms)
+      prom.set_exception(std::make_exception_ptr(std::runtime_error(
+          "h5geo: object was closed before the request was processed")));
+  }
+
+private:
+  struct State
+  {
+    void process(){
+      HDF5Lock hdf5Lock;
+      std::vector<Request> r;
+      std::vector<std::promise<Result>> p;
+      bool run;
+      {
+        std::lock_guard<std::mutex> lock(m);
+        scheduled = false;
+        run = running = !closed;
+        r.swap(reqs);
+        p.swap(proms);
+      }
+      // `wait()` may be waiting for the batch to be unscheduled
+      if (!run){
+        cv.notify_all();
+        return;
+      }
+
+      try {
+        processor(r, p);
+      } catch (...) {
+        for (auto& prom : p){
+          try {
+            prom.set_exception(std::current_exception());
+          } catch (std::future_error&) {}
+        }
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m);
+        running = false;
+      }
+      cv.notify_all();
+    }
+
+    std::mutex m;
+    std::condition_variable cv;
+    std::vector<Request> reqs;
+    std::vector<std::promise<Result>> proms;
+    bool scheduled = false, running = false, closed = false;
+    Processor processor;
+  };
+
+  std::shared_ptr<State> state;
+};
+
+
+} // h5geo
+
+
+#endif // H5IOQUEUE_H
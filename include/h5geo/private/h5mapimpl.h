@@ -3,6 +3,7 @@
 
 #include "../h5map.h"
 #include "h5baseobjectimpl.h"
+#include "h5ioqueue.h"
 
 class H5MapImpl : public H5BaseObjectImpl<H5Map>
 {
@@ -29,6 +30,28 @@ public:
 
   virtual Eigen::MatrixXd getData(const std::string& dataUnits = "") override;
 
+  virtual bool writeData(
+      Eigen::Ref<Eigen::MatrixXd> M,
+      const size_t& iX0,
+      const size_t& iY0,
+      const std::string& dataUnits = "") override;
+
+  virtual Eigen::MatrixXd getData(
+      const size_t& iX0,
+      const size_t& iY0,
+      const size_t& nX,
+      const size_t& nY,
+      const size_t& stride = 1,
+      const std::string& dataUnits = "") override;
+
+  virtual std::future<Eigen::MatrixXd> getDataAsync(
+      const size_t& iX0,
+      const size_t& iY0,
+      const size_t& nX,
+      const size_t& nY,
+      const size_t& stride = 1,
+      const std::string& dataUnits = "") override;
+
   virtual bool setDomain(const h5geo::Domain& domain) override;
   virtual bool setOrigin(
       Eigen::Ref<Eigen::Vector2d> v,
@@ -71,6 +94,22 @@ public:
 
   virtual std::optional<h5gt::DataSet> getMapD() const override;
 
+protected:
+  struct DataRequest
+  {
+    size_t iX0, iY0, nX, nY, stride;
+    std::string dataUnits;
+  };
+
+  /// \brief Called on the I/O thread with requests queued by getDataAsync()
+  void processDataRequests(
+      const std::vector<DataRequest>& reqs,
+      std::vector<std::promise<Eigen::MatrixXd>>& proms);
+
+protected:
+  // must be the last member (waits for the I/O thread when destroyed)
+  h5geo::IOBatch<DataRequest, Eigen::MatrixXd> dataBatch;
+
   //----------- FRIEND CLASSES -----------
   friend class H5MapContainerImpl;
   friend class H5BaseObjectImpl<H5Map>;
@@ -0,0 +1,158 @@
+#ifndef H5PROFILER_H
+#define H5PROFILER_H
+
+#include "h5geo_export.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace h5geo
+{
+
+/// \struct ProfileCounter
+/// \brief Accumulated statistics of one operation (i.e. `H5Seis::readTrace`)
+struct H5GEO_EXPORT ProfileCounter
+{
+  uint64_t calls = 0; ///< number of calls
+  double seconds = 0; ///< total wall time
+  double maxSeconds = 0; ///< the longest call
+  uint64_t bytesRead = 0; ///< bytes read from HDF5 or SEGY
+  uint64_t bytesWritten = 0; ///< bytes written to HDF5 or SEGY
+  uint64_t selections = 0; ///< number of HDF5 selections (hyperslabs, point/row sets)
+  uint64_t items = 0; ///< operation specific units: traces, samples, sorted elements
+};
+
+/// \class Profiler
+/// \brief Process-wide per-operation counters and timings
+///
+/// Hot paths (trace/header/volume block I/O, SEGY decoding, sorting,
+/// unit conversion) are instrumented only if h5geo is built with
+/// `H5GEO_USE_PROFILING`, otherwise instrumentation is compiled out and
+/// snapshots are empty. Even then recording is off until setEnabled()
+/// is called, and then it costs two clock reads and a mutex per call. \n
+/// Optionally each call is also kept as an event to be exported
+/// in Chrome trace format (see writeChromeTrace()).
+class H5GEO_EXPORT Profiler
+{
+public:
+  static Profiler& instance();
+
+  /// \brief h5geo is built with instrumentation (`H5GEO_USE_PROFILING`)
+  static bool isCompiled();
+
+  /// \brief Start/stop recording
+  void setEnabled(bool val);
+  bool isEnabled() const {
+    return enabled.load(std::memory_order_relaxed);
+  }
+
+  /// \brief Also keep every call as Chrome trace event (at most `maxEvents`)
+  void setTraceEnabled(bool val, size_t maxEvents = 1000000);
+  bool isTraceEnabled() const;
+
+  /// \brief Add call of operation `name` started at `start`
+  void record(
+      const char* name,
+      std::chrono::steady_clock::time_point start,
+      std::chrono::steady_clock::time_point end,
+      const ProfileCounter& delta);
+
+  /// \brief Copy of the accumulated statistics (operation name -> counter)
+  std::map<std::string, ProfileCounter> snapshot() const;
+
+  /// \brief Clear statistics and trace events
+  void reset();
+
+  /// \brief Write trace events to JSON file that may be opened by
+  /// `chrome://tracing` or Perfetto
+  bool writeChromeTrace(const std::string& fileName) const;
+
+  Profiler(const Profiler&) = delete;
+  Profiler& operator=(const Profiler&) = delete;
+
+private:
+  Profiler();
+
+  struct Event
+  {
+    const char* name;
+    int64_t ts, dur; // microseconds since `origin`
+    size_t tid;
+    uint64_t bytesRead, bytesWritten, items;
+  };
+
+  size_t getThreadIndex(std::thread::id id);
+
+private:
+  std::atomic<bool> enabled{false};
+  mutable std::mutex m;
+  std::map<std::string, ProfileCounter> counters;
+  std::vector<Event> events;
+  std::map<std::thread::id, size_t> threads;
+  bool traceEnabled = false;
+  size_t maxEvents = 0;
+  uint64_t droppedEvents = 0;
+  std::chrono::steady_clock::time_point origin;
+};
+
+
+/// \class ProfileScope
+/// \brief Times the enclosing scope and adds it to Profiler when destroyed
+///
+/// Use H5GEO_PROFILE_SCOPE() and H5GEO_PROFILE_ADD() macros so that
+/// instrumentation is compiled out without `H5GEO_USE_PROFILING`.
+/// `name` must be a string literal (it is kept by trace events).
+class ProfileScope
+{
+public:
+  explicit ProfileScope(const char* name) :
+    name(name),
+    active(Profiler::instance().isEnabled())
+  {
+    if (active)
+      start = std::chrono::steady_clock::now();
+  }
+
+  ~ProfileScope(){
+    if (active)
+      Profiler::instance().record(
+            name, start, std::chrono::steady_clock::now(), delta);
+  }
+
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+
+  void addBytesRead(uint64_t n){ delta.bytesRead += n; }
+  void addBytesWritten(uint64_t n){ delta.bytesWritten += n; }
+  void addSelections(uint64_t n){ delta.selections += n; }
+  void addItems(uint64_t n){ delta.items += n; }
+
+private:
+  const char* name;
+  bool active;
+  std::chrono::steady_clock::time_point start;
+  ProfileCounter delta;
+};
+
+
+} // h5geo
+
+
+#ifdef H5GEO_USE_PROFILING
+/// \brief Declare h5geo::ProfileScope `var` timing operation `name`
+#define H5GEO_PROFILE_SCOPE(var, name) h5geo::ProfileScope var(name)
+/// \brief Call `var.method(n)` (i.e. `addBytesRead`) of h5geo::ProfileScope
+#define H5GEO_PROFILE_ADD(var, method, n) var.method(n)
+#else
+#define H5GEO_PROFILE_SCOPE(var, name)
+#define H5GEO_PROFILE_ADD(var, method, n)
+#endif
+
+
+#endif // H5PROFILER_H
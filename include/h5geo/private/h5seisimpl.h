@@ -3,6 +3,11 @@
 
 #include "../h5seis.h"
 #include "h5baseobjectimpl.h"
+#include "h5ioqueue.h"
+
+#ifdef H5GEO_USE_MPI
+#include "h5core_mpi.h"
+#endif
 
 #include <h5gt/H5DataSet.hpp>
 
@@ -90,6 +95,11 @@ public:
       const Eigen::Ref<const Eigen::VectorX<size_t>>& trcInd,
       const std::string& lengthUnits = "",
       bool doCoordTransform = false) override;
+  virtual bool reprojectXYTraceHeaders(
+      const std::string& srTo,
+      const std::vector<std::pair<std::string, std::string>>& xyHdrNames =
+      {{"SRCX", "SRCY"}, {"GRPX", "GRPY"}, {"CDP_X", "CDP_Y"}},
+      size_t nTrcBuffer = 1e6) override;
 
   virtual bool setNTrc(size_t nTrc) override;
   virtual bool setNSamp(size_t nSamp) override;
@@ -115,6 +125,31 @@ public:
       size_t nSamp = std::numeric_limits<size_t>::max(),
       const std::string& dataUnits = "") override;
 
+  virtual bool readTrace(
+      Eigen::Ref<Eigen::MatrixXf> TRACE,
+      const size_t& fromTrc,
+      const size_t& fromSampInd = 0,
+      const std::string& dataUnits = "") override;
+
+  virtual std::future<Eigen::MatrixXf> getTraceAsync(
+      const size_t& fromTrc,
+      size_t nTrc = 1,
+      const size_t& fromSampInd = 0,
+      size_t nSamp = std::numeric_limits<size_t>::max(),
+      const std::string& dataUnits = "") override;
+
+  virtual bool readTraceHeader(
+      Eigen::Ref<Eigen::MatrixXd> HDR,
+      const size_t& fromTrc,
+      const size_t& fromHdr = 0,
+      const std::vector<std::string>& unitsFrom = std::vector<std::string>(),
+      const std::vector<std::string>& unitsTo = std::vector<std::string>()) override;
+  virtual bool readTraceHeader(
+      const std::string& hdrName,
+      Eigen::Ref<Eigen::VectorXd> hdr,
+      const size_t& fromTrc,
+      const std::string& unitsFrom = "",
+      const std::string& unitsTo = "") override;
   virtual Eigen::MatrixXd getTraceHeader(
       const size_t& fromTrc,
       size_t nTrc = 1,
@@ -271,6 +306,11 @@ public:
   virtual bool removePKeySort(const std::string& pKeyName) override;
   virtual bool addPKeySort(const std::string& pKeyName) override;
 
+  virtual bool hasCompositeSort(const std::vector<std::string>& keyList) override;
+  virtual bool removeCompositeSort(const std::vector<std::string>& keyList) override;
+  virtual bool addCompositeSort(const std::vector<std::string>& keyList) override;
+  virtual std::vector<std::string> getCompositeSortNames() override;
+
   virtual bool updateTraceHeaderSampRate() override;
   virtual bool updateTraceHeaderNSamp() override;
 
@@ -283,6 +323,7 @@ public:
   virtual std::optional<h5gt::Group> getSortG() override;
   virtual std::optional<h5gt::Group> getUValG() override;
   virtual std::optional<h5gt::Group> getIndexesG() override;
+  virtual std::optional<h5gt::Group> getCompositeG() override;
 
   virtual std::optional<h5gt::Group> getSEGYG() override;
   virtual std::optional<h5gt::DataSet> getSEGYTextHeaderD() override;
@@ -294,19 +335,107 @@ public:
 
   virtual bool updateTraceHeaderLimits(size_t nTrcBuffer = 1e7) override;
   virtual bool updatePKeySort(const std::string& pKeyName) override;
+  virtual bool updateCompositeSort(const std::vector<std::string>& keyList) override;
 
   virtual Eigen::MatrixXd calcBoundary(
       const std::string& lengthUnits = "",
       bool doCoordTransform = false) override;
 
+  virtual bool updateBoundary(
+      const h5geo::BoundaryType& boundaryType = h5geo::BoundaryType::CONVEX,
+      double cellSize = 0,
+      size_t nTrcBuffer = 1e6) override;
+  virtual bool removeBoundary() override;
+  virtual std::optional<h5gt::DataSet> getBoundaryD() const override;
+
+  virtual bool calcSurveyInfo(
+      h5geo::SurveyInfo& info,
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE",
+      double ilMin = std::numeric_limits<double>::lowest(),
+      double ilMax = std::numeric_limits<double>::max(),
+      double xlMin = std::numeric_limits<double>::lowest(),
+      double xlMax = std::numeric_limits<double>::max(),
+      size_t nTrcBuffer = 1e6) override;
+
+  virtual Eigen::VectorX<ptrdiff_t> calcTraceCellIndexes(
+      const h5geo::SurveyInfo& info,
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE",
+      size_t nTrcBuffer = 1e6) override;
+
+  virtual Eigen::VectorXd calcWindowAttribute(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y,
+      const Eigen::Ref<const Eigen::VectorXd>& z,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      const std::string& lengthUnits = "",
+      const std::string& zUnits = "",
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE") override;
+
+  virtual Eigen::VectorXd interpolateAmplitudes(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y,
+      const Eigen::Ref<const Eigen::VectorXd>& z,
+      const std::string& lengthUnits = "",
+      const std::string& zUnits = "",
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE") override;
+
+  virtual Eigen::VectorXd extractAlongTrajectory(
+      const h5geo::Trajectory& traj,
+      const Eigen::Ref<const Eigen::VectorXd>& md,
+      const h5geo::TimeDepthCurve& tdCurve = h5geo::TimeDepthCurve(),
+      const std::string& lengthUnits = "",
+      const std::string& temporalUnits = "",
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE") override;
+
+  virtual bool calcHorizonWindowAttribute(
+      H5Horizon* horizon,
+      const std::string& componentName,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      const std::string& xComponent = "X",
+      const std::string& yComponent = "Y",
+      const std::string& zComponent = "Z",
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE") override;
+
+  virtual H5Map* calcMapWindowAttribute(
+      H5Map* map,
+      std::string& mapName,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      h5geo::CreationType createFlag = h5geo::CreationType::CREATE_OR_OVERWRITE,
+      const std::string& xHeader = "CDP_X",
+      const std::string& yHeader = "CDP_Y",
+      const std::string& ilHeader = "INLINE",
+      const std::string& xlHeader = "XLINE") override;
+
   virtual bool exportToVol(H5Vol* vol, 
       const std::string& xHeader = "CDP_X",
       const std::string& yHeader = "CDP_Y",
       const std::string& ilHeader = "INLINE",
       const std::string& xlHeader = "XLINE",
-      double ilMin = std::numeric_limits<double>::min(),
+      double ilMin = std::numeric_limits<double>::lowest(),
       double ilMax = std::numeric_limits<double>::max(),
-      double xlMin = std::numeric_limits<double>::min(),
+      double xlMin = std::numeric_limits<double>::lowest(),
       double xlMax = std::numeric_limits<double>::max(),
       size_t fromSampInd = 0,
       size_t nSamp = std::numeric_limits<size_t>::max(),
@@ -319,12 +448,80 @@ public:
       std::function<void(double)> progressCallback = nullptr) override;
 
 protected:
+  /// \brief Select traces and headers using prepared composite sort
+  /// (range lookup within sorted unique rows)
+  virtual Eigen::VectorX<size_t> getCompositeSortIndexes(
+      Eigen::MatrixXd& HDR,
+      const std::vector<std::string>& keyList,
+      const std::vector<double>& minList,
+      const std::vector<double>& maxList,
+      size_t pStep);
+  /// \brief Composite sort name is made of keys separated by `-`
+  std::string getCompositeSortName(const std::vector<std::string>& keyList);
+
   virtual Eigen::MatrixXd calcBoundaryStk2D();
-  virtual Eigen::MatrixXd calcConvexHullBoundary();
+  /// \brief Streaming convex hull of `CDP_X`, `CDP_Y`
+  virtual Eigen::MatrixXd calcConvexHullBoundary(size_t nTrcBuffer = 1e6);
+  /// \brief Streaming concave boundary of `CDP_X`, `CDP_Y`
+  virtual Eigen::MatrixXd calcConcaveBoundary(double cellSize, size_t nTrcBuffer = 1e6);
+  /// \brief Save boundary within seis group (`X` and `Y` rows)
+  bool saveBoundary(
+      const Eigen::Ref<const Eigen::MatrixXd>& boundary,
+      h5geo::BoundaryType boundaryType,
+      double cellSize);
+  /// \brief Remove saved boundary if any of `nHdr` trace headers
+  /// starting from `fromHdrInd` is `CDP_X` or `CDP_Y`
+  void removeBoundaryIfXYChanged(ptrdiff_t fromHdrInd, size_t nHdr = 1);
+  /// \brief Remove composite sorts using any of `nHdr` trace headers
+  /// starting from `fromHdrInd` as a key (they would be stale otherwise)
+  void removeCompositeSortsIfHdrChanged(ptrdiff_t fromHdrInd, size_t nHdr = 1);
+
+  /// \brief `traceD` and `traceHeaderD` are kept open:
+  /// reopen them to apply chunk cache
+  virtual void setChunkCache(
+      const H5ChunkCacheParam& p,
+      const std::string& datasetName = "") override;
+  virtual void resetChunkCache() override;
 
 protected:
-  h5gt::DataSet traceD, traceHeaderD;
+  void reopenTraceDatasets();
+
+  /// \brief Reduce windows around points (see h5geo::WindowReducer),
+  /// traces are read in chunk order
+  virtual Eigen::VectorXd reduceWindows(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y,
+      const Eigen::Ref<const Eigen::VectorXd>& z,
+      double windowAbove,
+      double windowBelow,
+      size_t padSamples,
+      const h5geo::WindowReducer& reducer,
+      const std::string& lengthUnits,
+      const std::string& zUnits,
+      const std::string& xHeader,
+      const std::string& yHeader,
+      const std::string& ilHeader,
+      const std::string& xlHeader);
+
+  struct TraceRequest
+  {
+    size_t fromTrc, nTrc, fromSampInd, nSamp;
+    std::string dataUnits;
+  };
+
+  /// \brief Called on the I/O thread with requests queued by getTraceAsync()
+  void processTraceRequests(
+      const std::vector<TraceRequest>& reqs,
+      std::vector<std::promise<Eigen::MatrixXf>>& proms);
 
+protected:
+  h5gt::DataSet traceD, traceHeaderD;
+#ifdef H5GEO_USE_MPI
+  // block I/O is collective (file is opened with MPI-IO driver)
+  bool mpiIO = false;
+#endif
+  // must be the last member (waits for the I/O thread when destroyed)
+  h5geo::IOBatch<TraceRequest, Eigen::MatrixXf> traceBatch;
 
   //----------- FRIEND CLASSES -----------
   friend class H5SeisContainerImpl;
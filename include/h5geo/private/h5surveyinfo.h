@@ -0,0 +1,131 @@
+#ifndef H5SURVEYINFO_H
+#define H5SURVEYINFO_H
+
+#include "h5geo_export.h"
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <limits>
+
+#include <Eigen/Dense>
+
+namespace h5geo
+{
+
+/// \struct SurveyInfo
+/// \brief Post-stack survey geometry (bin grid)
+///
+/// Definitions of origin, orientation, spacings and reversal flags
+/// are the same as in h5geo::getSurveyInfoFromSortedData()
+struct SurveyInfo{
+  double origin_x = std::nan("nan"); ///< origin x-coord
+  double origin_y = std::nan("nan"); ///< origin y-coord
+  double orientation = std::nan("nan"); ///< counterclock angle, degree
+  double ilSpacing = std::nan("nan"); ///< spacing ALONG inline (i.e. distance between two adjoint xlines)
+  double xlSpacing = std::nan("nan"); ///< spacing ALONG xline (i.e. distance between two adjoint inlines)
+  bool isILReversed = false; ///< true if inline grows while X or Y axis decrease
+  bool isXLReversed = false; ///< true if xline grows while X or Y axis decrease
+  bool isPlanReversed = false; ///< true if orientation to IL bigger than orientation to XL
+  double ilMin = std::nan("nan"); ///< minimal inline
+  double ilMax = std::nan("nan"); ///< maximal inline
+  double ilStep = 1; ///< inline increment
+  size_t nIL = 0; ///< number of inlines in the grid (including missing ones)
+  double xlMin = std::nan("nan"); ///< minimal xline
+  double xlMax = std::nan("nan"); ///< maximal xline
+  double xlStep = 1; ///< xline increment
+  size_t nXL = 0; ///< number of xlines in the grid (including missing ones)
+  size_t nTrc = 0; ///< number of traces used to estimate the geometry
+  double residual = 0; ///< RMS distance between trace coordinates and the fitted grid (outliers excluded)
+
+  /// \brief Each grid cell is occupied by exactly one trace
+  bool isRegular() const { return nTrc > 0 && nTrc == nIL*nXL; }
+  /// \brief Number of `H5Vol` X-nodes (plan is made normal by exchanging IL and XL)
+  size_t getVolNX() const { return isPlanReversed ? nIL : nXL; }
+  /// \brief Number of `H5Vol` Y-nodes (plan is made normal by exchanging IL and XL)
+  size_t getVolNY() const { return isPlanReversed ? nXL : nIL; }
+};
+
+/// \class SurveyInfoEstimator
+/// \brief Streaming estimator of post-stack survey geometry
+///
+/// Trace headers are passed block by block with SurveyInfoEstimator::add()
+/// in any order (no sorting is needed). Memory usage doesn't depend on
+/// the number of traces: only number of traces per IL and per XL and
+/// least squares sums of the affine transform `(IL, XL) -> (X, Y)`
+/// are accumulated. IL/XL increments are the most common distances
+/// between adjacent lines thus a few odd IL/XL values don't spoil them.
+/// A small reservoir sample of traces is kept to reject outliers
+/// (traces with broken coordinates) and refit the grid. \n
+/// Missing traces and ragged edges are allowed: use
+/// h5geo::getSurveyCellIndexes() to map traces to grid cells.
+class H5GEO_EXPORT SurveyInfoEstimator
+{
+public:
+  /// \param sampleSize number of traces kept to robustly refit the grid
+  explicit SurveyInfoEstimator(size_t sampleSize = 4096);
+
+  /// \brief Accumulate block of trace headers
+  void add(
+      const Eigen::Ref<const Eigen::VectorXd>& il,
+      const Eigen::Ref<const Eigen::VectorXd>& xl,
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y);
+
+  /// \brief Calculate survey geometry from accumulated headers
+  /// \return false if less than two grid nodes were found or the fit failed
+  bool estimate(SurveyInfo& info) const;
+
+  /// \brief Number of accumulated traces
+  size_t getNTrc() const;
+
+  /// \brief Forget all accumulated traces
+  void reset();
+
+protected:
+  /// \brief Find line increment and limits of the lines lying on its grid
+  static void calcLineGrid(
+      const std::map<double, size_t>& counts,
+      double& minVal, double& maxVal, double& step);
+
+  bool fit(
+      const Eigen::Ref<const Eigen::MatrixX4d>& pts,
+      bool hasIL, bool hasXL,
+      Eigen::Matrix<double,3,2>& coef) const;
+
+  bool fit(
+      const Eigen::Matrix3d& AtA,
+      const Eigen::Matrix<double,3,2>& AtB,
+      bool hasIL, bool hasXL,
+      Eigen::Matrix<double,3,2>& coef) const;
+
+protected:
+  size_t n = 0;
+  double il0, xl0, x0, y0; // first trace (used to center data)
+  std::map<double, size_t> ilCounts, xlCounts; // line -> number of traces
+  Eigen::Matrix3d AtA;
+  Eigen::Matrix<double,3,2> AtB;
+  Eigen::MatrixX4d sample; // [IL, XL, X, Y] centered
+  size_t sampleSize;
+  std::mt19937_64 rng;
+};
+
+/// \brief Map traces to survey grid cells: `cell = iIL*nXL + iXL`,
+/// where `iIL = (IL-ilMin)/ilStep`, `iXL = (XL-xlMin)/xlStep`.
+/// Traces that don't belong to the grid get `-1`.
+H5GEO_EXPORT Eigen::VectorX<ptrdiff_t> getSurveyCellIndexes(
+    const SurveyInfo& info,
+    const Eigen::Ref<const Eigen::VectorXd>& il,
+    const Eigen::Ref<const Eigen::VectorXd>& xl);
+
+/// \brief Map grid cells (see h5geo::getSurveyCellIndexes()) to `H5Vol`
+/// XY-plane indexes: `iY*nX + iX`, where `nX = info.getVolNX()`. \n
+/// The same trace layout as used by h5geo::readSEGYSTACK(): plan is made
+/// normal and reversed IL/XL are flipped. Cells equal to `-1` are kept.
+H5GEO_EXPORT Eigen::VectorX<ptrdiff_t> getSurveyVolIndexes(
+    const SurveyInfo& info,
+    const Eigen::Ref<const Eigen::VectorX<ptrdiff_t>>& cells);
+
+} // h5geo
+
+#endif // H5SURVEYINFO_H
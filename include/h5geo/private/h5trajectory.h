@@ -0,0 +1,117 @@
+#ifndef H5TRAJECTORY_H
+#define H5TRAJECTORY_H
+
+#include "h5geo_export.h"
+#include "h5enum.h"
+
+#include <Eigen/Dense>
+
+#include <cmath>
+
+namespace h5geo
+{
+
+/// \struct TimeDepthCurve
+/// \brief Time-depth relationship used to convert `TVDSS` to `TWT`
+///
+/// `tvdss` and `twt` are pairs of points (checkshots) sorted by `tvdss`.
+/// Between points `TWT` is interpolated linearly and beyond them
+/// `velocity` (interval velocity, length per time units) is used. \n
+/// If there are no points `TWT = 2*TVDSS/velocity`.
+struct H5GEO_EXPORT TimeDepthCurve
+{
+  Eigen::VectorXd tvdss, twt;
+  double velocity = std::nan("nan");
+
+  /// \brief Checkshots are consistent or replacement velocity is set
+  bool isValid() const;
+
+  /// \brief Calculate `TWT` at given `TVDSS` (NaN if it can't be calculated)
+  Eigen::VectorXd tvdssToTwt(
+      const Eigen::Ref<const Eigen::VectorXd>& depth) const;
+};
+
+/// \class Trajectory
+/// \brief Well trajectory (deviation stations) with fast batched lookups
+///
+/// Stations are sorted by `MD` and each lookup is a binary search,
+/// i.e. a query of `m` values costs O(m*log(n)). Between stations the
+/// position is interpolated either linearly or along the minimum
+/// curvature arc (the same model h5geo::MdAzIncl2MdXYTvd() uses). \n
+/// All lengths share the same units, `AZIM` and `INCL` are in radians,
+/// `X` points to the East and `Y` to the North.
+class H5GEO_EXPORT Trajectory
+{
+public:
+  Trajectory() = default;
+  /// \param M matrix with columns `MD`, `X`, `Y`, `TVD`, `AZIM`, `INCL`
+  /// \param kb kelly bushing used to calculate `TVDSS`
+  explicit Trajectory(
+      const Eigen::Ref<const Eigen::MatrixXd>& M,
+      double kb = 0);
+
+  /// \brief At least one station is set
+  bool isValid() const;
+  /// \brief Number of stations
+  size_t getNSamp() const;
+  /// \brief Kelly bushing
+  double getKB() const;
+  /// \brief Stations: columns `MD`, `X`, `Y`, `TVD`, `AZIM`, `INCL`
+  const Eigen::MatrixXd& getStations() const;
+
+  /// \brief Resample stations with regular `MD` step
+  ///
+  /// New stations lie on minimum curvature arcs between the old ones.
+  /// The last station is always kept.
+  Trajectory resample(double step) const;
+
+  /// \brief Calculate `X`, `Y`, `TVD`, `TVDSS` (columns) at given `MD`
+  ///
+  /// Rows with `MD` outside of the trajectory are filled with NaN.
+  /// \param md measured depths (in any order)
+  /// \param minCurvature interpolate along minimum curvature arcs (otherwise linearly)
+  Eigen::MatrixXd mdToXYTvd(
+      const Eigen::Ref<const Eigen::VectorXd>& md,
+      bool minCurvature = true) const;
+
+  /// \brief Calculate `MD` at given `TVD`
+  ///
+  /// For trajectories going up (`TVD` is not monotonic) the shallowest
+  /// `MD` where the well reaches `TVD` is returned.
+  /// Values that the well never reaches are NaN.
+  /// \param tvd true vertical depths (in any order)
+  /// \param minCurvature interpolate along minimum curvature arcs (otherwise linearly)
+  Eigen::VectorXd tvdToMd(
+      const Eigen::Ref<const Eigen::VectorXd>& tvd,
+      bool minCurvature = true) const;
+
+  /// \brief Calculate `X`, `Y`, `Z` (columns) at given `MD` where `Z`
+  /// is in `domain`
+  ///
+  /// `TWT` is calculated from `TVDSS` using `tdCurve` and `OWT` is half of it.
+  /// Rows with `MD` outside of the trajectory are filled with NaN.
+  Eigen::MatrixXd mdToXYZ(
+      const Eigen::Ref<const Eigen::VectorXd>& md,
+      const h5geo::Domain& domain,
+      const TimeDepthCurve& tdCurve = TimeDepthCurve(),
+      bool minCurvature = true) const;
+
+protected:
+  /// \brief Position (`X`, `Y`, `TVD`) at `md` within segment `[i, i+1]`
+  Eigen::Vector3d interpolate(
+      ptrdiff_t i, double md, bool minCurvature) const;
+  /// \brief Index of segment `[i, i+1]` containing `md` (-1 if outside)
+  ptrdiff_t findSegmentByMD(double md) const;
+
+private:
+  Eigen::MatrixXd stations;
+  // cumulative max of `TVD`: makes first crossing search O(log n)
+  Eigen::VectorXd tvdMax;
+  double kb = 0;
+};
+
+
+} // h5geo
+
+
+#endif // H5TRAJECTORY_H
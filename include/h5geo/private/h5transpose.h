@@ -0,0 +1,61 @@
+#ifndef H5TRANSPOSE_H
+#define H5TRANSPOSE_H
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+
+namespace h5geo
+{
+
+
+template <typename D, typename T>
+/// \brief Cache-blocked transposition of traces into volume blocks.
+///
+/// Trace `j` (column of `src`) is scattered as:
+/// `dst[dstOffset(j) + s*dstStride(j)] = src(s, j)`,
+/// i.e. each trace becomes a row of a column-major block whose
+/// leading dimension is `dstStride(j)` (X is the fastest axis in `H5Vol`).
+/// Traces and samples are processed in `tileSize` x `tileSize` tiles
+/// so that both the read and the written tiles stay in cache.
+/// \param src traces (`nSamp` x `nTrc`)
+/// \param dstOffset index of the first sample of each trace in `dst`
+/// \param dstStride distance between adjoint samples of each trace in `dst`
+/// \param dst destination buffer (must be big enough)
+/// \param reverseSamples flip Z axis (needed when sampling rate is negative)
+/// \param tileSize number of traces/samples in tile
+void transposeTraces(
+    const Eigen::DenseBase<D>& src,
+    const Eigen::Ref<const Eigen::VectorX<ptrdiff_t>>& dstOffset,
+    const Eigen::Ref<const Eigen::VectorX<ptrdiff_t>>& dstStride,
+    T* dst,
+    bool reverseSamples = false,
+    ptrdiff_t tileSize = 32)
+{
+  ptrdiff_t nSamp = src.rows();
+  ptrdiff_t nTrc = src.cols();
+  if (dstOffset.size() != nTrc ||
+      dstStride.size() != nTrc ||
+      tileSize < 1)
+    return;
+
+  for (ptrdiff_t j0 = 0; j0 < nTrc; j0 += tileSize){
+    ptrdiff_t j1 = std::min(j0 + tileSize, nTrc);
+    for (ptrdiff_t s0 = 0; s0 < nSamp; s0 += tileSize){
+      ptrdiff_t s1 = std::min(s0 + tileSize, nSamp);
+      // neighbour traces are usually neighbour rows in `dst`
+      // thus inner loop goes along traces
+      for (ptrdiff_t s = s0; s < s1; s++){
+        ptrdiff_t sOut = reverseSamples ? nSamp-1-s : s;
+        for (ptrdiff_t j = j0; j < j1; j++)
+          dst[dstOffset(j) + sOut*dstStride(j)] = src(s, j);
+      }
+    }
+  }
+}
+
+
+} // h5geo
+
+
+#endif // H5TRANSPOSE_H
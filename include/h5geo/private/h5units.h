@@ -0,0 +1,28 @@
+#ifndef H5UNITS_H
+#define H5UNITS_H
+
+#include "h5geo_export.h"
+
+#include <string>
+
+namespace h5geo
+{
+
+/// \brief Get factor to convert values from `unitsFrom` to `unitsTo`
+///
+/// The same as `units::convert(units::unit_from_string(unitsFrom),
+/// units::unit_from_string(unitsTo))` but unit strings are parsed only once:
+/// factors are cached by `(unitsFrom, unitsTo)` pair. The cache is thread-safe.
+/// \return `NaN` if units can't be parsed or are incompatible
+H5GEO_EXPORT double getConversionFactor(
+    const std::string& unitsFrom,
+    const std::string& unitsTo);
+
+/// \brief Remove all cached conversion factors
+H5GEO_EXPORT void clearConversionFactors();
+
+
+} // h5geo
+
+
+#endif // H5UNITS_H
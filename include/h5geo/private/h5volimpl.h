@@ -3,6 +3,11 @@
 
 #include "../h5vol.h"
 #include "h5baseobjectimpl.h"
+#include "h5ioqueue.h"
+
+#ifdef H5GEO_USE_MPI
+#include "h5core_mpi.h"
+#endif
 
 class H5VolImpl : public H5BaseObjectImpl<H5Vol>
 {
@@ -56,6 +61,15 @@ public:
   virtual bool resize(
       size_t nx, size_t ny, size_t nz) override;
 
+  virtual bool readData(
+      Eigen::Ref<Eigen::MatrixXf> data,
+      const size_t& iX0,
+      const size_t& iY0,
+      const size_t& iZ0,
+      const size_t& nX,
+      const size_t& nY,
+      const size_t& nZ,
+      const std::string& dataUnits = "") override;
   virtual Eigen::MatrixXf getData(
       const size_t& iX0,
       const size_t& iY0,
@@ -64,6 +78,14 @@ public:
       const size_t& nY,
       const size_t& nZ,
       const std::string& dataUnits = "") override;
+  virtual std::future<Eigen::MatrixXf> getDataAsync(
+      const size_t& iX0,
+      const size_t& iY0,
+      const size_t& iZ0,
+      const size_t& nX,
+      const size_t& nY,
+      const size_t& nZ,
+      const std::string& dataUnits = "") override;
 
   virtual h5geo::Domain getDomain() override;
   virtual Eigen::VectorXd getOrigin(
@@ -85,6 +107,48 @@ public:
 
   virtual std::optional<h5gt::DataSet> getVolD() const override;
 
+  virtual Eigen::VectorXd calcWindowAttribute(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y,
+      const Eigen::Ref<const Eigen::VectorXd>& z,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      const std::string& lengthUnits = "",
+      const std::string& zUnits = "") override;
+
+  virtual Eigen::VectorXd interpolateAmplitudes(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y,
+      const Eigen::Ref<const Eigen::VectorXd>& z,
+      const std::string& lengthUnits = "",
+      const std::string& zUnits = "") override;
+
+  virtual Eigen::VectorXd extractAlongTrajectory(
+      const h5geo::Trajectory& traj,
+      const Eigen::Ref<const Eigen::VectorXd>& md,
+      const h5geo::TimeDepthCurve& tdCurve = h5geo::TimeDepthCurve(),
+      const std::string& lengthUnits = "",
+      const std::string& temporalUnits = "") override;
+
+  virtual bool calcHorizonWindowAttribute(
+      H5Horizon* horizon,
+      const std::string& componentName,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      const std::string& xComponent = "X",
+      const std::string& yComponent = "Y",
+      const std::string& zComponent = "Z") override;
+
+  virtual H5Map* calcMapWindowAttribute(
+      H5Map* map,
+      std::string& mapName,
+      double windowAbove,
+      double windowBelow,
+      const h5geo::WindowAttribute& attribute,
+      h5geo::CreationType createFlag = h5geo::CreationType::CREATE_OR_OVERWRITE) override;
+
   virtual bool exportToSEGY(
     const std::string& segyFile, 
     h5geo::Endian endian = h5geo::Endian::Big,
@@ -95,6 +159,39 @@ public:
       size_t xChunk, size_t yChunk, size_t zChunk,
       unsigned compressionLevel) override;
 
+protected:
+  /// \brief Reduce windows around points (see h5geo::WindowReducer),
+  /// volume is read XY chunk by chunk
+  virtual Eigen::VectorXd reduceWindows(
+      const Eigen::Ref<const Eigen::VectorXd>& x,
+      const Eigen::Ref<const Eigen::VectorXd>& y,
+      const Eigen::Ref<const Eigen::VectorXd>& z,
+      double windowAbove,
+      double windowBelow,
+      size_t padSamples,
+      const h5geo::WindowReducer& reducer,
+      const std::string& lengthUnits,
+      const std::string& zUnits);
+
+  struct DataRequest
+  {
+    size_t iX0, iY0, iZ0, nX, nY, nZ;
+    std::string dataUnits;
+  };
+
+  /// \brief Called on the I/O thread with requests queued by getDataAsync()
+  void processDataRequests(
+      const std::vector<DataRequest>& reqs,
+      std::vector<std::promise<Eigen::MatrixXf>>& proms);
+
+protected:
+#ifdef H5GEO_USE_MPI
+  // block I/O is collective (file is opened with MPI-IO driver)
+  bool mpiIO = false;
+#endif
+  // must be the last member (waits for the I/O thread when destroyed)
+  h5geo::IOBatch<DataRequest, Eigen::MatrixXf> dataBatch;
+
   //----------- FRIEND CLASSES -----------
   friend class H5VolContainerImpl;
   friend class H5BaseObjectImpl<H5Vol>;
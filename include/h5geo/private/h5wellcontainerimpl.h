@@ -27,6 +27,13 @@ public:
   virtual H5Well* openWellByUWI(
       const std::string& name) override;
 
+  virtual H5WellLogs getLogCurves(
+      const std::string& logType,
+      const std::string& logName,
+      const std::vector<std::string>& wellNames = {},
+      const std::string& lengthUnits = "",
+      const std::string& dataUnits = "") override;
+
   //----------- FRIEND CLASSES -----------
   friend class H5BaseContainerImpl<H5WellContainer>;
   friend H5WellContainer* h5geo::createWellContainer(
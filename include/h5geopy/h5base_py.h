@@ -17,6 +17,10 @@ void DevCurveParam_py(py::class_<H5DevCurveParam, H5BaseObjectParam> &py_obj);
 void LogCurveParam_py(py::class_<H5LogCurveParam, H5BaseObjectParam> &py_obj);
 void SeisParam_py(py::class_<H5SeisParam, H5BaseObjectParam> &py_obj);
 void VolParam_py(py::class_<H5VolParam, H5BaseObjectParam> &py_obj);
+void ChunkCacheParam_py(py::class_<H5ChunkCacheParam> &py_obj);
+void FileAccessParam_py(py::class_<H5FileAccessParam> &py_obj);
+void FileCreateParam_py(py::class_<H5FileCreateParam> &py_obj);
+void CatalogEntry_py(py::class_<H5CatalogEntry> &py_obj);
 
 template <class TBase>
 struct H5Base_py
@@ -77,6 +77,13 @@ struct H5BaseContainer_py
              h5geo::CreationType>(&H5BaseContainer::createHorizon))
 
         .def("getH5File", &H5BaseContainer::getH5File)
+        .def("beginBatch", &H5BaseContainer::beginBatch,
+             "suppress per-call flushes of geo-objects until `endBatch()` is called")
+        .def("endBatch", &H5BaseContainer::endBatch,
+             "end batch session and flush the file once")
+        .def("isBatchActive", &H5BaseContainer::isBatchActive)
+        .def("removeObject", &H5BaseContainer::removeObject, py::arg("name"))
+        .def("rebuildCatalog", &H5BaseContainer::rebuildCatalog)
         .def("getObjGroupList", &H5BaseContainer::getObjGroupList)
         .def("getObjNameList", &H5BaseContainer::getObjNameList)
         .def("getObjCount", &H5BaseContainer::getObjCount)
@@ -98,6 +98,10 @@ struct H5BaseObject_py
 
         .def("getH5File", &H5BaseObject::getH5File)
         .def("getObjG", &H5BaseObject::getObjG)
+        .def("setChunkCache", &H5BaseObject::setChunkCache,
+             py::arg("p"),
+             py::arg_v("datasetName", "", "str()"))
+        .def("resetChunkCache", &H5BaseObject::resetChunkCache)
 
         .def("getName", &H5BaseObject::getName)
         .def("getFullName", &H5BaseObject::getFullName)
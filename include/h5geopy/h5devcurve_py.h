@@ -7,6 +7,13 @@
 
 namespace h5geopy {
 
+void Trajectory_py(
+    py::class_<Trajectory, std::shared_ptr<Trajectory>>
+    &py_obj);
+
+void TimeDepthCurve_py(
+    py::class_<TimeDepthCurve> &py_obj);
+
 void H5DevCurve_py(
     py::class_<
     H5DevCurve,
@@ -24,6 +24,8 @@ void TrajectoryFormat_py(py::enum_<TrajectoryFormat> &py_obj);
 void CreationType_py(py::enum_<CreationType> &py_obj);
 void CaseSensitivity_py(py::enum_<CaseSensitivity> &py_obj);
 void Delimiter_py(py::enum_<Delimiter> &py_obj);
+void WindowAttribute_py(py::enum_<WindowAttribute> &py_obj);
+void BoundaryType_py(py::enum_<BoundaryType> &py_obj);
 
 
 } // h5geopy
@@ -26,6 +26,10 @@
 #include <pybind11/cast.h>
 #include <pybind11/functional.h>
 
+#include <H5public.h>
+
+#include <optional>
+
 #ifdef H5GEO_USE_GDAL
 #include <gdal.h>
 #include <gdal_priv.h>
@@ -64,6 +68,37 @@ PYBIND11_MAKE_OPAQUE(h5geo::Point4Array);
 
 #include <h5geo/h5base.h>
 
+namespace h5geopy {
+
+/// \brief Call guard for functions doing HDF5 I/O
+///
+/// Releases GIL so that other Python threads run while data is being
+/// read or written. HDF5 calls from different threads are safe only if
+/// HDF5 is built thread-safe (it has its own global lock) thus otherwise
+/// GIL is kept.
+class gil_scoped_release_h5io
+{
+public:
+  gil_scoped_release_h5io(){
+    if (isHDF5ThreadSafe())
+      release.emplace();
+  }
+
+  static bool isHDF5ThreadSafe(){
+    static bool val = [](){
+      hbool_t is_ts = false;
+      return H5is_library_threadsafe(&is_ts) >= 0 && is_ts;
+    }();
+    return val;
+  }
+
+private:
+  std::optional<py::gil_scoped_release> release;
+};
+
+} // h5geopy
+
+
 class H5BasePy : public H5Base {
 public:
     /* Inherit the constructors */
@@ -0,0 +1,50 @@
+#ifndef H5IOQUEUE_PY_H
+#define H5IOQUEUE_PY_H
+
+#include "h5geo_py.h"
+
+#include <h5geo/private/h5ioqueue.h>
+
+#include <future>
+
+namespace h5geopy {
+
+namespace ext {
+
+/// \brief Result of asynchronous read (i.e. `H5Seis.getTraceAsync`)
+///
+/// Waiting for the result doesn't need HDF5 thus GIL is always released.
+template<typename T>
+class IOFuture
+{
+public:
+  explicit IOFuture(std::future<T>&& f) : fut(f.share()){}
+
+  T result() const {
+    return fut.get();
+  }
+
+  bool done() const {
+    return fut.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  }
+
+private:
+  std::shared_future<T> fut;
+};
+
+} // ext
+
+void IOFutureMatrixXf_py(
+    py::class_<ext::IOFuture<Eigen::MatrixXf>>
+    &py_obj);
+
+void IOFutureMatrixXd_py(
+    py::class_<ext::IOFuture<Eigen::MatrixXd>>
+    &py_obj);
+
+void defineIOQueueFunctions(py::module_& m);
+
+} // h5geopy
+
+
+#endif // H5IOQUEUE_PY_H
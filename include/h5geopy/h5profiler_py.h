@@ -0,0 +1,19 @@
+#ifndef H5PROFILER_PY_H
+#define H5PROFILER_PY_H
+
+#include "h5geo_py.h"
+
+#include <h5geo/private/h5profiler.h>
+
+namespace h5geopy {
+
+void ProfileCounter_py(
+    py::class_<ProfileCounter>
+    &py_obj);
+
+void defineProfilerFunctions(py::module_& m);
+
+} // h5geopy
+
+
+#endif // H5PROFILER_PY_H
@@ -0,0 +1,20 @@
+#ifndef H5SURVEYINFO_PY_H
+#define H5SURVEYINFO_PY_H
+
+#include "h5geo_py.h"
+
+#include <h5geo/private/h5surveyinfo.h>
+
+namespace h5geopy {
+
+void SurveyInfo_py(
+    py::class_<SurveyInfo>
+    &py_obj);
+
+void SurveyInfoEstimator_py(
+    py::class_<SurveyInfoEstimator>
+    &py_obj);
+
+} // h5geopy
+
+#endif // H5SURVEYINFO_PY_H
@@ -8,6 +8,8 @@
 
 namespace h5geopy {
 
+void WellLogs_py(py::class_<H5WellLogs> &py_obj);
+
 void H5WellContainer_py(
     py::class_<
     H5WellContainer,
@@ -258,9 +258,61 @@ h5gt::File H5BaseContainerImpl<TBase>::getH5File() const{
   return h5File;
 }
 
+template <typename TBase>
+bool H5BaseContainerImpl<TBase>::beginBatch(){
+  return h5geo::beginBatch(h5File);
+}
+
+template <typename TBase>
+bool H5BaseContainerImpl<TBase>::endBatch(){
+  return h5geo::endBatch(h5File);
+}
+
+template <typename TBase>
+bool H5BaseContainerImpl<TBase>::isBatchActive() const{
+  return h5geo::isBatchActive(h5File);
+}
+
+template <typename TBase>
+bool H5BaseContainerImpl<TBase>::removeObject(const std::string& name){
+  if (!h5File.hasObject(name, h5gt::ObjectType::Group))
+    return false;
+
+  h5gt::Group group = h5File.getGroup(name);
+  if (!h5geo::isGeoObject(group))
+    return false;
+
+  std::string path = group.getPath();
+  try {
+    h5File.unlink(path);
+  } catch (h5gt::Exception& err) {
+    return false;
+  }
+  h5geo::removeFromCatalog(h5File, path);
+  h5geo::flushUnlessBatch(h5File);
+  return true;
+}
+
+template <typename TBase>
+bool H5BaseContainerImpl<TBase>::rebuildCatalog(){
+  return h5geo::rebuildCatalog(h5File);
+}
+
 template <typename TBase>
 std::vector<h5gt::Group>
 H5BaseContainerImpl<TBase>::getObjGroupList(const h5geo::ObjectType& objType, bool recursive){
+  auto catalogOpt = h5geo::readCatalog(h5File);
+  if (catalogOpt.has_value()){
+    std::vector<h5gt::Group> groupList;
+    for (const auto& path : h5geo::findInCatalog(
+           catalogOpt.value(), "/", objType, recursive)){
+      // the file may be modified by other tools
+      if (h5File.hasObject(path, h5gt::ObjectType::Group))
+        groupList.push_back(h5File.getGroup(path));
+    }
+    return groupList;
+  }
+
   h5gt::Group group = h5File.getGroup("/");
   return H5BaseImpl<TBase>::getChildGroupList(group, objType, recursive);
 }
@@ -268,6 +320,19 @@ H5BaseContainerImpl<TBase>::getObjGroupList(const h5geo::ObjectType& objType, bo
 template <typename TBase>
 std::vector<std::string>
 H5BaseContainerImpl<TBase>::getObjNameList(const h5geo::ObjectType& objType, bool recursive){
+  auto catalogOpt = h5geo::readCatalog(h5File);
+  if (catalogOpt.has_value()){
+    std::vector<std::string> nameList;
+    for (const auto& path : h5geo::findInCatalog(
+           catalogOpt.value(), "/", objType, recursive)){
+      // the file may be modified by other tools
+      if (h5File.hasObject(path, h5gt::ObjectType::Group))
+        nameList.push_back(h5geo::getRelativePath(
+                             "/", path, h5geo::CaseSensitivity::CASE_INSENSITIVE));
+    }
+    return nameList;
+  }
+
   h5gt::Group group = h5File.getGroup("/");
   return H5BaseImpl<TBase>::getChildNameList(group, objType, "/", recursive);
 }
@@ -275,6 +340,18 @@ H5BaseContainerImpl<TBase>::getObjNameList(const h5geo::ObjectType& objType, boo
 template <typename TBase>
 size_t
 H5BaseContainerImpl<TBase>::getObjCount(const h5geo::ObjectType& objType, bool recursive){
+  auto catalogOpt = h5geo::readCatalog(h5File);
+  if (catalogOpt.has_value()){
+    size_t count = 0;
+    for (const auto& path : h5geo::findInCatalog(
+           catalogOpt.value(), "/", objType, recursive)){
+      // the file may be modified by other tools
+      if (h5File.hasObject(path, h5gt::ObjectType::Group))
+        count++;
+    }
+    return count;
+  }
+
   h5gt::Group group = h5File.getGroup("/");
   return H5BaseImpl<TBase>::getChildCount(group, objType, recursive);
 }
@@ -227,21 +227,24 @@ H5BaseImpl<TBase>::createContainer(
           createFlag == h5geo::CreationType::CREATE |
           createFlag == h5geo::CreationType::OPEN_OR_CREATE){
         if (H5Fis_hdf5(fileName.c_str()) > 0){
-          h5gt::File h5File(
+          h5gt::File h5File = h5geo::openH5File(
                 fileName,
                 h5gt::File::ReadWrite |
-                h5gt::File::OpenOrCreate);
+                h5gt::File::OpenOrCreate,
+                h5geo::getDefaultFileAccessParam(containerType));
           return createContainer(h5File, containerType, createFlag);
         }
         return std::nullopt;
       }
     }
 
-    h5gt::File h5File(
+    h5gt::File h5File = h5geo::openH5File(
           fileName,
           h5gt::File::ReadWrite |
           h5gt::File::Create |
-          h5gt::File::Truncate);
+          h5gt::File::Truncate,
+          h5geo::getDefaultFileCreateParam(containerType),
+          h5geo::getDefaultFileAccessParam(containerType));
     return createContainer(h5File, containerType, createFlag);
 
   } catch (h5gt::Exception& err) {
@@ -354,19 +357,31 @@ H5BaseImpl<TBase>::createObject(
     if (h5geo::isGeoObject(objG))
       return std::nullopt;
 
-    return createNewObject(objG, objType, p);
+    auto opt = createNewObject(objG, objType, p);
+    if (opt.has_value())
+      h5geo::addToCatalog(opt.value(), objType);
+    return opt;
   } case h5geo::CreationType::OPEN_OR_CREATE: {
     if (h5geo::isGeoObjectByType(objG, objType))
       return objG;
 
     return createObject(objG, objType, p, h5geo::CreationType::CREATE);
   } case h5geo::CreationType::CREATE_OR_OVERWRITE: {
+    // just created group can't be in the catalog
+    bool isEmpty =
+        objG.getNumberObjects() == 0 &&
+        objG.getNumberAttributes() == 0;
     if (!h5geo::unlinkContent(objG))
       return std::nullopt;
     if (!h5geo::deleteAllAttributes(objG))
       return std::nullopt;
+    if (!isEmpty)
+      h5geo::removeFromCatalog(objG.getFile(), objG.getPath());
 
-    return createNewObject(objG, objType, p);
+    auto opt = createNewObject(objG, objType, p);
+    if (opt.has_value())
+      h5geo::addToCatalog(opt.value(), objType);
+    return opt;
   } case h5geo::CreationType::CREATE_UNDER_NEW_NAME: {
     return std::nullopt;
   }  default:
@@ -384,6 +399,9 @@ H5BaseImpl<TBase>::createNewContainer(
         file,
         std::string{h5geo::detail::ContainerType},
         containerType);
+  // file may already contain geo-objects
+  if (!h5geo::hasCatalog(file))
+    h5geo::rebuildCatalog(file);
   return file;
 }
 
@@ -532,6 +550,12 @@ H5BaseImpl<TBase>::createNewHorizon(h5gt::Group &group, void* p)
   std::vector<hsize_t> cdims = {param.components.size(), param.pointsChunkSize};
   h5gt::DataSetCreateProps props;
   props.setChunk(cdims);
+  if (param.compression_level > 0){
+    // shuffle groups bytes of the same significance and must precede deflate
+    H5Pset_shuffle(props.getId());
+    props.setDeflate(param.compression_level);
+  }
+  H5Pset_fill_value(props.getId(), H5T_NATIVE_DOUBLE, &param.nullValue);
   h5gt::DataSpace dataspace(count, max_count);
 
 
@@ -562,10 +586,13 @@ H5BaseImpl<TBase>::createNewHorizon(h5gt::Group &group, void* p)
           h5gt::DataSpace::From(param.dataUnits)).
         write(param.dataUnits);
 
-    h5gt::DataSet dataset =
-        group.createDataSet<double>(
-          std::string{h5geo::detail::horizon_data},
-          dataspace, h5gt::LinkCreateProps(), props);
+    h5gt::DataSet dataset = param.floatData ?
+          group.createDataSet<float>(
+            std::string{h5geo::detail::horizon_data},
+            dataspace, h5gt::LinkCreateProps(), props) :
+          group.createDataSet<double>(
+            std::string{h5geo::detail::horizon_data},
+            dataspace, h5gt::LinkCreateProps(), props);
     for (auto const& [key, val] : param.components){
       dataset.createAttribute<size_t>(key, h5gt::DataSpace(1)).write(val);
     }
@@ -596,6 +623,13 @@ H5BaseImpl<TBase>::createNewMap(h5gt::Group &group, void* p)
   std::vector<hsize_t> cdims = {param.yChunkSize, param.xChunkSize};
   h5gt::DataSetCreateProps props;
   props.setChunk(cdims);
+  if (param.compression_level > 0){
+    // shuffle groups bytes of the same significance and must precede deflate
+    H5Pset_shuffle(props.getId());
+    props.setDeflate(param.compression_level);
+  }
+  // chunks that were never written are not allocated and read as `nullValue`
+  H5Pset_fill_value(props.getId(), H5T_NATIVE_DOUBLE, &param.nullValue);
   h5gt::DataSpace dataspace(count, max_count);
 
   std::vector<double> origin({param.X0, param.Y0});
@@ -641,9 +675,14 @@ H5BaseImpl<TBase>::createNewMap(h5gt::Group &group, void* p)
           h5gt::DataSpace({2})).
         write(point2);
 
-    group.createDataSet<double>(
-          std::string{h5geo::detail::map_data},
-          dataspace, h5gt::LinkCreateProps(), props);
+    if (param.floatData)
+      group.createDataSet<float>(
+            std::string{h5geo::detail::map_data},
+            dataspace, h5gt::LinkCreateProps(), props);
+    else
+      group.createDataSet<double>(
+            std::string{h5geo::detail::map_data},
+            dataspace, h5gt::LinkCreateProps(), props);
 
     return group;
 
@@ -669,10 +708,13 @@ H5BaseImpl<TBase>::createNewVol(h5gt::Group &group, void* p)
 
   std::vector<size_t> count = {param.nZ, param.nY, param.nX};
   std::vector<size_t> max_count = {h5gt::DataSpace::UNLIMITED, h5gt::DataSpace::UNLIMITED, h5gt::DataSpace::UNLIMITED};
-  std::vector<hsize_t> cdims = {param.xChunkSize, param.yChunkSize, param.zChunkSize};
+  std::vector<hsize_t> cdims = {param.zChunkSize, param.yChunkSize, param.xChunkSize};
   h5gt::DataSetCreateProps props;
   props.setChunk(cdims);
   props.setDeflate(param.compression_level);
+  // chunks that were never written are not allocated and read as `nullValue`
+  float fillValue = param.nullValue;
+  H5Pset_fill_value(props.getId(), H5T_NATIVE_FLOAT, &fillValue);
   h5gt::DataSpace dataspace(count, max_count);
 
   std::vector<double> origin({param.X0, param.Y0, param.Z0});
@@ -783,14 +825,22 @@ H5BaseImpl<TBase>::createNewLogCurve(h5gt::Group &group, void* p)
   H5LogCurveParam param = *(static_cast<H5LogCurveParam*>(p));
 
   // try-catch can't handle this situation
-  if (param.chunkSize < 1)
+  if (param.nSamp < 1 && param.chunkSize < 1)
     return std::nullopt;
 
   std::vector<size_t> count = {2, 1};
   std::vector<size_t> max_count = {2, h5gt::DataSpace::UNLIMITED};
-  std::vector<hsize_t> cdims = {2, param.chunkSize};
   h5gt::DataSetCreateProps props;
-  props.setChunk(cdims);
+  if (param.nSamp > 0){
+    // fixed-size curve needs no chunk index and small one
+    // is stored right in the object header
+    count[1] = param.nSamp;
+    max_count[1] = param.nSamp;
+    h5geo::setFixedSizeLayout(props.getId(), 2*param.nSamp*sizeof(double));
+  } else {
+    std::vector<hsize_t> cdims = {2, param.chunkSize};
+    props.setChunk(cdims);
+  }
   h5gt::DataSpace dataspace(count, max_count);
 
   try {
@@ -835,14 +885,22 @@ H5BaseImpl<TBase>::createNewDevCurve(h5gt::Group &group, void* p)
   H5DevCurveParam param = *(static_cast<H5DevCurveParam*>(p));
 
   // try-catch can't handle this situation
-  if (param.chunkSize < 1)
+  if (param.nSamp < 1 && param.chunkSize < 1)
     return std::nullopt;
 
   std::vector<size_t> count = {7, 1};
   std::vector<size_t> max_count = {7, h5gt::DataSpace::UNLIMITED};
-  std::vector<hsize_t> cdims = {7, param.chunkSize};
   h5gt::DataSetCreateProps props;
-  props.setChunk(cdims);
+  if (param.nSamp > 0){
+    // fixed-size curve needs no chunk index and small one
+    // is stored right in the object header
+    count[1] = param.nSamp;
+    max_count[1] = param.nSamp;
+    h5geo::setFixedSizeLayout(props.getId(), 7*param.nSamp*sizeof(double));
+  } else {
+    std::vector<hsize_t> cdims = {7, param.chunkSize};
+    props.setChunk(cdims);
+  }
   h5gt::DataSpace dataspace(count, max_count);
 
   try {
@@ -1299,6 +1357,8 @@ H5BaseImpl<TBase>::createSort(
           std::string{h5geo::detail::indexes});
     h5gt::Group uValGroup = sortGroup.createGroup(
           std::string{h5geo::detail::unique_values});
+    h5gt::Group compositeGroup = sortGroup.createGroup(
+          std::string{h5geo::detail::composite});
     return sortGroup;
 
   } catch (h5gt::Exception& err) {
@@ -1797,9 +1857,10 @@ h5geo::openMapContainerByName(
     return nullptr;
 
   try {
-    h5gt::File h5File(
+    h5gt::File h5File = h5geo::openH5File(
           fileName,
-          h5gt::File::ReadWrite);
+          h5gt::File::ReadWrite,
+          h5geo::getDefaultFileAccessParam(h5geo::ContainerType::MAP));
     return h5geo::openMapContainer(h5File);
   } catch (h5gt::Exception& err) {
     return nullptr;
@@ -1842,9 +1903,10 @@ H5SeisContainer* h5geo::openSeisContainerByName(
     return nullptr;
 
   try {
-    h5gt::File h5File(
+    h5gt::File h5File = h5geo::openH5File(
           fileName,
-          h5gt::File::ReadWrite);
+          h5gt::File::ReadWrite,
+          h5geo::getDefaultFileAccessParam(h5geo::ContainerType::SEISMIC));
     return h5geo::openSeisContainer(h5File);
   } catch (h5gt::Exception& err) {
     return nullptr;
@@ -1887,9 +1949,10 @@ H5VolContainer* h5geo::openVolContainerByName(
     return nullptr;
 
   try {
-    h5gt::File h5File(
+    h5gt::File h5File = h5geo::openH5File(
           fileName,
-          h5gt::File::ReadWrite);
+          h5gt::File::ReadWrite,
+          h5geo::getDefaultFileAccessParam(h5geo::ContainerType::VOLUME));
     return h5geo::openVolContainer(h5File);
   } catch (h5gt::Exception& err) {
     return nullptr;
@@ -1932,9 +1995,10 @@ h5geo::openWellContainerByName(const std::string& fileName){
     return nullptr;
 
   try {
-    h5gt::File h5File(
+    h5gt::File h5File = h5geo::openH5File(
           fileName,
-          h5gt::File::ReadWrite);
+          h5gt::File::ReadWrite,
+          h5geo::getDefaultFileAccessParam(h5geo::ContainerType::WELL));
     return h5geo::openWellContainer(h5File);
   } catch (h5gt::Exception& err) {
     return nullptr;
@@ -2037,9 +2101,10 @@ H5Map* h5geo::openMapByName(
     return nullptr;
 
   try {
-    h5gt::File h5File(
+    h5gt::File h5File = h5geo::openH5File(
           fileName,
-          h5gt::File::ReadWrite);
+          h5gt::File::ReadWrite,
+          h5geo::getDefaultFileAccessParam(h5geo::ContainerType::MAP));
     if (!h5File.hasObject(objName, h5gt::ObjectType::Group))
       return nullptr;
 
@@ -2064,9 +2129,10 @@ H5Seis* h5geo::openSeisByName(
     return nullptr;
 
   try {
-    h5gt::File h5File(
+    h5gt::File h5File = h5geo::openH5File(
           fileName,
-          h5gt::File::ReadWrite);
+          h5gt::File::ReadWrite,
+          h5geo::getDefaultFileAccessParam(h5geo::ContainerType::SEISMIC));
     if (!h5File.hasObject(objName, h5gt::ObjectType::Group))
       return nullptr;
 
@@ -2091,9 +2157,10 @@ H5Vol* h5geo::openVolByName(
     return nullptr;
 
   try {
-    h5gt::File h5File(
+    h5gt::File h5File = h5geo::openH5File(
           fileName,
-          h5gt::File::ReadWrite);
+          h5gt::File::ReadWrite,
+          h5geo::getDefaultFileAccessParam(h5geo::ContainerType::VOLUME));
     if (!h5File.hasObject(objName, h5gt::ObjectType::Group))
       return nullptr;
 
@@ -302,35 +302,8 @@ OGRCoordinateTransformation*
 H5BaseObjectImpl<TBase>::createCoordinateTransformationToReadData(
     const std::string& unitsTo)
 {
-  std::string unitsFrom = getLengthUnits();
-  double coefFrom = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::meter);
-
-  if (isnan(coefFrom))
-    return nullptr;
-
-  double coefTo = units::convert(
-        units::unit_from_string(unitsTo),
-        units::meter);
-
-  if (isnan(coefTo))
-    return nullptr;
-
-  std::string srAuthAndCodeFrom = getSpatialReference();
-  OGRSpatialReference srFrom;
-  if (srFrom.SetFromUserInput(srAuthAndCodeFrom.c_str()) != OGRERR_NONE)
-    return nullptr;
-
-  OGRSpatialReference srTo = h5geo::sr::getSpatialReference();
-
-  if (srFrom.SetLinearUnitsAndUpdateParameters(unitsFrom.c_str(), coefFrom) != OGRERR_NONE)
-    return nullptr;
-
-  if (srTo.SetLinearUnitsAndUpdateParameters(unitsTo.c_str(), coefTo) != OGRERR_NONE)
-    return nullptr;
-
-  return OGRCreateCoordinateTransformation(&srFrom, &srTo);
+  return getSRContext()->createCoordinateTransformationFrom(
+        getSpatialReference(), getLengthUnits(), unitsTo);
 }
 
 template <typename TBase>
@@ -338,35 +311,22 @@ OGRCoordinateTransformation*
 H5BaseObjectImpl<TBase>::createCoordinateTransformationToWriteData(
     const std::string &unitsFrom)
 {
-  double coefFrom = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::meter);
-
-  if (isnan(coefFrom))
-    return nullptr;
-
-  std::string unitsTo = getLengthUnits();
-  double coefTo = units::convert(
-        units::unit_from_string(unitsTo),
-        units::meter);
-
-  if (isnan(coefTo))
-    return nullptr;
-
-  OGRSpatialReference srFrom = h5geo::sr::getSpatialReference();
-
-  std::string srAuthAndCodeTo = getSpatialReference();
-  OGRSpatialReference srTo;
-  if (srTo.SetFromUserInput(srAuthAndCodeTo.c_str()) != OGRERR_NONE)
-    return nullptr;
-
-  if (srFrom.SetLinearUnitsAndUpdateParameters(unitsFrom.c_str(), coefFrom) != OGRERR_NONE)
-    return nullptr;
+  return getSRContext()->createCoordinateTransformationTo(
+        getSpatialReference(), getLengthUnits(), unitsFrom);
+}
 
-  if (srTo.SetLinearUnitsAndUpdateParameters(unitsTo.c_str(), coefTo) != OGRERR_NONE)
-    return nullptr;
+template <typename TBase>
+void H5BaseObjectImpl<TBase>::setSRContext(
+    const std::shared_ptr<h5geo::SRContext>& ctx)
+{
+  srContext = ctx;
+}
 
-  return OGRCreateCoordinateTransformation(&srFrom, &srTo);
+template <typename TBase>
+std::shared_ptr<h5geo::SRContext> H5BaseObjectImpl<TBase>::getSRContext() const {
+  if (srContext)
+    return srContext;
+  return h5geo::sr::getDefaultContext();
 }
 
 #endif
@@ -480,6 +440,19 @@ h5gt::Group H5BaseObjectImpl<TBase>::getObjG() const {
   return objG;
 }
 
+template <typename TBase>
+void H5BaseObjectImpl<TBase>::setChunkCache(
+    const H5ChunkCacheParam& p,
+    const std::string& datasetName)
+{
+  chunkCache[datasetName] = p;
+}
+
+template <typename TBase>
+void H5BaseObjectImpl<TBase>::resetChunkCache(){
+  chunkCache.clear();
+}
+
 template <typename TBase>
 std::optional<h5gt::Group>
 H5BaseObjectImpl<TBase>::getGroupOpt(
@@ -501,7 +474,34 @@ H5BaseObjectImpl<TBase>::getDatasetOpt(
   if (!parent.hasObject(name, h5gt::ObjectType::Dataset))
     return std::nullopt;
 
-  return parent.getDataSet(name);
+  auto it = chunkCache.find(name);
+  if (it == chunkCache.end())
+    it = chunkCache.find("");
+  if (it == chunkCache.end())
+    return parent.getDataSet(name);
+
+  H5ChunkCacheParam p = it->second;
+  if (p.nBytes < 1){
+    // chunk size is needed to pick the cache
+    h5gt::DataSet dset = parent.getDataSet(name);
+    H5ChunkCacheParam autoP = h5geo::getAutoChunkCacheParam(dset);
+    if (autoP.nBytes < 1)
+      return dset;
+
+    p.nBytes = autoP.nBytes;
+    if (p.nSlots < 1)
+      p.nSlots = autoP.nSlots;
+  } else if (p.nSlots < 1){
+    // user defined cache size is kept
+    h5gt::DataSet dset = parent.getDataSet(name);
+    p.nSlots = h5geo::getAutoChunkCacheSlots(dset, p.nBytes);
+    if (p.nSlots < 1)
+      return dset;
+  }
+
+  h5gt::DataSetAccessProps dapl;
+  H5Pset_chunk_cache(dapl.getId(), p.nSlots, p.nBytes, p.w0);
+  return parent.getDataSet(name, dapl);
 }
 
 template <typename TBase>
@@ -8,8 +8,6 @@
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/private/h5enum_string.h"
 
-#include <units/units.hpp>
-
 #ifdef H5GEO_USE_GDAL
 #include <gdal.h>
 #include <gdal_priv.h>
@@ -29,7 +27,7 @@ bool H5BasePointsImpl<TBase>::setNPoints(size_t n)
 
   try {
     opt->resize({n});
-    this->objG.flush();
+    h5geo::flushUnlessBatch(this->objG.getFile());
     return true;
   } catch (h5gt::Exception e) {
     return false;
@@ -1,11 +1,18 @@
 #include "../../include/h5geo/h5core.h"
+#include "../../include/h5geo/h5base.h"
 #include "../../include/h5geo/private/h5seisimpl.h"
+#include "../../include/h5geo/h5horizon.h"
+#include "../../include/h5geo/h5map.h"
+#include "../../include/h5geo/h5mapcontainer.h"
 
 #define _USE_MATH_DEFINES   // should be before <cmath>, include 'pi' val
 
 #include <math.h>
 #include <algorithm>
 #include <optional>
+#include <map>
+#include <set>
+#include <mutex>
 #include <filesystem>
 namespace fs = std::filesystem;
 
@@ -33,6 +40,802 @@ std::optional<h5gt::File> openFile(
   }
 }
 
+namespace {
+
+struct BatchSession{
+  size_t depth = 0;
+  H5AC_cache_config_t mdcConfig;
+  bool restoreMdcConfig = false;
+};
+
+// sessions are shared by all containers/objects opened within the same file
+std::mutex batchMutex;
+std::map<std::string, BatchSession> batchSessions;
+
+// file number distinguishes the same file reopened after it was closed
+std::string getBatchKey(hid_t id){
+  ssize_t n = H5Fget_name(id, NULL, 0);
+  if (n < 1)
+    return std::string();
+
+  std::string name(n, '\0');
+  H5Fget_name(id, name.data(), n+1);
+  std::error_code ec;
+  fs::path path = fs::weakly_canonical(name, ec);
+  if (!ec)
+    name = path.string();
+
+#if H5_VERSION_GE(1, 12, 0)
+  unsigned long fileno = 0;
+  if (H5Fget_fileno(id, &fileno) < 0)
+    return std::string();
+  name += ":" + std::to_string(fileno);
+#endif
+  return name;
+}
+
+// drop sessions of closed files (i.e. exception was thrown before `endBatch`)
+void pruneBatchSessions(){
+  if (batchSessions.empty())
+    return;
+
+  ssize_t nFiles = H5Fget_obj_count(H5F_OBJ_ALL, H5F_OBJ_FILE);
+  if (nFiles < 0)
+    return;
+
+  std::vector<hid_t> ids(nFiles);
+  if (nFiles > 0)
+    nFiles = H5Fget_obj_ids(H5F_OBJ_ALL, H5F_OBJ_FILE, ids.size(), ids.data());
+  if (nFiles < 0)
+    return;
+
+  std::set<std::string> openKeys;
+  for (ssize_t i = 0; i < nFiles; i++)
+    openKeys.insert(getBatchKey(ids[i]));
+
+  for (auto it = batchSessions.begin(); it != batchSessions.end();){
+    if (openKeys.count(it->first) < 1)
+      it = batchSessions.erase(it);
+    else
+      it++;
+  }
+}
+
+// many small objects are created/written within batch session
+void tuneBatchMdcConfig(H5AC_cache_config_t& config){
+  size_t initSize = 32*1024*1024;
+  size_t maxSize = 128*1024*1024;
+  config.max_size = std::max(config.max_size, maxSize);
+  config.min_size = std::min(config.min_size, config.max_size);
+  config.set_initial_size = true;
+  config.initial_size = std::clamp(initSize, config.min_size, config.max_size);
+}
+
+} // namespace
+
+bool beginBatch(const h5gt::File& file){
+  std::string key = getBatchKey(file.getId());
+  if (key.empty())
+    return false;
+
+  std::lock_guard<std::mutex> lock(batchMutex);
+  pruneBatchSessions();
+  BatchSession& session = batchSessions[key];
+  if (session.depth++ > 0)
+    return true;
+
+  session.mdcConfig.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+  if (H5Fget_mdc_config(file.getId(), &session.mdcConfig) < 0)
+    return true;
+
+  H5AC_cache_config_t config = session.mdcConfig;
+  tuneBatchMdcConfig(config);
+  session.restoreMdcConfig =
+      H5Fset_mdc_config(file.getId(), &config) >= 0;
+  return true;
+}
+
+bool endBatch(const h5gt::File& file){
+  std::string key = getBatchKey(file.getId());
+  {
+    std::lock_guard<std::mutex> lock(batchMutex);
+    pruneBatchSessions();
+    auto it = batchSessions.find(key);
+    if (it == batchSessions.end())
+      return false;
+
+    if (--it->second.depth > 0)
+      return true;
+
+    if (it->second.restoreMdcConfig){
+      H5AC_cache_config_t& config = it->second.mdcConfig;
+      config.set_initial_size = true;
+      config.initial_size = std::clamp(
+            config.initial_size, config.min_size, config.max_size);
+      H5Fset_mdc_config(file.getId(), &config);
+    }
+    batchSessions.erase(it);
+  }
+
+  return H5Fflush(file.getId(), H5F_SCOPE_GLOBAL) >= 0;
+}
+
+bool isBatchActive(const h5gt::File& file){
+  // no need to get file name when there are no sessions at all
+  std::lock_guard<std::mutex> lock(batchMutex);
+  if (batchSessions.empty())
+    return false;
+
+  pruneBatchSessions();
+  return batchSessions.count(getBatchKey(file.getId())) > 0;
+}
+
+void flushUnlessBatch(const h5gt::File& file){
+  if (!isBatchActive(file))
+    H5Fflush(file.getId(), H5F_SCOPE_GLOBAL);
+}
+
+bool setBatchFileAccessProps(hid_t fapl){
+  if (H5Pset_evict_on_close(fapl, true) < 0)
+    return false;
+
+  H5AC_cache_config_t config;
+  config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+  if (H5Pget_mdc_config(fapl, &config) < 0)
+    return false;
+
+  tuneBatchMdcConfig(config);
+  return H5Pset_mdc_config(fapl, &config) >= 0;
+}
+
+namespace {
+
+size_t nextPrime(size_t n){
+  auto isPrime = [](size_t v){
+    if (v < 2)
+      return false;
+    for (size_t d = 2; d*d <= v; d++)
+      if (v % d == 0)
+        return false;
+    return true;
+  };
+
+  while (!isPrime(n))
+    n++;
+  return n;
+}
+
+// HDF5 recommends ~100 slots per chunk that fits into cache
+size_t calcChunkCacheSlots(size_t nBytes, size_t chunkBytes){
+  size_t nChunks = std::max<size_t>(nBytes / std::max<size_t>(chunkBytes, 1), 1);
+  return nextPrime(std::max<size_t>(100*nChunks, 521));
+}
+
+} // namespace
+
+h5gt::File openH5File(
+    const std::string& fileName,
+    unsigned openFlags,
+    const H5FileAccessParam& p)
+{
+  return openH5File(fileName, openFlags, H5FileCreateParam(), p);
+}
+
+h5gt::File openH5File(
+    const std::string& fileName,
+    unsigned openFlags,
+    const H5FileCreateParam& cp,
+    const H5FileAccessParam& ap)
+{
+  h5gt::FileCreateProps fcpl;
+  setFileCreateProps(fcpl.getId(), cp);
+  h5gt::FileAccessProps fapl;
+  setFileAccessProps(fapl.getId(), ap);
+  bool truncate = openFlags & h5gt::File::Truncate;
+  if (ap.pageBufferSize < 1 || (truncate && cp.pagedAggregation))
+    return h5gt::File(fileName, openFlags, fcpl, fapl);
+
+  // HDF5 refuses to use page buffer with not paged file
+  H5FileAccessParam apNoPB = ap;
+  apNoPB.pageBufferSize = 0;
+  h5gt::FileAccessProps faplNoPB;
+  setFileAccessProps(faplNoPB.getId(), apNoPB);
+  if (truncate)
+    return h5gt::File(fileName, openFlags, fcpl, faplNoPB);
+
+  // existing file may be paged or not: try page buffer silently
+  H5E_auto2_t errFunc;
+  void* errData;
+  H5Eget_auto2(H5E_DEFAULT, &errFunc, &errData);
+  H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+  try {
+    h5gt::File file(fileName, openFlags, fcpl, fapl);
+    H5Eset_auto2(H5E_DEFAULT, errFunc, errData);
+    return file;
+  } catch (h5gt::Exception& err) {
+    H5Eset_auto2(H5E_DEFAULT, errFunc, errData);
+    return h5gt::File(fileName, openFlags, fcpl, faplNoPB);
+  }
+}
+
+std::optional<h5gt::File> createFile(
+    const std::string& fileName,
+    const H5FileCreateParam& cp,
+    const H5FileAccessParam& ap)
+{
+  try {
+    return openH5File(
+          fileName,
+          h5gt::File::ReadWrite | h5gt::File::Create | h5gt::File::Truncate,
+          cp, ap);
+  } catch (h5gt::Exception& err) {
+    return std::nullopt;
+  }
+}
+
+std::optional<h5gt::File> openFile(
+    const std::string& fileName,
+    const H5FileAccessParam& p)
+{
+  if (!fs::exists(fileName) || H5Fis_hdf5(fileName.c_str()) < 1)
+    return std::nullopt;
+
+  try {
+    return openH5File(fileName, h5gt::File::ReadWrite, p);
+  } catch (h5gt::Exception& err) {
+    return std::nullopt;
+  }
+}
+
+bool setFileAccessProps(
+    hid_t fapl, const H5FileAccessParam& p)
+{
+  bool val = true;
+  if (p.chunkCache.nBytes > 0){
+    // file-level cache doesn't know chunk size: assume 1 MB chunks
+    size_t nSlots = p.chunkCache.nSlots > 0 ?
+          p.chunkCache.nSlots :
+          calcChunkCacheSlots(p.chunkCache.nBytes, 1024*1024);
+    val &= H5Pset_cache(fapl, 0, nSlots, p.chunkCache.nBytes, p.chunkCache.w0) >= 0;
+  }
+
+  if (p.mdcInitSize > 0 || p.mdcMaxSize > 0){
+    H5AC_cache_config_t config;
+    config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    if (H5Pget_mdc_config(fapl, &config) >= 0){
+      config.max_size = std::max(config.max_size, p.mdcMaxSize);
+      config.min_size = std::min(config.min_size, config.max_size);
+      if (p.mdcInitSize > 0){
+        config.set_initial_size = true;
+        config.initial_size = std::clamp(p.mdcInitSize, config.min_size, config.max_size);
+      }
+      val &= H5Pset_mdc_config(fapl, &config) >= 0;
+    } else {
+      val = false;
+    }
+  }
+
+#ifdef H5GEO_USE_MPI
+  if (p.mpiComm != MPI_COMM_NULL)
+    val &= H5Pset_fapl_mpio(fapl, p.mpiComm, p.mpiInfo) >= 0;
+
+  // parallel HDF5 doesn't support page buffer
+  if (p.pageBufferSize > 0 && p.mpiComm == MPI_COMM_NULL)
+#else
+  if (p.pageBufferSize > 0)
+#endif
+    val &= H5Pset_page_buffer_size(fapl, p.pageBufferSize, 0, 0) >= 0;
+
+  if (p.alignment > 1)
+    val &= H5Pset_alignment(fapl, p.alignThreshold, p.alignment) >= 0;
+
+  if (p.libverLow >= 0 && p.libverHigh >= 0)
+    val &= H5Pset_libver_bounds(
+          fapl,
+          static_cast<H5F_libver_t>(p.libverLow),
+          static_cast<H5F_libver_t>(p.libverHigh)) >= 0;
+
+  return val;
+}
+
+H5FileAccessParam getDefaultFileAccessParam(
+    h5geo::ContainerType cntType)
+{
+  H5FileAccessParam p;
+  switch (cntType) {
+  case h5geo::ContainerType::SEISMIC :
+    // trace chunks are `{trcChunk, nSamp}` i.e. tens of MB
+    p.chunkCache.nBytes = 128*1024*1024;
+    p.alignThreshold = 1024*1024;
+    p.alignment = 4096;
+    break;
+  case h5geo::ContainerType::VOLUME :
+    // a layer of 64^3 float bricks
+    p.chunkCache.nBytes = 64*1024*1024;
+    p.alignThreshold = 1024*1024;
+    p.alignment = 4096;
+    break;
+  case h5geo::ContainerType::MAP :
+    p.chunkCache.nBytes = 16*1024*1024;
+    break;
+  case h5geo::ContainerType::WELL :
+    // many small objects: metadata matters more than raw data
+    p.mdcInitSize = 4*1024*1024;
+    p.mdcMaxSize = 64*1024*1024;
+    // used only if container was created with paged aggregation
+    p.pageBufferSize = 4*1024*1024;
+    break;
+  default :
+    break;
+  }
+  return p;
+}
+
+bool setFileCreateProps(
+    hid_t fcpl, const H5FileCreateParam& p)
+{
+  if (!p.pagedAggregation && !p.persistFreeSpace)
+    return true;
+
+  bool val = true;
+  val &= H5Pset_file_space_strategy(
+        fcpl,
+        p.pagedAggregation ? H5F_FSPACE_STRATEGY_PAGE : H5F_FSPACE_STRATEGY_FSM_AGGR,
+        p.persistFreeSpace,
+        p.freeSpaceThreshold) >= 0;
+  if (p.pagedAggregation && p.pageSize > 0)
+    val &= H5Pset_file_space_page_size(fcpl, p.pageSize) >= 0;
+  return val;
+}
+
+bool setFixedSizeLayout(hid_t dcpl, size_t nBytes)
+{
+  // compact data must fit 64 KB object header along with attributes
+  if (nBytes <= 32*1024)
+    return H5Pset_layout(dcpl, H5D_COMPACT) >= 0;
+  return H5Pset_layout(dcpl, H5D_CONTIGUOUS) >= 0;
+}
+
+H5FileCreateParam getDefaultFileCreateParam(
+    h5geo::ContainerType cntType)
+{
+  H5FileCreateParam p;
+  switch (cntType) {
+  case h5geo::ContainerType::WELL :
+    // wells and curves are small: page them together with their metadata
+    p.pagedAggregation = true;
+    p.pageSize = 64*1024;
+    break;
+  default :
+    break;
+  }
+  return p;
+}
+
+H5ChunkCacheParam getAutoChunkCacheParam(
+    h5gt::DataSet& dset,
+    size_t maxBytes)
+{
+  H5ChunkCacheParam p;
+  auto props = dset.getCreateProps();
+  if (!props.isChunked())
+    return p;
+
+  std::vector<size_t> dims = dset.getDimensions();
+  std::vector<hsize_t> cdims = props.getChunk(dims.size());
+  if (cdims.size() != dims.size())
+    return p;
+
+  size_t chunkBytes = dset.getDataType().getSize();
+  size_t nChunks = 1;
+  for (size_t i = 0; i < dims.size(); i++){
+    chunkBytes *= cdims[i];
+    if (i > 0)
+      nChunks *= (dims[i] + cdims[i] - 1) / cdims[i];
+  }
+
+  nChunks = std::max<size_t>(nChunks, 1);
+  p.nBytes = std::max(chunkBytes, std::min(chunkBytes*nChunks, maxBytes));
+  p.nSlots = calcChunkCacheSlots(p.nBytes, chunkBytes);
+  return p;
+}
+
+size_t getAutoChunkCacheSlots(
+    h5gt::DataSet& dset,
+    size_t nBytes)
+{
+  auto props = dset.getCreateProps();
+  if (!props.isChunked())
+    return 0;
+
+  std::vector<size_t> dims = dset.getDimensions();
+  std::vector<hsize_t> cdims = props.getChunk(dims.size());
+  if (cdims.size() != dims.size())
+    return 0;
+
+  size_t chunkBytes = dset.getDataType().getSize();
+  for (size_t i = 0; i < dims.size(); i++)
+    chunkBytes *= cdims[i];
+
+  return calcChunkCacheSlots(nBytes, chunkBytes);
+}
+
+namespace {
+
+bool isCatalogTypeEqual(
+    const h5geo::ObjectType& a,
+    const h5geo::ObjectType& b)
+{
+  if (a == b)
+    return true;
+  // in hdf5 welltops == points1 (see h5geo::isWellTops())
+  return (a == h5geo::ObjectType::WELLTOPS && b == h5geo::ObjectType::POINTS_1) ||
+      (a == h5geo::ObjectType::POINTS_1 && b == h5geo::ObjectType::WELLTOPS);
+}
+
+std::string getCatalogParentPath(const std::string& path){
+  size_t pos = path.find_last_of('/');
+  if (pos == std::string::npos || pos == 0)
+    return "/";
+  return path.substr(0, pos);
+}
+
+bool isCatalogSuccessor(const std::string& path, const std::string& parentPath){
+  if (parentPath == "/")
+    return path.size() > 1 && path[0] == '/';
+  return path.size() > parentPath.size() &&
+      path[parentPath.size()] == '/' &&
+      path.compare(0, parentPath.size(), parentPath) == 0;
+}
+
+std::vector<std::string> splitCatalogPath(const std::string& path){
+  std::vector<std::string> names;
+  size_t pos = 0;
+  while (pos <= path.size()){
+    size_t next = path.find('/', pos);
+    if (next == std::string::npos)
+      next = path.size();
+    names.push_back(path.substr(pos, next-pos));
+    pos = next+1;
+  }
+  return names;
+}
+
+bool isFileWritable(const h5gt::File& file){
+  unsigned intent;
+  if (H5Fget_intent(file.getId(), &intent) < 0)
+    return false;
+  return intent & H5F_ACC_RDWR;
+}
+
+void collectGeoObjects(
+    h5gt::Group& group,
+    std::vector<H5CatalogEntry>& entries)
+{
+  std::string catalogName = std::string{h5geo::detail::catalog};
+  bool isRoot = group.getPath() == "/";
+  for (const auto& name : group.listObjectNames()){
+    if (isRoot && name == catalogName)
+      continue;
+
+    // soft links (like `ACTIVE` dev curve) point to already listed objects
+    H5L_info_t linkInfo;
+    if (H5Lget_info(group.getId(), name.c_str(), &linkInfo, H5P_DEFAULT) < 0 ||
+        linkInfo.type != H5L_TYPE_HARD)
+      continue;
+
+    if (group.getObjectType(name) != h5gt::ObjectType::Group)
+      continue;
+
+    h5gt::Group childG = group.getGroup(name);
+    h5geo::ObjectType objType = h5geo::getGeoObjectType(childG);
+    if (static_cast<h5geo::ObjectTypeUType>(objType) != 0){
+      H5CatalogEntry entry;
+      entry.path = childG.getPath();
+      entry.objType = objType;
+      if (objType == h5geo::ObjectType::WELL)
+        entry.uwi = h5geo::readStringAttribute(
+              childG, std::string{h5geo::detail::UWI});
+      entries.push_back(std::move(entry));
+    }
+    // geo-objects may contain other geo-objects
+    collectGeoObjects(childG, entries);
+  }
+}
+
+std::optional<std::vector<H5CatalogEntry>> readCatalogDatasets(
+    const h5gt::File& file)
+{
+  try {
+    h5gt::Group catalogG = file.getGroup(std::string{h5geo::detail::catalog});
+    h5gt::DataSet pathD = catalogG.getDataSet(std::string{h5geo::detail::catalog_path});
+    h5gt::DataSet typeD = catalogG.getDataSet(std::string{h5geo::detail::catalog_type});
+    h5gt::DataSet uwiD = catalogG.getDataSet(std::string{h5geo::detail::catalog_uwi});
+    size_t n = pathD.getElementCount();
+    if (typeD.getElementCount() != n ||
+        uwiD.getElementCount() != n)
+      return std::nullopt;
+
+    std::vector<H5CatalogEntry> entries(n);
+    if (n < 1)
+      return entries;
+
+    std::vector<std::string> paths, uwis;
+    std::vector<h5geo::ObjectTypeUType> types;
+    pathD.read(paths);
+    typeD.read(types);
+    uwiD.read(uwis);
+    // removed objects are marked with zero type (see removeFromCatalog())
+    size_t m = 0;
+    for (size_t i = 0; i < n; i++){
+      if (types[i] == 0)
+        continue;
+      entries[m].path = std::move(paths[i]);
+      entries[m].objType = static_cast<h5geo::ObjectType>(types[i]);
+      entries[m].uwi = std::move(uwis[i]);
+      m++;
+    }
+    entries.resize(m);
+    return entries;
+  } catch (h5gt::Exception& err) {
+    return std::nullopt;
+  }
+}
+
+bool writeCatalogDatasets(
+    h5gt::File& file,
+    const std::vector<H5CatalogEntry>& entries)
+{
+  std::vector<std::string> paths(entries.size()), uwis(entries.size());
+  std::vector<h5geo::ObjectTypeUType> types(entries.size());
+  for (size_t i = 0; i < entries.size(); i++){
+    paths[i] = entries[i].path;
+    types[i] = static_cast<h5geo::ObjectTypeUType>(entries[i].objType);
+    uwis[i] = entries[i].uwi;
+  }
+
+  try {
+    std::string catalogName = std::string{h5geo::detail::catalog};
+    if (file.hasObject(catalogName, h5gt::ObjectType::Group))
+      file.unlink(catalogName);
+
+    h5gt::Group catalogG = file.createGroup(catalogName);
+    std::vector<size_t> count = {entries.size()};
+    std::vector<size_t> max_count = {h5gt::DataSpace::UNLIMITED};
+    std::vector<hsize_t> cdims = {1024};
+    h5gt::DataSetCreateProps props;
+    props.setChunk(cdims);
+    h5gt::DataSpace dataspace(count, max_count);
+    h5gt::DataSet pathD = catalogG.createDataSet<std::string>(
+          std::string{h5geo::detail::catalog_path},
+          dataspace, h5gt::LinkCreateProps(), props);
+    h5gt::DataSet typeD = catalogG.createDataSet<h5geo::ObjectTypeUType>(
+          std::string{h5geo::detail::catalog_type},
+          dataspace, h5gt::LinkCreateProps(), props);
+    h5gt::DataSet uwiD = catalogG.createDataSet<std::string>(
+          std::string{h5geo::detail::catalog_uwi},
+          dataspace, h5gt::LinkCreateProps(), props);
+    if (!entries.empty()){
+      pathD.write(paths);
+      typeD.write(types);
+      uwiD.write(uwis);
+    }
+  } catch (h5gt::Exception& err) {
+    return false;
+  }
+  return true;
+}
+
+} // namespace
+
+bool hasCatalog(const h5gt::File& file)
+{
+  return file.hasObject(
+        std::string{h5geo::detail::catalog},
+        h5gt::ObjectType::Group);
+}
+
+bool rebuildCatalog(h5gt::File file)
+{
+  if (!isFileWritable(file))
+    return false;
+
+  std::vector<H5CatalogEntry> entries;
+  h5gt::Group rootG = file.getGroup("/");
+  collectGeoObjects(rootG, entries);
+  return writeCatalogDatasets(file, entries);
+}
+
+std::optional<std::vector<H5CatalogEntry>> readCatalog(
+    h5gt::File file)
+{
+  // missing (older file) or broken catalog is not rebuilt here:
+  // listing must not modify the file
+  if (!hasCatalog(file))
+    return std::nullopt;
+
+  return readCatalogDatasets(file);
+}
+
+bool addToCatalog(
+    const h5gt::Group& objG,
+    const h5geo::ObjectType& objType)
+{
+  h5gt::File file = objG.getFile();
+  if (!hasCatalog(file))
+    return false;
+
+  std::string uwi;
+  if (objType == h5geo::ObjectType::WELL){
+    h5gt::Group wellG = objG;
+    uwi = h5geo::readStringAttribute(
+          wellG, std::string{h5geo::detail::UWI});
+  }
+
+  try {
+    h5gt::Group catalogG = file.getGroup(std::string{h5geo::detail::catalog});
+    h5gt::DataSet pathD = catalogG.getDataSet(std::string{h5geo::detail::catalog_path});
+    h5gt::DataSet typeD = catalogG.getDataSet(std::string{h5geo::detail::catalog_type});
+    h5gt::DataSet uwiD = catalogG.getDataSet(std::string{h5geo::detail::catalog_uwi});
+    size_t n = pathD.getElementCount();
+    pathD.resize({n+1});
+    typeD.resize({n+1});
+    uwiD.resize({n+1});
+    pathD.select({n}, {1}).write(std::vector<std::string>{objG.getPath()});
+    typeD.select({n}, {1}).write(std::vector<h5geo::ObjectTypeUType>{
+                                   static_cast<h5geo::ObjectTypeUType>(objType)});
+    uwiD.select({n}, {1}).write(std::vector<std::string>{uwi});
+  } catch (h5gt::Exception& err) {
+    return false;
+  }
+  return true;
+}
+
+bool removeFromCatalog(
+    h5gt::File file,
+    const std::string& objPath)
+{
+  if (!hasCatalog(file))
+    return false;
+
+  try {
+    h5gt::Group catalogG = file.getGroup(std::string{h5geo::detail::catalog});
+    h5gt::DataSet pathD = catalogG.getDataSet(std::string{h5geo::detail::catalog_path});
+    h5gt::DataSet typeD = catalogG.getDataSet(std::string{h5geo::detail::catalog_type});
+    h5gt::DataSet uwiD = catalogG.getDataSet(std::string{h5geo::detail::catalog_uwi});
+    size_t n = pathD.getElementCount();
+    if (n < 1)
+      return true;
+
+    std::vector<std::string> paths;
+    std::vector<h5geo::ObjectTypeUType> types;
+    pathD.read(paths);
+    typeD.read(types);
+
+    // entries are only marked removed (zero type) so that overwriting
+    // an object doesn't rewrite the whole catalog
+    size_t nRemoved = 0;
+    for (size_t i = 0; i < n; i++){
+      if (types[i] != 0 &&
+          (paths[i] == objPath || isCatalogSuccessor(paths[i], objPath))){
+        types[i] = 0;
+        paths[i].clear();
+        typeD.select({i}, {1}).write(std::vector<h5geo::ObjectTypeUType>{0});
+        pathD.select({i}, {1}).write(std::vector<std::string>{""});
+      }
+      if (types[i] == 0)
+        nRemoved++;
+    }
+
+    // compact when removed entries prevail
+    if (2*nRemoved <= n)
+      return true;
+
+    std::vector<std::string> uwis;
+    uwiD.read(uwis);
+    size_t m = 0;
+    for (size_t i = 0; i < n; i++){
+      if (types[i] == 0)
+        continue;
+      paths[m] = std::move(paths[i]);
+      types[m] = types[i];
+      uwis[m] = std::move(uwis[i]);
+      m++;
+    }
+    paths.resize(m);
+    types.resize(m);
+    uwis.resize(m);
+
+    pathD.resize({m});
+    typeD.resize({m});
+    uwiD.resize({m});
+    if (m > 0){
+      pathD.write(paths);
+      typeD.write(types);
+      uwiD.write(uwis);
+    }
+  } catch (h5gt::Exception& err) {
+    return false;
+  }
+  return true;
+}
+
+bool setCatalogUWI(
+    const h5gt::Group& wellG,
+    const std::string& uwi)
+{
+  h5gt::File file = wellG.getFile();
+  if (!hasCatalog(file))
+    return false;
+
+  try {
+    h5gt::Group catalogG = file.getGroup(std::string{h5geo::detail::catalog});
+    h5gt::DataSet pathD = catalogG.getDataSet(std::string{h5geo::detail::catalog_path});
+    h5gt::DataSet uwiD = catalogG.getDataSet(std::string{h5geo::detail::catalog_uwi});
+    std::vector<std::string> paths;
+    if (pathD.getElementCount() > 0)
+      pathD.read(paths);
+
+    auto it = std::find(paths.begin(), paths.end(), wellG.getPath());
+    if (it == paths.end())
+      return false;
+
+    size_t ind = std::distance(paths.begin(), it);
+    uwiD.select({ind}, {1}).write(std::vector<std::string>{uwi});
+  } catch (h5gt::Exception& err) {
+    return false;
+  }
+  return true;
+}
+
+std::vector<std::string> findInCatalog(
+    const std::vector<H5CatalogEntry>& catalog,
+    const std::string& parentPath,
+    const h5geo::ObjectType& objType,
+    bool recursive)
+{
+  std::string parent = parentPath;
+  while (parent.size() > 1 && parent.back() == '/')
+    parent.pop_back();
+  if (parent.empty())
+    parent = "/";
+
+  std::set<std::string> matched;
+  for (const auto& entry : catalog)
+    if (isCatalogTypeEqual(entry.objType, objType) &&
+        isCatalogSuccessor(entry.path, parent))
+      matched.insert(entry.path);
+
+  std::vector<std::string> found;
+  for (const auto& path : matched){
+    if (!recursive){
+      if (getCatalogParentPath(path) == parent)
+        found.push_back(path);
+      continue;
+    }
+
+    // recursive search doesn't look inside objects of the same type
+    bool isNested = false;
+    for (std::string p = getCatalogParentPath(path);
+         p != parent && p != "/";
+         p = getCatalogParentPath(p)){
+      if (matched.count(p) > 0){
+        isNested = true;
+        break;
+      }
+    }
+    if (!isNested)
+      found.push_back(path);
+  }
+
+  // HDF5 lists links in name order
+  std::sort(found.begin(), found.end(),
+            [](const std::string& a, const std::string& b){
+    return splitCatalogPath(a) < splitCatalogPath(b);
+  });
+  return found;
+}
+
 std::optional<h5gt::Group> openGroup(
     const std::string& fileName,
     const std::string& groupName)
@@ -418,6 +1221,236 @@ std::map<std::string, Eigen::VectorXd>
   return geom;
 }
 
+Eigen::VectorX<ptrdiff_t> calcGridNodeIndexes(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y,
+    double x0, double dx, size_t nx,
+    double y0, double dy, size_t ny,
+    double orientation)
+{
+  if (x.size() != y.size() ||
+      dx == 0 || dy == 0 ||
+      std::isnan(dx) || std::isnan(dy) ||
+      std::isnan(orientation))
+    return Eigen::VectorX<ptrdiff_t>();
+
+  double c = std::cos(orientation);
+  double s = std::sin(orientation);
+  Eigen::VectorX<ptrdiff_t> ind(x.size());
+  for (ptrdiff_t i = 0; i < x.size(); i++){
+    // rotate back to grid axes
+    double fx = ((x(i)-x0)*c + (y(i)-y0)*s) / dx;
+    double fy = ((y(i)-y0)*c - (x(i)-x0)*s) / dy;
+    double ix = std::round(fx);
+    double iy = std::round(fy);
+    if (std::isnan(fx) || std::isnan(fy) ||
+        ix < 0 || ix >= nx ||
+        iy < 0 || iy >= ny){
+      ind(i) = -1;
+      continue;
+    }
+    ind(i) = ptrdiff_t(iy)*nx + ptrdiff_t(ix);
+  }
+  return ind;
+}
+
+double calcWindowAttribute(
+    const Eigen::Ref<const Eigen::VectorXf>& v,
+    const WindowAttribute& attribute,
+    double nullValue)
+{
+  double sum = 0;
+  double val = std::nan("nan");
+  size_t n = 0;
+  for (ptrdiff_t i = 0; i < v.size(); i++){
+    if (std::isnan(v(i)) || v(i) == nullValue)
+      continue;
+
+    double d = v(i);
+    switch (attribute) {
+    case WindowAttribute::RMS :
+      sum += d*d;
+      break;
+    case WindowAttribute::MEAN :
+      sum += d;
+      break;
+    case WindowAttribute::MAX :
+      val = n > 0 ? std::max(val, d) : d;
+      break;
+    case WindowAttribute::MIN :
+      val = n > 0 ? std::min(val, d) : d;
+      break;
+    case WindowAttribute::MAX_ABS :
+      val = n > 0 ? std::max(val, std::fabs(d)) : std::fabs(d);
+      break;
+    default:
+      return std::nan("nan");
+    }
+    n++;
+  }
+
+  if (n < 1)
+    return std::nan("nan");
+
+  if (attribute == WindowAttribute::RMS)
+    return std::sqrt(sum / n);
+  else if (attribute == WindowAttribute::MEAN)
+    return sum / n;
+  return val;
+}
+
+double interpolateSample(
+    const Eigen::Ref<const Eigen::VectorXf>& v,
+    double pos,
+    double nullValue)
+{
+  if (std::isnan(pos) || pos < -1e-6 || pos > v.size() - 1 + 1e-6)
+    return std::nan("nan");
+
+  ptrdiff_t i0 = std::clamp<ptrdiff_t>(ptrdiff_t(std::floor(pos)), 0, v.size()-1);
+  ptrdiff_t i1 = std::min<ptrdiff_t>(i0+1, v.size()-1);
+  double f = std::clamp(pos - i0, 0.0, 1.0);
+  double v0 = v(i0);
+  double v1 = v(i1);
+  if (f < 1e-6)
+    return std::isnan(v0) || v0 == nullValue ? std::nan("nan") : v0;
+  if (f > 1 - 1e-6)
+    return std::isnan(v1) || v1 == nullValue ? std::nan("nan") : v1;
+  if (std::isnan(v0) || v0 == nullValue ||
+      std::isnan(v1) || v1 == nullValue)
+    return std::nan("nan");
+  return v0 + f*(v1 - v0);
+}
+
+bool calcHorizonWindowAttribute(
+    H5Horizon* horizon,
+    const std::string& componentName,
+    const Domain& domain,
+    const AmplitudeReader& reader,
+    const std::string& xComponent,
+    const std::string& yComponent,
+    const std::string& zComponent)
+{
+  if (!horizon || componentName.empty() || !reader)
+    return false;
+
+  if (horizon->getDomain() != domain)
+    return false;
+
+  std::string zUnits;
+  if (domain == Domain::OWT ||
+      domain == Domain::TWT)
+    zUnits = horizon->getTemporalUnits();
+  else
+    zUnits = horizon->getLengthUnits();
+
+  Eigen::VectorXd v = reader(
+        horizon->getComponent(xComponent),
+        horizon->getComponent(yComponent),
+        horizon->getComponent(zComponent),
+        horizon->getLengthUnits(), zUnits);
+  if (v.size() != horizon->getNPoints())
+    return false;
+
+  std::map<std::string, size_t> components = horizon->getComponents();
+  if (components.find(componentName) == components.end()){
+    size_t nComp = horizon->getNComponents();
+    components[componentName] = nComp;
+    if (!horizon->setNComponents(nComp+1) ||
+        !horizon->setComponents(components))
+      return false;
+  }
+
+  return horizon->writeComponent(componentName, v);
+}
+
+H5Map* calcMapWindowAttribute(
+    H5Map* map,
+    std::string& mapName,
+    const Domain& domain,
+    const std::string& dataUnits,
+    const AmplitudeReader& reader,
+    CreationType createFlag)
+{
+  if (!map || !reader)
+    return nullptr;
+
+  if (map->getDomain() != domain)
+    return nullptr;
+
+  Eigen::MatrixXd Z = map->getData();
+  Eigen::VectorXd origin = map->getOrigin();
+  Eigen::VectorXd p1 = map->getPoint1();
+  Eigen::VectorXd p2 = map->getPoint2();
+  if (Z.size() < 1 || origin.size() != 2 ||
+      p1.size() != 2 || p2.size() != 2)
+    return nullptr;
+
+  Z = (Z.array() == map->getNullValue()).select(std::nan("nan"), Z);
+
+  // `point1` is the last node of the first row, `point2` - of the first column
+  Eigen::Vector2d dc = Z.cols() > 1 ? Eigen::Vector2d((p1 - origin) / (Z.cols()-1)) : Eigen::Vector2d::Zero();
+  Eigen::Vector2d dr = Z.rows() > 1 ? Eigen::Vector2d((p2 - origin) / (Z.rows()-1)) : Eigen::Vector2d::Zero();
+  Eigen::VectorXd x(Z.size()), y(Z.size());
+  for (ptrdiff_t c = 0; c < Z.cols(); c++){
+    for (ptrdiff_t r = 0; r < Z.rows(); r++){
+      x(c*Z.rows()+r) = origin(0) + c*dc(0) + r*dr(0);
+      y(c*Z.rows()+r) = origin(1) + c*dc(1) + r*dr(1);
+    }
+  }
+
+  Eigen::VectorXd v = reader(
+        x, y, Z.reshaped(),
+        map->getLengthUnits(), map->getDataUnits());
+  if (v.size() != Z.size())
+    return nullptr;
+
+  H5MapCnt_ptr mapCnt(map->openMapContainer());
+  if (!mapCnt)
+    return nullptr;
+
+  // existing map is kept if it was only opened
+  h5gt::File file = mapCnt->getH5File();
+  bool existed = file.hasObject(mapName, h5gt::ObjectType::Group);
+
+  H5MapParam p = map->getParam();
+  p.dataUnits = dataUnits;
+  p.nullValue = std::nan("nan");
+  H5Map* attrMap = mapCnt->createMap(mapName, p, createFlag);
+  if (!attrMap)
+    return nullptr;
+
+  Eigen::MatrixXd M = v.reshaped(Z.rows(), Z.cols());
+  if (!attrMap->writeData(M)){
+    std::string attrMapPath = attrMap->getObjG().getPath();
+    attrMap->Delete();
+    if (!existed || createFlag == CreationType::CREATE_OR_OVERWRITE)
+      mapCnt->removeObject(attrMapPath);
+    return nullptr;
+  }
+
+  return attrMap;
+}
+
+Eigen::VectorXd extractAlongTrajectory(
+    const Trajectory& traj,
+    const Eigen::Ref<const Eigen::VectorXd>& md,
+    const TimeDepthCurve& tdCurve,
+    const Domain& domain,
+    const std::string& lengthUnits,
+    const std::string& temporalUnits,
+    const AmplitudeReader& reader)
+{
+  if (!traj.isValid() || md.size() < 1 || !reader)
+    return Eigen::VectorXd();
+
+  Eigen::MatrixXd XYZ = traj.mdToXYZ(md, domain, tdCurve);
+  bool isTime = domain == Domain::OWT || domain == Domain::TWT;
+  return reader(
+        XYZ.col(0), XYZ.col(1), XYZ.col(2),
+        lengthUnits, isTime ? temporalUnits : lengthUnits);
+}
+
 bool compareStrings(
     const std::string& bigger,
     const std::string& smaller,
@@ -711,6 +1744,22 @@ ptrdiff_t getIndexFromAttribute(
   return idx;
 }
 
+unsigned getDeflateLevel(
+    const h5gt::DataSetCreateProps& props)
+{
+  // iterating over filters doesn't push errors to HDF5 error stack
+  // (unlike `H5Pget_filter_by_id2` when filter is missing)
+  int nFilters = H5Pget_nfilters(props.getId());
+  for (int i = 0; i < nFilters; i++){
+    unsigned flags, level = 0;
+    size_t nElmts = 1;
+    if (H5Pget_filter2(props.getId(), i, &flags, &nElmts, &level,
+                       0, NULL, NULL) == H5Z_FILTER_DEFLATE)
+      return level;
+  }
+  return 0;
+}
+
 template <typename Scalar>
 bool _getSurveyInfoFromSortedData(
     const Eigen::Ref<const Eigen::VectorX<Scalar>>& il,
@@ -737,7 +1786,7 @@ bool _getSurveyInfoFromSortedData(
   size_t nxl = 0;
   for (ptrdiff_t i = 0; i < il.size(); i++){
     nxl += 1;
-    if (il(i) != il(i+1))
+    if (i+1 == il.size() || il(i) != il(i+1))
       break;
   }
 
@@ -0,0 +1,199 @@
+#include "../../include/h5geo/private/h5core_mpi.h"
+
+#include <h5gt/H5File.hpp>
+#include <h5gt/H5DataSet.hpp>
+
+#include <hdf5.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+namespace h5geo
+{
+
+namespace {
+
+// collective transfer: HDF5 requires every rank to participate
+// thus rank without data selects nothing in both dataspaces
+bool transferCollective(
+    hid_t dsetId,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    hid_t memType,
+    void* data,
+    bool isWrite)
+{
+  hid_t fileSpace = H5Dget_space(dsetId);
+  if (fileSpace < 0)
+    return false;
+
+  int rank = H5Sget_simple_extent_ndims(fileSpace);
+  size_t n = std::accumulate(
+        count.begin(), count.end(), size_t(1), std::multiplies<size_t>());
+  bool isEmpty = count.empty() || n < 1;
+  if (!isEmpty && (rank < 0 || offset.size() != size_t(rank) || count.size() != size_t(rank))){
+    H5Sclose(fileSpace);
+    return false;
+  }
+
+  std::vector<hsize_t> off(offset.begin(), offset.end());
+  std::vector<hsize_t> cnt(count.begin(), count.end());
+  hid_t memSpace;
+  herr_t status;
+  if (isEmpty){
+    hsize_t one = 1;
+    memSpace = H5Screate_simple(1, &one, nullptr);
+    status = H5Sselect_none(fileSpace) < 0 || H5Sselect_none(memSpace) < 0 ? -1 : 0;
+  } else {
+    memSpace = H5Screate_simple(rank, cnt.data(), nullptr);
+    status = H5Sselect_hyperslab(
+          fileSpace, H5S_SELECT_SET, off.data(), nullptr, cnt.data(), nullptr);
+  }
+
+  // empty block may have no buffer
+  char dummy = 0;
+  if (!data)
+    data = &dummy;
+
+  hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+  if (H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE) < 0)
+    status = -1;
+
+  // even if selection failed the rank must take part in the transfer
+  if (status < 0){
+    H5Sselect_none(fileSpace);
+    H5Sselect_none(memSpace);
+  }
+
+  herr_t ioStatus = isWrite ?
+        H5Dwrite(dsetId, memType, memSpace, fileSpace, dxpl, data) :
+        H5Dread(dsetId, memType, memSpace, fileSpace, dxpl, data);
+
+  H5Pclose(dxpl);
+  H5Sclose(memSpace);
+  H5Sclose(fileSpace);
+  return status >= 0 && ioStatus >= 0;
+}
+
+} // namespace
+
+
+bool isMPIFile(const h5gt::File& file){
+  hid_t fapl = H5Fget_access_plist(file.getId());
+  if (fapl < 0)
+    return false;
+
+  bool val = H5Pget_driver(fapl) == H5FD_MPIO;
+  H5Pclose(fapl);
+  return val;
+}
+
+MPIFileComm::MPIFileComm(const h5gt::File& file){
+  if (!isMPIFile(file))
+    return;
+
+  hid_t fapl = H5Fget_access_plist(file.getId());
+  MPI_Info info = MPI_INFO_NULL;
+  if (H5Pget_fapl_mpio(fapl, &comm, &info) < 0)
+    comm = MPI_COMM_NULL;
+  H5Pclose(fapl);
+  if (info != MPI_INFO_NULL)
+    MPI_Info_free(&info);
+
+  if (comm != MPI_COMM_NULL){
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+  }
+}
+
+MPIFileComm::~MPIFileComm(){
+  if (comm != MPI_COMM_NULL)
+    MPI_Comm_free(&comm);
+}
+
+bool MPIFileComm::isValid() const {
+  return comm != MPI_COMM_NULL;
+}
+
+MPI_Comm MPIFileComm::get() const {
+  return comm;
+}
+
+int MPIFileComm::getRank() const {
+  return rank;
+}
+
+int MPIFileComm::getSize() const {
+  return size;
+}
+
+bool MPIFileComm::all(bool val) const {
+  if (!isValid())
+    return val;
+
+  int in = val, out = 0;
+  MPI_Allreduce(&in, &out, 1, MPI_INT, MPI_LAND, comm);
+  return out;
+}
+
+void partitionMPI(
+    size_t n, int rank, int size,
+    size_t& from, size_t& count)
+{
+  if (size < 1 || rank < 0 || rank >= size){
+    from = 0;
+    count = 0;
+    return;
+  }
+
+  size_t part = n / size;
+  size_t rest = n % size;
+  from = rank * part + std::min<size_t>(rank, rest);
+  count = part + (size_t(rank) < rest ? 1 : 0);
+}
+
+bool readCollective(
+    const h5gt::DataSet& dset,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    float* data)
+{
+  return transferCollective(
+        dset.getId(), offset, count, H5T_NATIVE_FLOAT, data, false);
+}
+
+bool readCollective(
+    const h5gt::DataSet& dset,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    double* data)
+{
+  return transferCollective(
+        dset.getId(), offset, count, H5T_NATIVE_DOUBLE, data, false);
+}
+
+bool writeCollective(
+    const h5gt::DataSet& dset,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    const float* data)
+{
+  return transferCollective(
+        dset.getId(), offset, count, H5T_NATIVE_FLOAT,
+        const_cast<float*>(data), true);
+}
+
+bool writeCollective(
+    const h5gt::DataSet& dset,
+    const std::vector<size_t>& offset,
+    const std::vector<size_t>& count,
+    const double* data)
+{
+  return transferCollective(
+        dset.getId(), offset, count, H5T_NATIVE_DOUBLE,
+        const_cast<double*>(data), true);
+}
+
+
+} // h5geo
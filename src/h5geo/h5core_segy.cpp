@@ -18,6 +18,11 @@
 #include "../../include/h5geo/private/h5enum_string.h"
 #include "../../include/h5geo/h5seis.h"
 #include "../../include/h5geo/h5vol.h"
+#include "../../include/h5geo/private/h5profiler.h"
+
+#ifdef H5GEO_USE_MPI
+#include "../../include/h5geo/private/h5core_mpi.h"
+#endif
 
 namespace h5geo {
 
@@ -693,6 +698,7 @@ bool readSEGYTracesMMap(
     int nThreads,
     std::function<void(double)> progressCallback)
 {
+  H5GEO_PROFILE_SCOPE(prof, "h5geo::readSEGYTracesMMap");
   if (!seis || trcBuffer < 1)
     return false;
 
@@ -745,43 +751,15 @@ bool readSEGYTracesMMap(
   seis->setNTrc(fromTrc+nTrc);
   seis->setNSamp(nSamp);
 
-  Eigen::MatrixXd HDR;
-  Eigen::MatrixXf TRACE;
-  Eigen::VectorXd minHDRVec(78), maxHDRVec(78);
-  minHDRVec.fill(std::numeric_limits<double>::infinity());
-  maxHDRVec.fill(-std::numeric_limits<double>::infinity());
-
   size_t bytesPerTrc = 4 * nSamp + 240;
-  size_t J = trcBuffer;
   size_t N = nTrc / trcBuffer;
-  ptrdiff_t n_passed = 0;
-  double progressOld = 0;
-  double progressNew = 0;
-
-#ifdef H5GEO_USE_THREADS
-  if (nThreads < 1 || nThreads > omp_get_max_threads())
-    nThreads = omp_get_max_threads();
-#pragma omp parallel for num_threads(nThreads) private(HDR, TRACE, J)
-#endif
-  for (ptrdiff_t n = 0; n <= N; n++) {
-    if (progressCallback){
-      progressNew = n_passed / (double)N;
-      // update callback only if the difference >= 1% than the previous value
-      if (progressNew - progressOld >= 0.01){
-        progressCallback( progressNew );
-        progressOld = progressNew;
-      }
-    }
-
-    if (n < N) {
-      J = trcBuffer;
-    } else {
-      J = nTrc - N * trcBuffer;
-    }
-
-    if (J == 0)
-      continue;
 
+  // parse block `n` of `J` traces (traces are parsed in parallel if `nThreadsJ > 1`)
+  auto readBlock = [&](
+      ptrdiff_t n, size_t J, int nThreadsJ,
+      Eigen::MatrixXd& HDR, Eigen::MatrixXf& TRACE) -> bool
+  {
+    H5GEO_PROFILE_SCOPE(profDecode, "h5geo::readSEGYTracesMMap:decode");
     HDR.resize(J, 78);
     TRACE.resize(nSamp, J);
 
@@ -792,13 +770,16 @@ bool readSEGYTracesMMap(
     mio::mmap_sink rw_mmap = mio::make_mmap_sink(
           segy, memoryOffset, memorySize, err);
     if (err)
-      continue;
+      return false;
 
     short* m_short = h5geo::bit_cast<short *>(rw_mmap.data());
     int* m_int = h5geo::bit_cast<int *>(rw_mmap.data());
     float* m_float = h5geo::bit_cast<float *>(rw_mmap.data());
 
-    for (size_t j = 0; j < J; j++) {
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel for num_threads(nThreadsJ) if(nThreadsJ > 1)
+#endif
+    for (ptrdiff_t j = 0; j < ptrdiff_t(J); j++) {
       for (size_t i = 0; i < 7; i++) {
         HDR(j, mapHdr2origin[i]) = to_native_endian(m_int[j * bytesPerTrc / 4 + i], endian);
       }
@@ -841,29 +822,97 @@ bool readSEGYTracesMMap(
         }
       }
     }
+    H5GEO_PROFILE_ADD(profDecode, addBytesRead, memorySize);
+    H5GEO_PROFILE_ADD(profDecode, addItems, J);
+    return true;
+  };
+
+  auto blockSize = [&](ptrdiff_t n) -> size_t {
+    return size_t(n) < N ? trcBuffer : nTrc - N * trcBuffer;
+  };
+
+#ifdef H5GEO_USE_THREADS
+  if (nThreads < 1 || nThreads > omp_get_max_threads())
+    nThreads = omp_get_max_threads();
+#endif
+
+#ifdef H5GEO_USE_MPI
+  h5geo::MPIFileComm comm(seis->getH5File());
+  if (comm.isValid()){
+    // blocks are dealt round-robin: block `n = k*size + rank`;
+    // writes are collective thus every rank does the same number of
+    // iterations (rank without block writes nothing)
+    int rank = comm.getRank(), size = comm.getSize();
+    ptrdiff_t K = (N + size) / size;
+    bool ok = true;
+    for (ptrdiff_t k = 0; k < K; k++) {
+      if (progressCallback)
+        progressCallback( k / (double)K );
+
+      ptrdiff_t n = k * size + rank;
+      size_t J = size_t(n) <= N ? blockSize(n) : 0;
+      Eigen::MatrixXd HDR;
+      Eigen::MatrixXf TRACE;
+      // unreadable block is skipped (the same as in serial mode)
+      if (J > 0 && !readBlock(n, J, nThreads, HDR, TRACE))
+        J = 0;
+
+      HDR.conservativeResize(J, 78);
+      TRACE.conservativeResize(nSamp, J);
+      size_t blockFrom = fromTrc + (J > 0 ? n * trcBuffer : 0);
+      ok = seis->writeTraceHeader(HDR, blockFrom) && ok;
+      ok = seis->writeTrace(TRACE, blockFrom) && ok;
+    }
+
+    if (progressCallback)
+      progressCallback( double(1) );
+
+    return comm.all(ok);
+  }
+#endif
+
+  Eigen::MatrixXd HDR;
+  Eigen::MatrixXf TRACE;
+  ptrdiff_t n_passed = 0;
+  double progressOld = 0;
+  double progressNew = 0;
+
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel for num_threads(nThreads) private(HDR, TRACE)
+#endif
+  for (ptrdiff_t n = 0; n <= N; n++) {
+    if (progressCallback){
+      progressNew = n_passed / (double)N;
+      // update callback only if the difference >= 1% than the previous value
+      if (progressNew - progressOld >= 0.01){
+        progressCallback( progressNew );
+        progressOld = progressNew;
+      }
+    }
+
+    size_t J = blockSize(n);
+    if (J == 0)
+      continue;
+
+    if (!readBlock(n, J, 1, HDR, TRACE))
+      continue;
 
 #ifdef H5GEO_USE_THREADS
 #pragma omp critical
 #endif
     {
-      seis->writeTraceHeader(HDR, fromTrc);
-      seis->writeTrace(TRACE, fromTrc);
-      fromTrc = fromTrc + J;
+      // blocks are finished in any order thus the position is
+      // taken from block number
+      seis->writeTraceHeader(HDR, fromTrc + n * trcBuffer);
+      seis->writeTrace(TRACE, fromTrc + n * trcBuffer);
       n_passed++;
-
-      for (ptrdiff_t i = 0; i < HDR.rows(); i++) {
-        for (ptrdiff_t j = 0; j < HDR.cols(); j++) {
-          minHDRVec(j) = std::min(minHDRVec(j), HDR(i, j));
-          maxHDRVec(j) = std::max(maxHDRVec(j), HDR(i, j));
-        }
-      }
     }
-    rw_mmap.unmap();
   }
 
   if (progressCallback)
     progressCallback( double(1) );
 
+  H5GEO_PROFILE_ADD(prof, addItems, nTrc);
   return true;
 }
 
@@ -879,6 +928,7 @@ bool readSEGYTraces(
     size_t trcBuffer,
     std::function<void(double)> progressCallback)
 {
+  H5GEO_PROFILE_SCOPE(prof, "h5geo::readSEGYTraces");
   if (!seis || trcBuffer < 1)
     return false;
 
@@ -970,6 +1020,8 @@ bool readSEGYTraces(
     if (J == 0)
       continue;
 
+    // timing of the scope includes reading from the stream
+    H5GEO_PROFILE_SCOPE(profDecode, "h5geo::readSEGYTraces:decode");
     HDR.resize(J, 78);
     TRACE.resize(nSamp, J);
     for (size_t j = 0; j < J; j++) {
@@ -1044,6 +1096,9 @@ bool readSEGYTraces(
       }
     }
 
+    H5GEO_PROFILE_ADD(profDecode, addBytesRead, J*bytesPerTrc);
+    H5GEO_PROFILE_ADD(profDecode, addItems, J);
+
     seis->writeTraceHeader(HDR, fromTrc);
     seis->writeTrace(TRACE, fromTrc);
     fromTrc = fromTrc + J;
@@ -1060,6 +1115,7 @@ bool readSEGYTraces(
   if (progressCallback)
     progressCallback( double(1) );
 
+  H5GEO_PROFILE_ADD(prof, addItems, nTrc);
   return true;
 }
 
@@ -1122,54 +1178,50 @@ bool readSEGYSTACK(
       0, std::numeric_limits<size_t>::max(),
       nSamp, nTrc, endian).cast<double>();
 
-  Eigen::VectorX<ptrdiff_t> ind = h5geo::sort_rows(HDR);
-  Eigen::MatrixXd HDR_sorted = HDR(ind, Eigen::all);
-
-  double origin_x;
-  double origin_y;
-  double orientation;
-  double ilSpacing;
-  double xlSpacing;
-  bool isILReversed;
-  bool isXLReversed;
-  bool isPlanReversed;
-  bool status = h5geo::getSurveyInfoFromSortedData(
-        HDR_sorted.col(0),
-        HDR_sorted.col(1),
-        HDR_sorted.col(2),
-        HDR_sorted.col(3),
-        origin_x,
-        origin_y,
-        orientation,
-        ilSpacing,
-        xlSpacing,
-        isILReversed,
-        isXLReversed,
-        isPlanReversed);
-
-  if (!status)
+  // geometry is estimated in one pass without sorting headers
+  h5geo::SurveyInfoEstimator estimator;
+  estimator.add(HDR.col(0), HDR.col(1), HDR.col(2), HDR.col(3));
+
+  h5geo::SurveyInfo info;
+  if (!estimator.estimate(info) || !info.isRegular())
     return false;
 
-  // make plan normal by exchanging INLINE and XLINE headers
-  if (isPlanReversed){
-    HDR(Eigen::all, Eigen::seq(0,1)) = HDR(Eigen::all, Eigen::seq(1,0,Eigen::fix<-1>)).eval();
-    ind = h5geo::sort_rows(HDR);
-    HDR_sorted = HDR(ind, Eigen::all);
-  }
+  double origin_x = info.origin_x;
+  double origin_y = info.origin_y;
+  double orientation = info.orientation;
+  double ilSpacing = info.ilSpacing;
+  double xlSpacing = info.xlSpacing;
+  bool isILReversed = info.isILReversed;
+  bool isXLReversed = info.isXLReversed;
+  bool isPlanReversed = info.isPlanReversed;
+
+  // make plan normal by exchanging INLINE and XLINE
+  size_t nil = info.nIL;
+  size_t nxl = info.nXL;
+  if (isPlanReversed)
+    std::swap(nil, nxl);
+
+  // each trace is put to its grid cell: the same as IL_XL sort for
+  // regular grid but O(nTrc) and duplicates are detected
+  Eigen::VectorX<ptrdiff_t> cells =
+      h5geo::getSurveyCellIndexes(info, HDR.col(0), HDR.col(1));
+  if (cells.size() != HDR.rows())
+    return false;
 
-  // IL is sorted
-  size_t nxl = 0;
-  for (ptrdiff_t i = 0; i < HDR_sorted.rows(); i++){
-    nxl += 1;
-    if (HDR_sorted(i,0) != HDR_sorted(i+1,0))
-      break;
-  }
+  Eigen::VectorX<ptrdiff_t> ind = Eigen::VectorX<ptrdiff_t>::Constant(nTrc, -1);
+  for (ptrdiff_t i = 0; i < cells.size(); i++){
+    if (cells(i) < 0)
+      return false;
 
-  auto dv = std::div(HDR_sorted.rows(), nxl);
-  if (dv.rem != 0)
-    return false;
+    ptrdiff_t cell = cells(i);
+    if (isPlanReversed)
+      cell = (cell % info.nXL) * info.nIL + cell / info.nXL;
 
-  size_t nil = dv.quot;
+    if (ind(cell) >= 0)
+      return false;
+
+    ind(cell) = i;
+  }
 
   // Recreate volume dataset with optimal chunking.
   // Without this 2D volume may work extremely slow.
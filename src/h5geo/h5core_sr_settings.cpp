@@ -1,181 +1,573 @@
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/h5base.h"
 
-#include <units/units.hpp>
 #include <magic_enum.hpp>
 
 #include <gdal.h>
 #include <gdal_priv.h>
 
-#include <iostream>
+#include <array>
+#include <atomic>
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+#ifdef H5GEO_USE_THREADS
+#include <omp.h>
+#endif
 
 namespace h5geo {
 
 
-namespace sr {
+namespace {
+
+typedef std::array<std::string, 4> TransformKey; // srFrom, unitsFrom, srTo, unitsTo
+
+// incremented to invalidate caches of all threads
+std::atomic<size_t> transformsGeneration {0};
+
+// least recently used transformations are dropped when the cache is full
+constexpr size_t transformCacheSize = 64;
+typedef std::pair<TransformKey, OGRCT_ptr> TransformItem;
+
+struct ThreadTransforms
+{
+  size_t generation = 0;
+  std::list<TransformItem> lru; // most recently used first
+  std::map<TransformKey, std::list<TransformItem>::iterator> prototypes;
+};
+
+ThreadTransforms& threadTransforms(){
+  // OGRCoordinateTransformation isn't thread-safe and GDAL binds
+  // PROJ context to the thread where the object was created
+  thread_local ThreadTransforms t;
+  size_t generation = transformsGeneration.load();
+  if (t.generation != generation){
+    t.prototypes.clear();
+    t.lru.clear();
+    t.generation = generation;
+  }
+  return t;
+}
 
+OGRCoordinateTransformation* createCoordinateTransformationNoCache(
+    const std::string& srFrom,
+    const std::string& unitsFrom,
+    const std::string& srTo,
+    const std::string& unitsTo)
+{
+  double coefFrom = h5geo::getConversionFactor(unitsFrom, "meter");
+  if (isnan(coefFrom))
+    return nullptr;
 
-namespace {
+  double coefTo = h5geo::getConversionFactor(unitsTo, "meter");
+  if (isnan(coefTo))
+    return nullptr;
+
+  OGRSpatialReference sr_from, sr_to;
+  if (sr_from.SetFromUserInput(srFrom.c_str()) != OGRERR_NONE)
+    return nullptr;
+
+  if (sr_to.SetFromUserInput(srTo.c_str()) != OGRERR_NONE)
+    return nullptr;
+
+  if (sr_from.SetLinearUnitsAndUpdateParameters(unitsFrom.c_str(), coefFrom) != OGRERR_NONE)
+    return nullptr;
+
+  if (sr_to.SetLinearUnitsAndUpdateParameters(unitsTo.c_str(), coefTo) != OGRERR_NONE)
+    return nullptr;
+
+  return OGRCreateCoordinateTransformation(&sr_from, &sr_to);
+}
 
-bool ignoreCoordTransformOnFailure = false;
-OGRSpatialReference SpatialReference {};
-// GDAL sometimes is unable to retrieve AuthName, AuthCode and SRName 
-// info from OGRSpatialReference.
-// Thus we store these settings as strings
-std::string SRName {};
-std::string AuthName {};
-std::string AuthCode {};
-// even GDAL stores linear and angular units, if spatial reference is invalid
-// then GDAL gives 'unknown' length units and 'degree' angular units.
-// thus it is better to make a proxy variables to store these values
-std::string LengthUnits {};
-std::string AngularUnits {};
-std::string TemporalUnits {};
-std::string Domain {};
+template <typename D>
+bool transformCoord(
+    OGRCoordinateTransformation* coordTrans,
+    Eigen::MatrixBase<D>& x,
+    Eigen::MatrixBase<D>& y)
+{
+  OGRCT_ptr ct(coordTrans);
+  if (!ct)
+    return false;
+
+  if constexpr (std::is_same_v<typename D::Scalar, double>){
+    return ct->Transform(x.size(), x.derived().data(), y.derived().data());
+  } else {
+    Eigen::MatrixXd xx, yy;
+    xx = x.template cast<double>();
+    yy = y.template cast<double>();
+    if (!ct->Transform(xx.size(), xx.data(), yy.data()))
+      return false;
+
+    x = xx.template cast<typename D::Scalar>();
+    y = yy.template cast<typename D::Scalar>();
+    return true;
+  }
+}
 
 } // namespace
 
-void setIgnoreCoordTransformOnFailure(bool val){
-  ignoreCoordTransformOnFailure = val;
+
+OGRCoordinateTransformation* createCoordinateTransformation(
+    const std::string& srFrom,
+    const std::string& unitsFrom,
+    const std::string& srTo,
+    const std::string& unitsTo)
+{
+  ThreadTransforms& t = threadTransforms();
+  TransformKey key {srFrom, unitsFrom, srTo, unitsTo};
+  auto it = t.prototypes.find(key);
+  if (it != t.prototypes.end()){
+    t.lru.splice(t.lru.begin(), t.lru, it->second);
+  } else {
+    // failures are cached too: they are as expensive as successful calls
+    t.lru.emplace_front(key, OGRCT_ptr(createCoordinateTransformationNoCache(
+                                         srFrom, unitsFrom, srTo, unitsTo)));
+    it = t.prototypes.emplace(std::move(key), t.lru.begin()).first;
+    if (t.lru.size() > transformCacheSize){
+      t.prototypes.erase(t.lru.back().first);
+      t.lru.pop_back();
+    }
+  }
+
+  const OGRCT_ptr& prototype = it->second->second;
+  if (!prototype)
+    return nullptr;
+
+  return prototype->Clone();
 }
 
-bool getIgnoreCoordTransformOnFailure(){
-  return ignoreCoordTransformOnFailure;
+void clearCoordinateTransformations(){
+  transformsGeneration++;
 }
 
-void setSpatialReference(OGRSpatialReference sr){
-  SpatialReference = sr;
+bool transformCoordinates(
+    OGRCoordinateTransformation* coordTrans,
+    size_t n, double* x, double* y,
+    size_t chunkSize)
+{
+  if (!coordTrans)
+    return false;
+
+  if (chunkSize < 1)
+    chunkSize = n;
+
+  ptrdiff_t nChunks = chunkSize > 0 ? (n + chunkSize - 1) / chunkSize : 0;
+#ifdef H5GEO_USE_THREADS
+  int nThreads = std::min<ptrdiff_t>(omp_get_max_threads(), nChunks);
+#else
+  int nThreads = 1;
+#endif
+  if (nThreads < 2)
+    return coordTrans->Transform(n, x, y);
+
+  int failed = 0;
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel num_threads(nThreads) reduction(+:failed)
+#endif
+  {
+#ifdef H5GEO_USE_THREADS
+    int t = omp_get_thread_num();
+#else
+    int t = 0;
+#endif
+    // clone is created on the thread that uses it as GDAL binds it
+    // to the PROJ context of the creating thread
+    OGRCT_ptr threadClone;
+    if (t > 0){
+#ifdef H5GEO_USE_THREADS
+#pragma omp critical(h5geo_transform_clone)
+#endif
+      threadClone.reset(coordTrans->Clone());
+    }
+    OGRCoordinateTransformation* threadTrans = t > 0 ? threadClone.get() : coordTrans;
+
+    // `coordTrans` isn't used until all clones are made
+#ifdef H5GEO_USE_THREADS
+#pragma omp barrier
+#pragma omp for
+#endif
+    for (ptrdiff_t c = 0; c < nChunks; c++){
+      size_t from = c*chunkSize;
+      size_t count = std::min(chunkSize, n - from);
+      if (!threadTrans || !threadTrans->Transform(count, x + from, y + from))
+        failed++;
+    }
+  }
+  return failed == 0;
+}
+
+
+struct SRContext::Impl
+{
+  // OGRSpatialReference isn't thread-safe even for const methods
+  mutable std::mutex m;
+  bool ignoreCoordTransformOnFailure = false;
+  OGRSpatialReference SpatialReference {};
+  // user input or WKT: used to create coordinate transformations
+  std::string SRDefinition {};
+  // GDAL sometimes is unable to retrieve AuthName, AuthCode and SRName
+  // info from OGRSpatialReference.
+  // Thus we store these settings as strings
+  std::string SRName {};
+  std::string AuthName {};
+  std::string AuthCode {};
+  // even GDAL stores linear and angular units, if spatial reference is invalid
+  // then GDAL gives 'unknown' length units and 'degree' angular units.
+  // thus it is better to make a proxy variables to store these values
+  std::string LengthUnits {};
+  std::string AngularUnits {};
+  std::string TemporalUnits {};
+  std::string Domain {};
+
+  void copyFrom(const Impl& other){
+    ignoreCoordTransformOnFailure = other.ignoreCoordTransformOnFailure;
+    SpatialReference = other.SpatialReference;
+    SRDefinition = other.SRDefinition;
+    SRName = other.SRName;
+    AuthName = other.AuthName;
+    AuthCode = other.AuthCode;
+    LengthUnits = other.LengthUnits;
+    AngularUnits = other.AngularUnits;
+    TemporalUnits = other.TemporalUnits;
+    Domain = other.Domain;
+  }
+
+  void updateLengthUnits(){
+    double coef = h5geo::getConversionFactor(LengthUnits, "meter");
+    SpatialReference.SetLinearUnitsAndUpdateParameters(LengthUnits.c_str(), coef);
+  }
+
+  void updateAngularUnits(){
+    double coef = h5geo::getConversionFactor(AngularUnits, "radian");
+    SpatialReference.SetAngularUnits(AngularUnits.c_str(), coef);
+  }
+};
+
+SRContext::SRContext() :
+  d(std::make_unique<Impl>()){}
+
+SRContext::SRContext(const SRContext& other) :
+  d(std::make_unique<Impl>())
+{
+  std::scoped_lock lock(other.d->m);
+  d->copyFrom(*other.d);
+}
+
+SRContext& SRContext::operator=(const SRContext& other){
+  if (this != &other){
+    std::scoped_lock lock(d->m, other.d->m);
+    d->copyFrom(*other.d);
+  }
+  return *this;
+}
+
+SRContext::~SRContext() = default;
+
+void SRContext::setIgnoreCoordTransformOnFailure(bool val){
+  std::scoped_lock lock(d->m);
+  d->ignoreCoordTransformOnFailure = val;
+}
+
+bool SRContext::getIgnoreCoordTransformOnFailure() const {
+  std::scoped_lock lock(d->m);
+  return d->ignoreCoordTransformOnFailure;
+}
+
+void SRContext::setSpatialReference(const OGRSpatialReference& sr){
+  std::scoped_lock lock(d->m);
+  d->SpatialReference = sr;
+
+  char* wkt = nullptr;
+  d->SRDefinition.clear();
+  if (d->SpatialReference.exportToWkt(&wkt) == OGRERR_NONE && wkt)
+    d->SRDefinition = std::string(wkt);
+  CPLFree(wkt);
 
   // update length units
   const char *lengthUnits = nullptr;
-  SpatialReference.GetLinearUnits(&lengthUnits);
+  d->SpatialReference.GetLinearUnits(&lengthUnits);
   if (lengthUnits){
-    LengthUnits = std::string(lengthUnits);
+    d->LengthUnits = std::string(lengthUnits);
   }
 
-  // update temporal units
+  // update angular units
   const char *angularUnits = nullptr;
-  SpatialReference.GetAngularUnits(&angularUnits);
+  d->SpatialReference.GetAngularUnits(&angularUnits);
   if (angularUnits){
-    AngularUnits = std::string(angularUnits);
+    d->AngularUnits = std::string(angularUnits);
   }
 }
 
-void setSpatialReferenceFromUserInput(
+void SRContext::setSpatialReferenceFromUserInput(
     const std::string& name){
-  SRName = name;
-  SpatialReference.SetFromUserInput(name.c_str());
-
-  // update length units
-  h5geo::sr::setLengthUnits(LengthUnits);
-
-  // update angular units
-  h5geo::sr::setAngularUnits(AngularUnits);
+  std::scoped_lock lock(d->m);
+  d->SRName = name;
+  d->SRDefinition = name;
+  d->SpatialReference.SetFromUserInput(name.c_str());
+  d->updateLengthUnits();
+  d->updateAngularUnits();
 }
 
-void setSpatialReferenceFromUserInput(
+void SRContext::setSpatialReferenceFromUserInput(
     const std::string& authName, const std::string& code){
-  AuthName = authName;
-  AuthCode = code;
-  SpatialReference.SetFromUserInput((authName + ":" + code).c_str());
-
-  // update length units
-  h5geo::sr::setLengthUnits(LengthUnits);
+  std::scoped_lock lock(d->m);
+  d->AuthName = authName;
+  d->AuthCode = code;
+  d->SRDefinition = authName + ":" + code;
+  d->SpatialReference.SetFromUserInput(d->SRDefinition.c_str());
+  d->updateLengthUnits();
+  d->updateAngularUnits();
+}
 
-  // update angular units
-  h5geo::sr::setAngularUnits(AngularUnits);
+OGRSpatialReference SRContext::getSpatialReference() const {
+  std::scoped_lock lock(d->m);
+  return d->SpatialReference;
 }
 
-OGRSpatialReference getSpatialReference(){
-  return SpatialReference;
+std::string SRContext::getSpatialReferenceDefinition() const {
+  std::scoped_lock lock(d->m);
+  return d->SRDefinition;
 }
 
-void setLengthUnits(const std::string& units){
-  LengthUnits = units;
-  double coef = units::convert(
-      units::unit_from_string(units),
-      units::unit_from_string("meter"));
-  SpatialReference.SetLinearUnitsAndUpdateParameters(units.c_str(), coef);
+void SRContext::setLengthUnits(const std::string& units){
+  std::scoped_lock lock(d->m);
+  d->LengthUnits = units;
+  d->updateLengthUnits();
 }
 
-void setAngularUnits(const std::string& units){
-  AngularUnits = units;
-  double coef = units::convert(
-      units::unit_from_string(units),
-      units::unit_from_string("radian"));
-  SpatialReference.SetAngularUnits(units.c_str(), coef);
+void SRContext::setAngularUnits(const std::string& units){
+  std::scoped_lock lock(d->m);
+  d->AngularUnits = units;
+  d->updateAngularUnits();
 }
 
-void setTemporalUnits(const std::string& units){
-  TemporalUnits = units;
+void SRContext::setTemporalUnits(const std::string& units){
+  std::scoped_lock lock(d->m);
+  d->TemporalUnits = units;
 }
 
-std::string getAuthName(){
-  if (!AuthName.empty())
-    return AuthName;
+std::string SRContext::getAuthName() const {
+  std::scoped_lock lock(d->m);
+  if (!d->AuthName.empty())
+    return d->AuthName;
 
-  const char* authName = SpatialReference.GetAuthorityName(nullptr);
+  const char* authName = d->SpatialReference.GetAuthorityName(nullptr);
   if (authName)
     return std::string(authName);
 
   return std::string();
 }
 
-std::string getAuthCode(){
-  if (!AuthCode.empty())
-    return AuthCode;
+std::string SRContext::getAuthCode() const {
+  std::scoped_lock lock(d->m);
+  if (!d->AuthCode.empty())
+    return d->AuthCode;
 
-  const char* authCode = SpatialReference.GetAuthorityCode(nullptr);
+  const char* authCode = d->SpatialReference.GetAuthorityCode(nullptr);
   if (authCode)
     return std::string(authCode);
 
   return std::string();
 }
 
+std::string SRContext::getSRName() const {
+  std::scoped_lock lock(d->m);
+  return d->SRName;
+}
+
+std::string SRContext::getLengthUnits() const {
+  std::scoped_lock lock(d->m);
+  return d->LengthUnits;
+}
+
+std::string SRContext::getAngularUnits() const {
+  std::scoped_lock lock(d->m);
+  return d->AngularUnits;
+}
+
+std::string SRContext::getTemporalUnits() const {
+  std::scoped_lock lock(d->m);
+  return d->TemporalUnits;
+}
+
+void SRContext::setDomain(const std::string& domain){
+  std::scoped_lock lock(d->m);
+  d->Domain = domain;
+}
+
+void SRContext::setDomain(const h5geo::Domain& domain){
+  setDomain(std::string{magic_enum::enum_name(domain)});
+}
+
+std::string SRContext::getDomain() const {
+  std::scoped_lock lock(d->m);
+  return d->Domain;
+}
+
+h5geo::Domain SRContext::getDomainEnum() const {
+  auto domainEnum = magic_enum::enum_cast<h5geo::Domain>(getDomain());
+  if (!domainEnum.has_value())
+    return static_cast<h5geo::Domain>(0);
+
+  return domainEnum.value();
+}
+
+OGRCoordinateTransformation* SRContext::createCoordinateTransformationFrom(
+    const std::string& srFrom,
+    const std::string& unitsFrom,
+    const std::string& unitsTo) const
+{
+  return h5geo::createCoordinateTransformation(
+        srFrom, unitsFrom, getSpatialReferenceDefinition(), unitsTo);
+}
+
+OGRCoordinateTransformation* SRContext::createCoordinateTransformationTo(
+    const std::string& srTo,
+    const std::string& unitsTo,
+    const std::string& unitsFrom) const
+{
+  return h5geo::createCoordinateTransformation(
+        getSpatialReferenceDefinition(), unitsFrom, srTo, unitsTo);
+}
+
+bool SRContext::transformCoordFrom(
+    Eigen::Ref<Eigen::MatrixXd> x,
+    Eigen::Ref<Eigen::MatrixXd> y,
+    const std::string& unitsFrom,
+    const std::string& srAuthAndCodeFrom) const
+{
+  if (x.size() != y.size() || x.size() < 1)
+    return false;
+
+  return transformCoord(createCoordinateTransformationFrom(
+                          srAuthAndCodeFrom, unitsFrom, getLengthUnits()), x, y);
+}
+
+bool SRContext::transformCoordFrom(
+    Eigen::Ref<Eigen::MatrixXf> x,
+    Eigen::Ref<Eigen::MatrixXf> y,
+    const std::string& unitsFrom,
+    const std::string& srAuthAndCodeFrom) const
+{
+  if (x.size() != y.size() || x.size() < 1)
+    return false;
+
+  return transformCoord(createCoordinateTransformationFrom(
+                          srAuthAndCodeFrom, unitsFrom, getLengthUnits()), x, y);
+}
+
+bool SRContext::transformCoordTo(
+    Eigen::Ref<Eigen::MatrixXd> x,
+    Eigen::Ref<Eigen::MatrixXd> y,
+    const std::string& unitsTo,
+    const std::string& srAuthAndCodeTo) const
+{
+  if (x.size() != y.size() || x.size() < 1)
+    return false;
+
+  return transformCoord(createCoordinateTransformationTo(
+                          srAuthAndCodeTo, unitsTo, getLengthUnits()), x, y);
+}
+
+bool SRContext::transformCoordTo(
+    Eigen::Ref<Eigen::MatrixXf> x,
+    Eigen::Ref<Eigen::MatrixXf> y,
+    const std::string& unitsTo,
+    const std::string& srAuthAndCodeTo) const
+{
+  if (x.size() != y.size() || x.size() < 1)
+    return false;
+
+  return transformCoord(createCoordinateTransformationTo(
+                          srAuthAndCodeTo, unitsTo, getLengthUnits()), x, y);
+}
+
+
+namespace sr {
+
+
+std::shared_ptr<SRContext> getDefaultContext(){
+  static std::shared_ptr<SRContext> ctx = std::make_shared<SRContext>();
+  return ctx;
+}
+
+void setIgnoreCoordTransformOnFailure(bool val){
+  getDefaultContext()->setIgnoreCoordTransformOnFailure(val);
+}
+
+bool getIgnoreCoordTransformOnFailure(){
+  return getDefaultContext()->getIgnoreCoordTransformOnFailure();
+}
+
+void setSpatialReference(OGRSpatialReference sr){
+  getDefaultContext()->setSpatialReference(sr);
+}
+
+void setSpatialReferenceFromUserInput(
+    const std::string& name){
+  getDefaultContext()->setSpatialReferenceFromUserInput(name);
+}
+
+void setSpatialReferenceFromUserInput(
+    const std::string& authName, const std::string& code){
+  getDefaultContext()->setSpatialReferenceFromUserInput(authName, code);
+}
+
+OGRSpatialReference getSpatialReference(){
+  return getDefaultContext()->getSpatialReference();
+}
+
+void setLengthUnits(const std::string& units){
+  getDefaultContext()->setLengthUnits(units);
+}
+
+void setAngularUnits(const std::string& units){
+  getDefaultContext()->setAngularUnits(units);
+}
+
+void setTemporalUnits(const std::string& units){
+  getDefaultContext()->setTemporalUnits(units);
+}
+
+std::string getAuthName(){
+  return getDefaultContext()->getAuthName();
+}
+
+std::string getAuthCode(){
+  return getDefaultContext()->getAuthCode();
+}
+
 std::string getSRName(){
-  return SRName;
+  return getDefaultContext()->getSRName();
 }
 
 std::string getLengthUnits(){
-  return LengthUnits;
-  // const char *units = nullptr;
-  // SpatialReference.GetLinearUnits(&units);
-  // if (!units)
-  //   return std::string();
-  // return std::string(units);
+  return getDefaultContext()->getLengthUnits();
 }
 
 std::string getAngularUnits(){
-  return AngularUnits;
-  // const char *units = nullptr;
-  // SpatialReference.GetAngularUnits(&units);
-  // if (!units)
-  //   return std::string();
-  // return std::string(units);
+  return getDefaultContext()->getAngularUnits();
 }
 
 std::string getTemporalUnits(){
-  return TemporalUnits;
+  return getDefaultContext()->getTemporalUnits();
 }
 
 void setDomain(const std::string& domain){
-  Domain = domain;
+  getDefaultContext()->setDomain(domain);
 }
 
 void setDomain(const h5geo::Domain& domain){
-  Domain = std::string{magic_enum::enum_name(domain)};
+  getDefaultContext()->setDomain(domain);
 }
 
 std::string getDomain(){
-  return Domain;
+  return getDefaultContext()->getDomain();
 }
 
 h5geo::Domain getDomainEnum(){
-  auto domainEnum = magic_enum::enum_cast<h5geo::Domain>(Domain);
-  if (!domainEnum.has_value())
-    return static_cast<h5geo::Domain>(0);
-
-  return domainEnum.value();
+  return getDefaultContext()->getDomainEnum();
 }
 
 bool convertUnits(
@@ -184,9 +576,7 @@ bool convertUnits(
   if (unitsFrom.empty() || unitsTo.empty())
     return false;
 
-  double coef = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::unit_from_string(unitsTo));
+  double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
 
   if (isnan(coef))
     return false;
@@ -201,9 +591,7 @@ bool convertUnits(
   if (unitsFrom.empty() || unitsTo.empty())
     return false;
 
-  double coef = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::unit_from_string(unitsTo));
+  double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
 
   if (isnan(coef))
     return false;
@@ -218,29 +606,8 @@ bool transformCoordFrom(
     Eigen::Ref<Eigen::MatrixXd> y,
     const std::string& unitsFrom,
     const std::string& srAuthAndCodeFrom){
-  if (x.size() != y.size() || x.size() < 1)
-    return false;
-
-  double coefFrom = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::meter);
-
-  if (isnan(coefFrom))
-    return false;
-
-  OGRSpatialReference srFrom;
-  if (srFrom.SetFromUserInput(srAuthAndCodeFrom.c_str()) != OGRERR_NONE)
-    return false;
-
-  if (srFrom.SetLinearUnitsAndUpdateParameters(unitsFrom.c_str(), coefFrom) != OGRERR_NONE)
-    return false;
-
-  OGRSpatialReference srTo = h5geo::sr::getSpatialReference();
-  OGRCT_ptr coordTrans(OGRCreateCoordinateTransformation(&srFrom, &srTo));
-  if (!coordTrans)
-    return false;
-
-  return coordTrans->Transform(x.size(), x.data(), y.data());
+  return getDefaultContext()->transformCoordFrom(
+        x, y, unitsFrom, srAuthAndCodeFrom);
 }
 
 bool transformCoordFrom(
@@ -249,8 +616,8 @@ bool transformCoordFrom(
     const std::string& unitsFrom,
     const std::string& authNameFrom,
     const std::string& codeFrom){
-  std::string srAuthAndCodeTo = authNameFrom + ":" + codeFrom;
-  return transformCoordTo(x, y, unitsFrom, srAuthAndCodeTo);
+  std::string srAuthAndCodeFrom = authNameFrom + ":" + codeFrom;
+  return transformCoordFrom(x, y, unitsFrom, srAuthAndCodeFrom);
 }
 
 bool transformCoordFrom(
@@ -258,37 +625,8 @@ bool transformCoordFrom(
     Eigen::Ref<Eigen::MatrixXf> y,
     const std::string& unitsFrom,
     const std::string& srAuthAndCodeFrom){
-  if (x.size() != y.size() || x.size() < 1)
-    return false;
-
-  double coefFrom = units::convert(
-        units::unit_from_string(unitsFrom),
-        units::meter);
-
-  if (isnan(coefFrom))
-    return false;
-
-  OGRSpatialReference srFrom;
-  if (srFrom.SetFromUserInput(srAuthAndCodeFrom.c_str()) != OGRERR_NONE)
-    return false;
-
-  if (srFrom.SetLinearUnitsAndUpdateParameters(unitsFrom.c_str(), coefFrom) != OGRERR_NONE)
-    return false;
-
-  OGRSpatialReference srTo = h5geo::sr::getSpatialReference();
-  OGRCT_ptr coordTrans(OGRCreateCoordinateTransformation(&srFrom, &srTo));
-  if (!coordTrans)
-    return false;
-
-  Eigen::MatrixXd xx, yy;
-  xx = x.cast<double>();
-  yy = y.cast<double>();
-  if (!coordTrans->Transform(xx.size(), xx.data(), yy.data()))
-    return false;
-
-  x = xx.cast<float>();
-  y = yy.cast<float>();
-  return true;
+  return getDefaultContext()->transformCoordFrom(
+        x, y, unitsFrom, srAuthAndCodeFrom);
 }
 
 bool transformCoordFrom(
@@ -297,8 +635,8 @@ bool transformCoordFrom(
     const std::string& unitsFrom,
     const std::string& authNameFrom,
     const std::string& codeFrom){
-  std::string srAuthAndCodeTo = authNameFrom + ":" + codeFrom;
-  return transformCoordTo(x, y, unitsFrom, srAuthAndCodeTo);
+  std::string srAuthAndCodeFrom = authNameFrom + ":" + codeFrom;
+  return transformCoordFrom(x, y, unitsFrom, srAuthAndCodeFrom);
 }
 
 // Transform coord TO
@@ -307,29 +645,8 @@ bool transformCoordTo(
     Eigen::Ref<Eigen::MatrixXd> y,
     const std::string& unitsTo,
     const std::string& srAuthAndCodeTo){
-  if (x.size() != y.size() || x.size() < 1)
-    return false;
-
-  double coefTo = units::convert(
-        units::unit_from_string(unitsTo),
-        units::meter);
-
-  if (isnan(coefTo))
-    return false;
-
-  OGRSpatialReference srTo;
-  if (srTo.SetFromUserInput(srAuthAndCodeTo.c_str()) != OGRERR_NONE)
-    return false;
-
-  if (srTo.SetLinearUnitsAndUpdateParameters(unitsTo.c_str(), coefTo) != OGRERR_NONE)
-    return false;
-
-  OGRSpatialReference srFrom = h5geo::sr::getSpatialReference();
-  OGRCT_ptr coordTrans(OGRCreateCoordinateTransformation(&srFrom, &srTo));
-  if (!coordTrans)
-    return false;
-
-  return coordTrans->Transform(x.size(), x.data(), y.data());
+  return getDefaultContext()->transformCoordTo(
+        x, y, unitsTo, srAuthAndCodeTo);
 }
 
 bool transformCoordTo(
@@ -347,37 +664,8 @@ bool transformCoordTo(
     Eigen::Ref<Eigen::MatrixXf> y,
     const std::string& unitsTo,
     const std::string& srAuthAndCodeTo){
-  if (x.size() != y.size() || x.size() < 1)
-    return false;
-
-  double coefTo = units::convert(
-        units::unit_from_string(unitsTo),
-        units::meter);
-
-  if (isnan(coefTo))
-    return false;
-
-  OGRSpatialReference srTo;
-  if (srTo.SetFromUserInput(srAuthAndCodeTo.c_str()) != OGRERR_NONE)
-    return false;
-
-  if (srTo.SetLinearUnitsAndUpdateParameters(unitsTo.c_str(), coefTo) != OGRERR_NONE)
-    return false;
-
-  OGRSpatialReference srFrom = h5geo::sr::getSpatialReference();
-  OGRCT_ptr coordTrans(OGRCreateCoordinateTransformation(&srFrom, &srTo));
-  if (!coordTrans)
-    return false;
-
-  Eigen::MatrixXd xx, yy;
-  xx = x.cast<double>();
-  yy = y.cast<double>();
-  if (!coordTrans->Transform(xx.size(), xx.data(), yy.data()))
-    return false;
-
-  x = xx.cast<float>();
-  y = yy.cast<float>();
-  return true;
+  return getDefaultContext()->transformCoordTo(
+        x, y, unitsTo, srAuthAndCodeTo);
 }
 
 bool transformCoordTo(
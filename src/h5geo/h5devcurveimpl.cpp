@@ -5,7 +5,79 @@
 #include "../../include/h5geo/private/h5enum_string.h"
 #include "../../include/h5geo/private/h5deviation.h"
 
-#include <units/units.hpp>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+namespace fs = std::filesystem;
+
+namespace {
+
+// trajectories are cached by "file\npath\nunits\nstep" so that all
+// trajectories of a well share the prefix "file\nwellPath/";
+// least recently used trajectories are dropped when the cache is full
+constexpr size_t trajectoryCacheSize = 256;
+typedef std::pair<std::string, std::shared_ptr<const h5geo::Trajectory>> TrajectoryItem;
+std::mutex trajectoryMutex;
+std::list<TrajectoryItem> trajectoryLRU; // most recently used first
+std::map<std::string, std::list<TrajectoryItem>::iterator> trajectoryCache;
+
+// canonical name (the same file may be opened by different paths) plus
+// HDF5 file number so that recreated or reopened file doesn't get
+// trajectories cached for its previous instance
+std::string getFileKey(hid_t id){
+  ssize_t n = H5Fget_name(id, NULL, 0);
+  if (n < 1)
+    return std::string();
+
+  std::string name(n, '\0');
+  H5Fget_name(id, name.data(), n+1);
+  std::error_code ec;
+  fs::path path = fs::weakly_canonical(name, ec);
+  if (!ec)
+    name = path.string();
+
+#if H5_VERSION_GE(1, 12, 0)
+  unsigned long fileno = 0;
+  if (H5Fget_fileno(id, &fileno) < 0)
+    return std::string();
+  name += ":" + std::to_string(fileno);
+#endif
+  return name;
+}
+
+std::shared_ptr<const h5geo::Trajectory> findTrajectory(const std::string& key){
+  std::lock_guard<std::mutex> lock(trajectoryMutex);
+  auto it = trajectoryCache.find(key);
+  if (it == trajectoryCache.end())
+    return nullptr;
+
+  trajectoryLRU.splice(trajectoryLRU.begin(), trajectoryLRU, it->second);
+  return it->second->second;
+}
+
+void addTrajectory(
+    const std::string& key,
+    std::shared_ptr<const h5geo::Trajectory> trajectory)
+{
+  std::lock_guard<std::mutex> lock(trajectoryMutex);
+  auto it = trajectoryCache.find(key);
+  if (it != trajectoryCache.end()){
+    it->second->second = std::move(trajectory);
+    trajectoryLRU.splice(trajectoryLRU.begin(), trajectoryLRU, it->second);
+    return;
+  }
+
+  trajectoryLRU.emplace_front(key, std::move(trajectory));
+  trajectoryCache[key] = trajectoryLRU.begin();
+  if (trajectoryLRU.size() > trajectoryCacheSize){
+    trajectoryCache.erase(trajectoryLRU.back().first);
+    trajectoryLRU.pop_back();
+  }
+}
+
+} // namespace
 
 H5DevCurveImpl::H5DevCurveImpl(const h5gt::Group &group) :
   H5BaseObjectImpl(group){}
@@ -77,21 +149,21 @@ bool H5DevCurveImpl::writeCurve(
   if (!opt.has_value())
     return false;
 
+  if (name != h5geo::OWT){
+    auto optWellG = getParentG(h5geo::ObjectType::WELL);
+    if (optWellG.has_value())
+      invalidateTrajectories(optWellG.value());
+  }
+
   bool val;
   if (!units.empty()){
     double coef;
     if (name == h5geo::OWT){
-      coef = units::convert(
-            units::unit_from_string(units),
-            units::unit_from_string(getTemporalUnits()));
+      coef = h5geo::getConversionFactor(units, getTemporalUnits());
     } else if (name == h5geo::AZIM || name == h5geo::INCL){
-      coef = units::convert(
-            units::unit_from_string(getAngularUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getAngularUnits(), units);
     } else {
-      coef = units::convert(
-            units::unit_from_string(getLengthUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getLengthUnits(), units);
     }
 
     v *= coef;
@@ -102,7 +174,7 @@ bool H5DevCurveImpl::writeCurve(
           v,
           true);
 
-    objG.flush();
+    h5geo::flushUnlessBatch(objG.getFile());
     return val;
   }
 
@@ -112,7 +184,7 @@ bool H5DevCurveImpl::writeCurve(
         v,
         true);
 
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return val;
 }
 
@@ -209,18 +281,12 @@ Eigen::VectorXd H5DevCurveImpl::getCurve(
   if (!units.empty()){
     if (name == h5geo::AZIM ||
         name == h5geo::INCL){
-      coef = units::convert(
-            units::unit_from_string(getAngularUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getAngularUnits(), units);
     } else if (name == h5geo::OWT ||
                name == h5geo::TWT){
-      coef = units::convert(
-            units::unit_from_string(getTemporalUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getTemporalUnits(), units);
     } else {
-      coef = units::convert(
-            units::unit_from_string(getLengthUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getLengthUnits(), units);
     }
 
     if (isnan(coef))
@@ -281,6 +347,135 @@ Eigen::VectorXd H5DevCurveImpl::getCurve(
   return Eigen::VectorXd();
 }
 
+std::shared_ptr<const h5geo::Trajectory> H5DevCurveImpl::getTrajectory(
+    const std::string& lengthUnits,
+    double resampleStep,
+    bool doCoordTransform)
+{
+  std::string key;
+  if (!doCoordTransform){
+    std::string fileKey = getFileKey(objG.getId());
+    if (!fileKey.empty()){
+      key = fileKey + "\n" + objG.getPath() + "\n" +
+          lengthUnits + "\n" + std::to_string(resampleStep);
+      auto trajectory = findTrajectory(key);
+      if (trajectory)
+        return trajectory;
+    }
+  }
+
+  auto opt = getDevCurveD();
+  if (!opt.has_value())
+    return nullptr;
+
+  H5Well_ptr well(openWell());
+  if (!well)
+    return nullptr;
+
+  Eigen::VectorXd headXY = well->getHeadCoord(lengthUnits, doCoordTransform);
+  if (headXY.size() != 2)
+    return nullptr;
+
+  double kb = well->getKB(lengthUnits);
+  if (isnan(kb))
+    kb = 0;
+
+  double lengthCoef = 1, angularCoef = 1;
+  if (!lengthUnits.empty())
+    lengthCoef = h5geo::getConversionFactor(getLengthUnits(), lengthUnits);
+  if (!getAngularUnits().empty())
+    angularCoef = h5geo::getConversionFactor(getAngularUnits(), "radian");
+
+  if (isnan(lengthCoef) || isnan(angularCoef))
+    return nullptr;
+
+  std::vector<std::string> names = {
+    std::string{h5geo::MD},
+    std::string{h5geo::DX},
+    std::string{h5geo::DY},
+    std::string{h5geo::TVD},
+    std::string{h5geo::AZIM},
+    std::string{h5geo::INCL}};
+
+  Eigen::MatrixXd M;
+  try {
+    // read all curves with a single call: dataset is row-major
+    // {nCurves, nSamp} thus each curve is a column here
+    std::vector<size_t> dims = opt->getDimensions();
+    if (dims.size() != 2)
+      return nullptr;
+
+    Eigen::MatrixXd data(dims[1], dims[0]);
+    if (data.size() > 0)
+      opt->read(data.data());
+
+    M.resize(data.rows(), names.size());
+    for (size_t i = 0; i < names.size(); i++){
+      ptrdiff_t ind = h5geo::getIndexFromAttribute(opt.value(), names[i]);
+      if (ind < 0 || ind >= data.cols())
+        return nullptr;
+      M.col(i) = data.col(ind);
+    }
+  } catch (h5gt::Exception& err) {
+    return nullptr;
+  }
+
+  M.leftCols(4) *= lengthCoef;
+  M.rightCols(2) *= angularCoef;
+  M.col(1).array() += headXY(0);
+  M.col(2).array() += headXY(1);
+
+  auto trajectory = std::make_shared<const h5geo::Trajectory>(
+        h5geo::Trajectory(M, kb).resample(resampleStep));
+  if (!trajectory->isValid())
+    return nullptr;
+
+  if (!key.empty())
+    addTrajectory(key, trajectory);
+  return trajectory;
+}
+
+Eigen::MatrixXd H5DevCurveImpl::mdToXYTvd(
+    const Eigen::Ref<const Eigen::VectorXd>& md,
+    const std::string& lengthUnits,
+    bool minCurvature,
+    bool doCoordTransform)
+{
+  auto trajectory = getTrajectory(lengthUnits, 0, doCoordTransform);
+  if (!trajectory)
+    return Eigen::MatrixXd();
+
+  return trajectory->mdToXYTvd(md, minCurvature);
+}
+
+Eigen::VectorXd H5DevCurveImpl::tvdToMd(
+    const Eigen::Ref<const Eigen::VectorXd>& tvd,
+    const std::string& lengthUnits,
+    bool minCurvature)
+{
+  auto trajectory = getTrajectory(lengthUnits);
+  if (!trajectory)
+    return Eigen::VectorXd();
+
+  return trajectory->tvdToMd(tvd, minCurvature);
+}
+
+void H5DevCurveImpl::invalidateTrajectories(const h5gt::Group& wellG)
+{
+  std::string fileKey = getFileKey(wellG.getId());
+  if (fileKey.empty())
+    return;
+
+  std::string prefix = fileKey + "\n" + wellG.getPath() + "/";
+  std::lock_guard<std::mutex> lock(trajectoryMutex);
+  auto it = trajectoryCache.lower_bound(prefix);
+  while (it != trajectoryCache.end() &&
+         it->first.compare(0, prefix.size(), prefix) == 0){
+    trajectoryLRU.erase(it->second);
+    it = trajectoryCache.erase(it);
+  }
+}
+
 std::string H5DevCurveImpl::getRelativeName(){
   auto optWellG = getParentG(h5geo::ObjectType::WELL);
   if (!optWellG.has_value())
@@ -304,6 +499,20 @@ H5DevCurveParam H5DevCurveImpl::getParam()
   p.temporalUnits = getTemporalUnits();
   p.angularUnits = getAngularUnits();
   p.dataUnits = getDataUnits();
+
+  // H5DevCurveParam
+  auto dsetOpt = getDevCurveD();
+  if (!dsetOpt.has_value())
+    return p;
+
+  auto dsetCreateProps = dsetOpt->getCreateProps();
+  if (dsetCreateProps.isChunked()){
+    std::vector<hsize_t> chunkSizeVec = dsetCreateProps.getChunk(dsetOpt->getDimensions().size());
+    if (chunkSizeVec.size() > 1)
+      p.chunkSize = chunkSizeVec[1];
+  } else {
+    p.nSamp = dsetOpt->getDimensions()[1];
+  }
   return p;
 }
 
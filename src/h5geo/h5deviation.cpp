@@ -0,0 +1,64 @@
+#include "../../include/h5geo/private/h5deviation.h"
+
+#include <cmath>
+
+namespace h5geo
+{
+
+std::vector<Eigen::MatrixXd> traj2ALL(
+    const std::vector<Eigen::MatrixXd>& M,
+    const Eigen::Ref<const Eigen::VectorXd>& x0,
+    const Eigen::Ref<const Eigen::VectorXd>& y0,
+    const Eigen::Ref<const Eigen::VectorXd>& kb,
+    const std::string& angularUnitsFrom,
+    const std::string& angularUnitsTo,
+    const h5geo::TrajectoryFormat& trajFormat,
+    const bool& XNorth)
+{
+  ptrdiff_t nWell = M.size();
+  if (x0.size() != nWell ||
+      y0.size() != nWell ||
+      kb.size() != nWell)
+    return std::vector<Eigen::MatrixXd>();
+
+  // input angles are used only by `MD_AZIM_INCL` and they are
+  // returned in `angularUnitsFrom` if `angularUnitsTo` is empty
+  bool isMdAzIncl = trajFormat == h5geo::TrajectoryFormat::MD_AZIM_INCL;
+  std::string unitsTo = isMdAzIncl && angularUnitsTo.empty() ?
+        angularUnitsFrom : angularUnitsTo;
+
+  double coefFrom = 1, coefTo = 1;
+  if (isMdAzIncl && !angularUnitsFrom.empty())
+    coefFrom = h5geo::getConversionFactor(angularUnitsFrom, "radian");
+  if (!unitsTo.empty())
+    coefTo = h5geo::getConversionFactor("radian", unitsTo);
+
+  if (std::isnan(coefFrom) || std::isnan(coefTo))
+    return std::vector<Eigen::MatrixXd>();
+
+  std::vector<Eigen::MatrixXd> out(nWell);
+  // wells may have very different number of stations
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (ptrdiff_t i = 0; i < nWell; i++){
+    if (M[i].cols() != 3)
+      continue;
+
+    // empty units: the converters work in radians and parse nothing
+    if (isMdAzIncl){
+      Eigen::MatrixXd MM = M[i];
+      MM.rightCols(2) *= coefFrom;
+      out[i] = h5geo::MdAzIncl2ALL(MM, x0(i), y0(i), kb(i), "", "", XNorth);
+    } else {
+      out[i] = h5geo::traj2ALL(M[i], x0(i), y0(i), kb(i), "", "", trajFormat, XNorth);
+    }
+
+    if (out[i].cols() == 9)
+      out[i].rightCols(2) *= coefTo;
+  }
+  return out;
+}
+
+
+} // h5geo
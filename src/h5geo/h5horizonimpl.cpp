@@ -2,8 +2,6 @@
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/private/h5enum_string.h"
 
-#include <units/units.hpp>
-
 H5HorizonImpl::H5HorizonImpl(const h5gt::Group &group) :
   H5BaseObjectImpl(group){}
 
@@ -16,13 +14,23 @@ bool H5HorizonImpl::writeData(
   if (!opt.has_value())
     return false;
 
-  bool val = h5geo::overwriteResizableDataset(
-        objG,
-        opt->getPath(),
-        M,
-        unitsFrom, unitsTo);
+  bool val;
+  if (opt->getDataType().isTypeEqual(h5gt::AtomicType<float>())){
+    Eigen::MatrixXf MF = M.cast<float>();
+    val = h5geo::overwriteResizableDataset(
+          objG,
+          opt->getPath(),
+          MF,
+          unitsFrom, unitsTo);
+  } else {
+    val = h5geo::overwriteResizableDataset(
+          objG,
+          opt->getPath(),
+          M,
+          unitsFrom, unitsTo);
+  }
 
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return val;
 }
 
@@ -34,6 +42,12 @@ Eigen::MatrixXd H5HorizonImpl::getData(
   if (!opt.has_value())
     return Eigen::MatrixXd();
 
+  if (opt->getDataType().isTypeEqual(h5gt::AtomicType<float>()))
+    return h5geo::readFloatEigenMtxDataset(
+          objG,
+          opt->getPath(),
+          unitsFrom, unitsTo).cast<double>();
+
   return h5geo::readDoubleEigenMtxDataset(
         objG,
         opt->getPath(),
@@ -52,9 +66,7 @@ bool H5HorizonImpl::writeComponent(
 
   bool val;
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-          units::unit_from_string(unitsFrom),
-          units::unit_from_string(unitsTo));
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
 
     v *= coef;
   }
@@ -65,7 +77,7 @@ bool H5HorizonImpl::writeComponent(
         v,
         true);
 
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return val;
 }
 
@@ -82,9 +94,7 @@ Eigen::VectorXd H5HorizonImpl::getComponent(
         opt.value(), componentName);
 
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-          units::unit_from_string(unitsFrom),
-          units::unit_from_string(unitsTo));
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
 
     if (!std::isnan(coef))
       return v*coef;
@@ -109,7 +119,7 @@ bool H5HorizonImpl::setNPoints(size_t n)
       opt->resize({dims[0], n});
     else
       return false;
-    this->objG.flush();
+    h5geo::flushUnlessBatch(this->objG.getFile());
     return true;
   } catch (h5gt::Exception e) {
     return false;
@@ -128,7 +138,7 @@ bool H5HorizonImpl::setNComponents(size_t n)
       opt->resize({n, dims[1]});
     else
       return false;
-    this->objG.flush();
+    h5geo::flushUnlessBatch(this->objG.getFile());
     return true;
   } catch (h5gt::Exception e) {
     return false;
@@ -145,7 +155,7 @@ bool H5HorizonImpl::setComponents(const std::map<std::string, size_t>& component
   try {
     for (const auto& attrName : attrNames)
       dsetOpt->deleteAttribute(attrName);
-    dsetOpt->flush();
+    h5geo::flushUnlessBatch(this->objG.getFile());
   } catch (h5gt::Exception e) {
     return false;
   }
@@ -249,6 +259,9 @@ H5HorizonImpl::getParam()
     else if (chunkSizeVec.size() == 2)
       p.pointsChunkSize = chunkSizeVec[1];
   }
+
+  p.floatData = dsetOpt->getDataType().isTypeEqual(h5gt::AtomicType<float>());
+  p.compression_level = h5geo::getDeflateLevel(dsetCreateProps);
   return p;
 }
 
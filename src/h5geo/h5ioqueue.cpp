@@ -0,0 +1,70 @@
+#include "../../include/h5geo/private/h5ioqueue.h"
+
+namespace h5geo
+{
+
+IOQueue& IOQueue::instance(){
+  static IOQueue q;
+  return q;
+}
+
+IOQueue::IOQueue() :
+  worker(&IOQueue::run, this){}
+
+IOQueue::~IOQueue(){
+  {
+    std::lock_guard<std::mutex> lock(m);
+    stop = true;
+  }
+  cv.notify_all();
+  if (worker.joinable())
+    worker.join();
+}
+
+void IOQueue::post(std::function<void()> task){
+  {
+    std::lock_guard<std::mutex> lock(m);
+    tasks.push_back(std::move(task));
+  }
+  cv.notify_one();
+}
+
+void IOQueue::wait(){
+  // task waiting for the queue would never finish
+  if (isIOThread())
+    return;
+
+  submit([](){}).wait();
+}
+
+bool IOQueue::isIOThread() const {
+  return std::this_thread::get_id() == worker.get_id();
+}
+
+void IOQueue::run(){
+  for (;;){
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(m);
+      cv.wait(lock, [this](){ return stop || !tasks.empty(); });
+      // queued tasks are done before stop
+      if (tasks.empty())
+        return;
+      task = std::move(tasks.front());
+      tasks.pop_front();
+    }
+    // exception must not stop the thread (use `submit` to get it)
+    try {
+      task();
+    } catch (...) {}
+  }
+}
+
+
+std::recursive_mutex& HDF5Lock::mutex(){
+  static std::recursive_mutex m;
+  return m;
+}
+
+
+} // h5geo
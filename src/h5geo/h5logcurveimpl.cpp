@@ -4,8 +4,6 @@
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/private/h5enum_string.h"
 
-#include <units/units.hpp>
-
 #include <cmath>
 
 H5LogCurveImpl::H5LogCurveImpl(const h5gt::Group &group) :
@@ -32,13 +30,9 @@ bool H5LogCurveImpl::writeCurve(
   if (!units.empty()){
     double coef;
     if (name == h5geo::MD)
-      coef = units::convert(
-            units::unit_from_string(units),
-            units::unit_from_string(getLengthUnits()));
+      coef = h5geo::getConversionFactor(units, getLengthUnits());
     else
-      coef = units::convert(
-            units::unit_from_string(units),
-            units::unit_from_string(getDataUnits()));
+      coef = h5geo::getConversionFactor(units, getDataUnits());
 
     v *= coef;
 
@@ -48,7 +42,7 @@ bool H5LogCurveImpl::writeCurve(
           v,
           true);
 
-    objG.flush();
+    h5geo::flushUnlessBatch(objG.getFile());
     return val;
   }
 
@@ -58,7 +52,7 @@ bool H5LogCurveImpl::writeCurve(
         v,
         true);
 
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return val;
 }
 
@@ -99,13 +93,9 @@ Eigen::VectorXd H5LogCurveImpl::getCurve(
   if (!units.empty()){
     double coef;
     if (name == h5geo::MD)
-      coef = units::convert(
-            units::unit_from_string(getLengthUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getLengthUnits(), units);
     else
-      coef = units::convert(
-            units::unit_from_string(getDataUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getDataUnits(), units);
 
     if (!std::isnan(coef))
       return curve*coef;
@@ -139,6 +129,20 @@ H5LogCurveParam H5LogCurveImpl::getParam()
   p.temporalUnits = getTemporalUnits();
   p.angularUnits = getAngularUnits();
   p.dataUnits = getDataUnits();
+
+  // H5LogCurveParam
+  auto dsetOpt = getLogCurveD();
+  if (!dsetOpt.has_value())
+    return p;
+
+  auto dsetCreateProps = dsetOpt->getCreateProps();
+  if (dsetCreateProps.isChunked()){
+    std::vector<hsize_t> chunkSizeVec = dsetCreateProps.getChunk(dsetOpt->getDimensions().size());
+    if (chunkSizeVec.size() > 1)
+      p.chunkSize = chunkSizeVec[1];
+  } else {
+    p.nSamp = dsetOpt->getDimensions()[1];
+  }
   return p;
 }
 
@@ -3,15 +3,18 @@
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/private/h5enum_string.h"
 
-#include <units/units.hpp>
-
 #ifdef H5GEO_USE_GDAL
 #include <gdal.h>
 #include <gdal_priv.h>
 #endif
 
 H5MapImpl::H5MapImpl(const h5gt::Group &group) :
-  H5BaseObjectImpl(group){}
+  H5BaseObjectImpl(group),
+  dataBatch([this](
+            const std::vector<DataRequest>& reqs,
+            std::vector<std::promise<Eigen::MatrixXd>>& proms){
+  processDataRequests(reqs, proms);
+}){}
 
 #ifdef H5GEO_USE_GDAL
 bool H5MapImpl::readRasterCoordinates(
@@ -132,31 +135,150 @@ bool H5MapImpl::writeData(
     Eigen::Ref<Eigen::MatrixXd> M,
     const std::string& dataUnits)
 {
+  dataBatch.wait();
   auto opt = getMapD();
   if (!opt.has_value())
     return false;
 
-  bool val = h5geo::overwriteResizableDataset(
-        objG,
-        opt->getPath(),
-        M,
-        dataUnits, getDataUnits());
+  bool val;
+  if (opt->getDataType().isTypeEqual(h5gt::AtomicType<float>())){
+    Eigen::MatrixXf MF = M.cast<float>();
+    val = h5geo::overwriteResizableDataset(
+          objG,
+          opt->getPath(),
+          MF,
+          dataUnits, getDataUnits());
+  } else {
+    val = h5geo::overwriteResizableDataset(
+          objG,
+          opt->getPath(),
+          M,
+          dataUnits, getDataUnits());
+  }
 
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return val;
 }
 
 Eigen::MatrixXd H5MapImpl::getData(const std::string& dataUnits){
+  dataBatch.wait();
   auto opt = getMapD();
   if (!opt.has_value())
     return Eigen::MatrixXd();
 
+  if (opt->getDataType().isTypeEqual(h5gt::AtomicType<float>()))
+    return h5geo::readFloatEigenMtxDataset(
+          objG,
+          opt->getPath(),
+          getDataUnits(), dataUnits).cast<double>();
+
   return h5geo::readDoubleEigenMtxDataset(
         objG,
         opt->getPath(),
         getDataUnits(), dataUnits);
 }
 
+bool H5MapImpl::writeData(
+    Eigen::Ref<Eigen::MatrixXd> M,
+    const size_t& iX0,
+    const size_t& iY0,
+    const std::string& dataUnits)
+{
+  dataBatch.wait();
+  auto opt = getMapD();
+  if (!opt.has_value())
+    return false;
+
+  std::vector<size_t> dims = opt->getDimensions();
+  if (dims.size() != 2 ||
+      M.size() < 1 ||
+      iX0+M.rows() > dims[1] ||
+      iY0+M.cols() > dims[0])
+    return false;
+
+  double coef = 1;
+  std::string unitsTo = getDataUnits();
+  if (!unitsTo.empty() && !dataUnits.empty()){
+    coef = h5geo::getConversionFactor(dataUnits, unitsTo);
+    if (std::isnan(coef))
+      return false;
+  }
+
+  // don't modify user's data: it is scaled by parts while writing
+  return h5geo::writeScaledHyperslab(
+        *opt, {iY0, iX0},
+        {size_t(M.cols()), size_t(M.rows())}, M.data(), coef);
+}
+
+Eigen::MatrixXd H5MapImpl::getData(
+    const size_t& iX0,
+    const size_t& iY0,
+    const size_t& nX,
+    const size_t& nY,
+    const size_t& stride,
+    const std::string& dataUnits)
+{
+  dataBatch.wait();
+  auto opt = getMapD();
+  if (!opt.has_value())
+    return Eigen::MatrixXd();
+
+  std::vector<size_t> dims = opt->getDimensions();
+  if (dims.size() != 2 ||
+      nX < 1 || nY < 1 || stride < 1 ||
+      iX0+nX > dims[1] ||
+      iY0+nY > dims[0])
+    return Eigen::MatrixXd();
+
+  // number of nodes after decimation
+  size_t nXs = (nX + stride - 1) / stride;
+  size_t nYs = (nY + stride - 1) / stride;
+  Eigen::MatrixXd M(nXs, nYs);
+  try {
+    opt->select({iY0, iX0},
+                {nYs, nXs},
+                {stride, stride}).read(M.data());
+  } catch (h5gt::Exception& err) {
+    return Eigen::MatrixXd();
+  }
+
+  if (!dataUnits.empty()){
+    double coef = h5geo::getConversionFactor(getDataUnits(), dataUnits);
+    if (std::isnan(coef))
+      return Eigen::MatrixXd();
+
+    // in place: no second full-size matrix
+    if (coef != 1)
+      M *= coef;
+  }
+
+  return M;
+}
+
+std::future<Eigen::MatrixXd> H5MapImpl::getDataAsync(
+    const size_t& iX0,
+    const size_t& iY0,
+    const size_t& nX,
+    const size_t& nY,
+    const size_t& stride,
+    const std::string& dataUnits)
+{
+  return dataBatch.enqueue(
+        DataRequest{iX0, iY0, nX, nY, stride, dataUnits});
+}
+
+void H5MapImpl::processDataRequests(
+    const std::vector<DataRequest>& reqs,
+    std::vector<std::promise<Eigen::MatrixXd>>& proms)
+{
+  // decimated windows are rarely adjacent: read them one by one
+  for (size_t i = 0; i < reqs.size(); i++)
+    proms[i].set_value(getData(
+                         reqs[i].iX0, reqs[i].iY0,
+                         reqs[i].nX, reqs[i].nY,
+                         reqs[i].stride, reqs[i].dataUnits));
+}
+
 bool H5MapImpl::setDomain(const h5geo::Domain& val){
   return h5geo::overwriteEnumAttribute(
         objG,
@@ -178,7 +300,7 @@ bool H5MapImpl::setOrigin(
             objG,
             std::string{h5geo::detail::origin},
             v);
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
   }
@@ -204,7 +326,7 @@ bool H5MapImpl::setPoint1(
             objG,
             std::string{h5geo::detail::point1},
             v);
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
   }
@@ -229,7 +351,7 @@ bool H5MapImpl::setPoint2(
             objG,
             std::string{h5geo::detail::point2},
             v);
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
   }
@@ -295,7 +417,14 @@ bool H5MapImpl::removeAttributeMap(const std::string& name){
   if (!objG.hasObject(name, h5gt::ObjectType::Group))
     return false;
 
-  objG.unlink(name);
+  // child map (not a link to other map) is in the catalog
+  std::string path = objG.getPath() + "/" + name;
+  try {
+    objG.unlink(name);
+  } catch (h5gt::Exception& err) {
+    return false;
+  }
+  h5geo::removeFromCatalog(objG.getFile(), path);
   return true;
 }
 
@@ -345,7 +474,7 @@ Eigen::VectorXd H5MapImpl::getOrigin(
 
       coordTrans->Transform(1, &v(0), &v(1));
       return v;
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return Eigen::VectorXd();
     }
   }
@@ -374,7 +503,7 @@ Eigen::VectorXd H5MapImpl::getPoint1(
 
       coordTrans->Transform(1, &v(0), &v(1));
       return v;
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return Eigen::VectorXd();
     }
   }
@@ -403,7 +532,7 @@ Eigen::VectorXd H5MapImpl::getPoint2(
 
       coordTrans->Transform(1, &v(0), &v(1));
       return v;
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return Eigen::VectorXd();
     }
   }
@@ -488,6 +617,9 @@ H5MapParam H5MapImpl::getParam()
     }
   }
 
+  p.floatData = dsetOpt->getDataType().isTypeEqual(h5gt::AtomicType<float>());
+  p.compression_level = h5geo::getDeflateLevel(dsetCreateProps);
+
   return p;
 }
 
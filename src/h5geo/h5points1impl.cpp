@@ -4,8 +4,6 @@
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/private/h5enum_string.h"
 
-#include <units/units.hpp>
-
 #ifdef H5GEO_USE_GDAL
 #include <gdal.h>
 #include <gdal_priv.h>
@@ -87,7 +85,7 @@ bool H5Points1Impl<TBase>::overwritePointsDataset(
   try {
     opt->resize({data.size()});
     opt->write_raw(data.data(), h5geo::create_compound_Point1());
-    this->objG.flush();
+    h5geo::flushUnlessBatch(this->objG.getFile());
     return true;
   } catch (h5gt::Exception e) {
     return false;
@@ -109,9 +107,7 @@ bool H5Points1Impl<TBase>::transformPoints(
       !lengthUnitsTo.empty() &&
       domain != h5geo::Domain::OWT &&
       domain != h5geo::Domain::TWT){
-    coef = units::convert(
-          units::unit_from_string(lengthUnitsFrom),
-          units::unit_from_string(lengthUnitsTo));
+    coef = h5geo::getConversionFactor(lengthUnitsFrom, lengthUnitsTo);
     for (auto& point : data){
       point.p[0] *= coef;
     }
@@ -121,9 +117,7 @@ bool H5Points1Impl<TBase>::transformPoints(
       !temporalUnitsTo.empty() &&
       (domain == h5geo::Domain::OWT ||
        domain == h5geo::Domain::TWT)){
-    coef = units::convert(
-          units::unit_from_string(temporalUnitsFrom),
-          units::unit_from_string(temporalUnitsTo));
+    coef = h5geo::getConversionFactor(temporalUnitsFrom, temporalUnitsTo);
     for (auto& point : data){
       point.p[0] *= coef;
     }
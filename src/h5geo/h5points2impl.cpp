@@ -3,8 +3,6 @@
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/private/h5enum_string.h"
 
-#include <units/units.hpp>
-
 #ifdef H5GEO_USE_GDAL
 #include <gdal.h>
 #include <gdal_priv.h>
@@ -84,7 +82,7 @@ bool H5Points2Impl<TBase>::overwritePointsDataset(
   try {
     opt->resize({data.size()});
     opt->write_raw(data.data(), h5geo::create_compound_Point2());
-    this->objG.flush();
+    h5geo::flushUnlessBatch(this->objG.getFile());
     return true;
   } catch (h5gt::Exception e) {
     return false;
@@ -114,7 +112,7 @@ bool H5Points2Impl<TBase>::transformPoints(
         coordTrans->Transform(1, &point.p[0], &point.p[1]);
 
       return true;
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
   }
@@ -123,9 +121,7 @@ bool H5Points2Impl<TBase>::transformPoints(
   double coef;
   if (!lengthUnitsFrom.empty() &&
       !lengthUnitsTo.empty()){
-    coef = units::convert(
-          units::unit_from_string(lengthUnitsFrom),
-          units::unit_from_string(lengthUnitsTo));
+    coef = h5geo::getConversionFactor(lengthUnitsFrom, lengthUnitsTo);
     for (auto& point : data){
       point.p[0] *= coef;
       point.p[1] *= coef;
@@ -3,8 +3,6 @@
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/private/h5enum_string.h"
 
-#include <units/units.hpp>
-
 #ifdef H5GEO_USE_GDAL
 #include <gdal.h>
 #include <gdal_priv.h>
@@ -100,7 +98,7 @@ bool H5Points4Impl<TBase>::overwritePointsDataset(
   try {
     opt->resize({data.size()});
     opt->write_raw(data.data(), h5geo::create_compound_Point4());
-    this->objG.flush();
+    h5geo::flushUnlessBatch(this->objG.getFile());
     return true;
   } catch (h5gt::Exception e) {
     return false;
@@ -133,7 +131,7 @@ bool H5Points4Impl<TBase>::transformPoints(
     if (coordTrans){
       for (auto& point : data)
         coordTrans->Transform(1, &point.p[0], &point.p[1]);
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
 
@@ -142,9 +140,7 @@ bool H5Points4Impl<TBase>::transformPoints(
         !lengthUnitsTo.empty() &&
         domain != h5geo::Domain::OWT &&
         domain != h5geo::Domain::TWT){
-      coef = units::convert(
-            units::unit_from_string(lengthUnitsFrom),
-            units::unit_from_string(lengthUnitsTo));
+      coef = h5geo::getConversionFactor(lengthUnitsFrom, lengthUnitsTo);
       for (auto& point : data)
         point.p[2] *= coef;
     }
@@ -153,18 +149,14 @@ bool H5Points4Impl<TBase>::transformPoints(
         !temporalUnitsTo.empty() &&
         (domain == h5geo::Domain::OWT ||
          domain == h5geo::Domain::TWT)){
-      coef = units::convert(
-            units::unit_from_string(temporalUnitsFrom),
-            units::unit_from_string(temporalUnitsTo));
+      coef = h5geo::getConversionFactor(temporalUnitsFrom, temporalUnitsTo);
       for (auto& point : data)
         point.p[2] *= coef;
     }
 
     if (!dataUnitsFrom.empty() &&
         !dataUnitsTo.empty()){
-      coef = units::convert(
-            units::unit_from_string(dataUnitsFrom),
-            units::unit_from_string(dataUnitsTo));
+      coef = h5geo::getConversionFactor(dataUnitsFrom, dataUnitsTo);
       for (auto& point : data)
         point.p[3] *= coef;
     }
@@ -176,9 +168,7 @@ bool H5Points4Impl<TBase>::transformPoints(
   double coef;
   if (!lengthUnitsFrom.empty() &&
       !lengthUnitsTo.empty()){
-    coef = units::convert(
-          units::unit_from_string(lengthUnitsFrom),
-          units::unit_from_string(lengthUnitsTo));
+    coef = h5geo::getConversionFactor(lengthUnitsFrom, lengthUnitsTo);
     if (domain == h5geo::Domain::OWT ||
         domain == h5geo::Domain::TWT){
       for (auto& point : data){
@@ -198,18 +188,14 @@ bool H5Points4Impl<TBase>::transformPoints(
       !temporalUnitsTo.empty() &&
       (domain == h5geo::Domain::OWT ||
        domain == h5geo::Domain::TWT)){
-    coef = units::convert(
-          units::unit_from_string(temporalUnitsFrom),
-          units::unit_from_string(temporalUnitsTo));
+    coef = h5geo::getConversionFactor(temporalUnitsFrom, temporalUnitsTo);
     for (auto& point : data)
       point.p[2] *= coef;
   }
 
   if (!dataUnitsFrom.empty() &&
       !dataUnitsTo.empty()){
-    coef = units::convert(
-          units::unit_from_string(dataUnitsFrom),
-          units::unit_from_string(dataUnitsTo));
+    coef = h5geo::getConversionFactor(dataUnitsFrom, dataUnitsTo);
     for (auto& point : data)
       point.p[3] *= coef;
   }
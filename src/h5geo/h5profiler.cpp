@@ -0,0 +1,144 @@
+#include "../../include/h5geo/private/h5profiler.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace h5geo
+{
+
+namespace {
+
+// operation names are literals but escape them anyway
+std::string toJSONString(const char* str){
+  std::string out("\"");
+  for (const char* c = str; *c; c++){
+    if (*c == '"' || *c == '\\')
+      out += '\\';
+    if (static_cast<unsigned char>(*c) >= 0x20)
+      out += *c;
+  }
+  out += '"';
+  return out;
+}
+
+} // namespace
+
+
+Profiler& Profiler::instance(){
+  static Profiler p;
+  return p;
+}
+
+Profiler::Profiler() :
+  origin(std::chrono::steady_clock::now()){}
+
+bool Profiler::isCompiled(){
+#ifdef H5GEO_USE_PROFILING
+  return true;
+#else
+  return false;
+#endif
+}
+
+void Profiler::setEnabled(bool val){
+  enabled.store(val, std::memory_order_relaxed);
+}
+
+void Profiler::setTraceEnabled(bool val, size_t maxEvents){
+  std::lock_guard<std::mutex> lock(m);
+  traceEnabled = val;
+  this->maxEvents = maxEvents;
+}
+
+bool Profiler::isTraceEnabled() const {
+  std::lock_guard<std::mutex> lock(m);
+  return traceEnabled;
+}
+
+void Profiler::record(
+    const char* name,
+    std::chrono::steady_clock::time_point start,
+    std::chrono::steady_clock::time_point end,
+    const ProfileCounter& delta)
+{
+  double sec = std::chrono::duration<double>(end - start).count();
+  std::lock_guard<std::mutex> lock(m);
+  ProfileCounter& c = counters[name];
+  c.calls++;
+  c.seconds += sec;
+  c.maxSeconds = std::max(c.maxSeconds, sec);
+  c.bytesRead += delta.bytesRead;
+  c.bytesWritten += delta.bytesWritten;
+  c.selections += delta.selections;
+  c.items += delta.items;
+
+  if (!traceEnabled)
+    return;
+
+  if (events.size() >= maxEvents){
+    droppedEvents++;
+    return;
+  }
+
+  Event e;
+  e.name = name;
+  e.ts = std::chrono::duration_cast<std::chrono::microseconds>(start - origin).count();
+  e.dur = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+  e.tid = getThreadIndex(std::this_thread::get_id());
+  e.bytesRead = delta.bytesRead;
+  e.bytesWritten = delta.bytesWritten;
+  e.items = delta.items;
+  events.push_back(e);
+}
+
+std::map<std::string, ProfileCounter> Profiler::snapshot() const {
+  std::lock_guard<std::mutex> lock(m);
+  return counters;
+}
+
+void Profiler::reset(){
+  std::lock_guard<std::mutex> lock(m);
+  counters.clear();
+  events.clear();
+  threads.clear();
+  droppedEvents = 0;
+  origin = std::chrono::steady_clock::now();
+}
+
+bool Profiler::writeChromeTrace(const std::string& fileName) const {
+  std::ofstream file(fileName, std::ios::trunc);
+  if (!file.is_open())
+    return false;
+
+  std::lock_guard<std::mutex> lock(m);
+  file << "{\"traceEvents\":[";
+  for (size_t i = 0; i < events.size(); i++){
+    const Event& e = events[i];
+    if (i > 0)
+      file << ",";
+    file << "\n{\"name\":" << toJSONString(e.name)
+         << ",\"cat\":\"h5geo\",\"ph\":\"X\",\"pid\":0"
+         << ",\"tid\":" << e.tid
+         << ",\"ts\":" << e.ts
+         << ",\"dur\":" << e.dur
+         << ",\"args\":{\"bytesRead\":" << e.bytesRead
+         << ",\"bytesWritten\":" << e.bytesWritten
+         << ",\"items\":" << e.items << "}}";
+  }
+  file << "\n],\"displayTimeUnit\":\"ms\""
+       << ",\"otherData\":{\"droppedEvents\":" << droppedEvents << "}}\n";
+  return file.good();
+}
+
+size_t Profiler::getThreadIndex(std::thread::id id){
+  auto it = threads.find(id);
+  if (it != threads.end())
+    return it->second;
+
+  size_t ind = threads.size();
+  threads[id] = ind;
+  return ind;
+}
+
+
+} // h5geo
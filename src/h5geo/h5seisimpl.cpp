@@ -1,8 +1,12 @@
 #include "../../include/h5geo/private/h5seisimpl.h"
 #include "../../include/h5geo/private/h5volimpl.h"
 #include "../../include/h5geo/h5seiscontainer.h"
+#include "../../include/h5geo/h5horizon.h"
+#include "../../include/h5geo/h5map.h"
+#include "../../include/h5geo/h5mapcontainer.h"
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/private/h5enum_string.h"
+#include "../../include/h5geo/private/h5profiler.h"
 
 #include <fstream>
 #include <climits>
@@ -10,8 +14,9 @@
 #include <cmath>
 #include <algorithm>
 #include <iterator>
-
-#include <units/units.hpp>
+#include <numeric>
+#include <future>
+#include <tuple>
 
 #ifdef H5GEO_USE_GDAL
 #include <gdal.h>
@@ -21,7 +26,16 @@
 H5SeisImpl::H5SeisImpl(const h5gt::Group &group) :
   H5BaseObjectImpl(group),
   traceD(objG.getDataSet("trace")),
-  traceHeaderD(objG.getDataSet("trace_header")){}
+  traceHeaderD(objG.getDataSet("trace_header")),
+  traceBatch([this](
+             const std::vector<TraceRequest>& reqs,
+             std::vector<std::promise<Eigen::MatrixXf>>& proms){
+  processTraceRequests(reqs, proms);
+}){
+#ifdef H5GEO_USE_MPI
+  mpiIO = h5geo::isMPIFile(objG.getFile());
+#endif
+}
 
 bool H5SeisImpl::readSEGYTextHeader(
     const std::string& segy,
@@ -183,7 +197,7 @@ bool H5SeisImpl::writeTextHeader(const char (&txtHdr)[40][80]){
     return false;
 
   opt->write(txtHdr);
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return true;
 }
 
@@ -210,7 +224,7 @@ bool H5SeisImpl::writeTextHeader(
   }
 
   opt->write(array);
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return true;
 }
 
@@ -221,7 +235,7 @@ bool H5SeisImpl::writeBinHeader(const double (&binHdr)[30])
     return false;
 
   opt->write(binHdr);
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return true;
 }
 
@@ -236,7 +250,7 @@ bool H5SeisImpl::writeBinHeader(
     return false;
 
   opt->write(binHdrVec);
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return true;
 }
 
@@ -251,7 +265,7 @@ bool H5SeisImpl::writeBinHeader(
     return false;
 
   opt->write_raw(binHdrVec.data());
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return true;
 }
 
@@ -271,9 +285,7 @@ bool H5SeisImpl::writeBinHeader(
     return false;
 
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-          units::unit_from_string(unitsFrom),
-          units::unit_from_string(unitsTo));
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
     opt->select({size_t(ind)}, {1}).write(value*coef);
     return true;
   }
@@ -288,23 +300,55 @@ bool H5SeisImpl::writeTrace(
     const size_t& fromSampInd,
     const std::string& dataUnits)
 {
+  traceBatch.wait();
+  H5GEO_PROFILE_SCOPE(prof, "H5Seis::writeTrace");
+  H5GEO_PROFILE_ADD(prof, addSelections, 1);
+#ifdef H5GEO_USE_MPI
+  if (mpiIO){
+    bool val = (TRACE.cols() < 2 || TRACE.outerStride() == TRACE.rows()) &&
+        fromTrc+TRACE.cols() <= getNTrc() &&
+        TRACE.rows()+fromSampInd <= getNSamp();
+    std::string unitsTo = getDataUnits();
+    double coef = 1;
+    if (val && !unitsTo.empty() && !dataUnits.empty()){
+      coef = h5geo::getConversionFactor(dataUnits, unitsTo);
+      val = !isnan(coef);
+    }
+    // collective write is done by a single call on every rank thus
+    // the block can't be written by parts: scale a copy instead
+    Eigen::MatrixXf scaled;
+    if (val && coef != 1)
+      scaled = TRACE*coef;
+    // rank with invalid block still takes part in collective write
+    return h5geo::writeCollective(
+          traceD, {fromTrc, fromSampInd},
+          {val ? (size_t)TRACE.cols() : 0, (size_t)TRACE.rows()},
+          scaled.size() > 0 ? scaled.data() : TRACE.data()) && val;
+  }
+#endif
+
   if (fromTrc+TRACE.cols() > getNTrc())
     return false;
 
   if (TRACE.rows()+fromSampInd > getNSamp())
     return false;
 
+  double coef = 1;
   std::string unitsTo = getDataUnits();
   if (!unitsTo.empty() && !dataUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(dataUnits),
-          units::unit_from_string(unitsTo));
-    TRACE = TRACE*coef;
+    coef = h5geo::getConversionFactor(dataUnits, unitsTo);
+    if (isnan(coef))
+      return false;
   }
 
-  traceD.select({fromTrc, fromSampInd},
-                {(size_t)TRACE.cols(),
-                 (size_t)TRACE.rows()}).write_raw(TRACE.data());
+  // user's data isn't modified
+  if (!h5geo::writeScaledHyperslab(
+        traceD, {fromTrc, fromSampInd},
+        {(size_t)TRACE.cols(), (size_t)TRACE.rows()},
+        TRACE.data(), coef))
+    return false;
+  H5GEO_PROFILE_ADD(prof, addBytesWritten, TRACE.size()*sizeof(float));
+  H5GEO_PROFILE_ADD(prof, addItems, TRACE.cols());
   return true;
 }
 
@@ -314,18 +358,20 @@ bool H5SeisImpl::writeTrace(
     const size_t& fromSampInd,
     const std::string& dataUnits)
 {
+  traceBatch.wait();
+  H5GEO_PROFILE_SCOPE(prof, "H5Seis::writeTrace(rows)");
   if (trcInd.size() < 1 || TRACE.cols() != trcInd.size())
     return false;
 
   if (TRACE.rows()+fromSampInd > getNSamp())
     return false;
 
+  double coef = 1;
   std::string unitsTo = getDataUnits();
   if (!unitsTo.empty() && !dataUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(dataUnits),
-          units::unit_from_string(unitsTo));
-    TRACE = TRACE*coef;
+    coef = h5geo::getConversionFactor(dataUnits, unitsTo);
+    if (isnan(coef))
+      return false;
   }
 
   // copy Eigen vector to std::vector
@@ -337,7 +383,14 @@ bool H5SeisImpl::writeTrace(
   // Selection by rows may break the order of rows as it 
   // works with sequentially increasing order.
   // Thus  we should rearrange Eigen columns before writing.
-  traceD.select_rows(rows, fromSampInd, TRACE.rows()).write_raw(TRACE(Eigen::all, sortInd).eval().data());
+  // Units are applied to the rearranged copy (user's data isn't modified).
+  Eigen::MatrixXf sorted = TRACE(Eigen::all, sortInd);
+  if (coef != 1)
+    sorted *= coef;
+  traceD.select_rows(rows, fromSampInd, TRACE.rows()).write_raw(sorted.data());
+  H5GEO_PROFILE_ADD(prof, addSelections, 1);
+  H5GEO_PROFILE_ADD(prof, addBytesWritten, TRACE.size()*sizeof(float));
+  H5GEO_PROFILE_ADD(prof, addItems, TRACE.cols());
 
   return true;
 }
@@ -347,6 +400,26 @@ bool H5SeisImpl::writeTraceHeader(
     const size_t& fromTrc,
     const size_t& fromHdrInd)
 {
+  traceBatch.wait();
+  H5GEO_PROFILE_SCOPE(prof, "H5Seis::writeTraceHeader");
+  H5GEO_PROFILE_ADD(prof, addSelections, 1);
+#ifdef H5GEO_USE_MPI
+  if (mpiIO){
+    bool val = (HDR.cols() < 2 || HDR.outerStride() == HDR.rows()) &&
+        fromTrc+HDR.rows() <= getNTrc() &&
+        HDR.cols()+fromHdrInd <= getNTrcHdr();
+    // rank with invalid block still takes part in collective write
+    val = h5geo::writeCollective(
+          traceHeaderD, {fromHdrInd, fromTrc},
+          {val ? (size_t)HDR.cols() : 0, (size_t)HDR.rows()},
+          HDR.data()) && val;
+    // header range must be the same on every rank (removal is collective)
+    removeBoundaryIfXYChanged(fromHdrInd, HDR.cols());
+    removeCompositeSortsIfHdrChanged(fromHdrInd, HDR.cols());
+    return val;
+  }
+#endif
+
   if (fromTrc+HDR.rows() > getNTrc())
     return false;
 
@@ -356,6 +429,10 @@ bool H5SeisImpl::writeTraceHeader(
   traceHeaderD.select({fromHdrInd, fromTrc},
                       {(size_t)HDR.cols(),
                        (size_t)HDR.rows()}).write_raw(HDR.data());
+  H5GEO_PROFILE_ADD(prof, addBytesWritten, HDR.size()*sizeof(double));
+  H5GEO_PROFILE_ADD(prof, addItems, HDR.rows());
+  removeBoundaryIfXYChanged(fromHdrInd, HDR.cols());
+  removeCompositeSortsIfHdrChanged(fromHdrInd, HDR.cols());
   return true;
 }
 
@@ -366,20 +443,25 @@ bool H5SeisImpl::writeTraceHeader(
     const std::string& unitsFrom,
     const std::string& unitsTo)
 {
+  traceBatch.wait();
   ptrdiff_t hdrInd = getTraceHeaderIndex(hdrName);
   if (hdrInd < 0)
     return false;
 
+  double coef = 1;
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-          units::unit_from_string(unitsFrom),
-          units::unit_from_string(unitsTo));
-    hdr = hdr*coef;
+    coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
+    if (isnan(coef))
+      return false;
   }
 
-  traceHeaderD.select({size_t(hdrInd), fromTrc},
-                      {(size_t)1,
-                       (size_t)hdr.size()}).write_raw(hdr.data());
+  // user's data isn't modified
+  if (!h5geo::writeScaledHyperslab(
+        traceHeaderD, {size_t(hdrInd), fromTrc},
+        {(size_t)1, (size_t)hdr.size()}, hdr.data(), coef))
+    return false;
+  removeBoundaryIfXYChanged(hdrInd);
+  removeCompositeSortsIfHdrChanged(hdrInd);
   return true;
 }
 
@@ -390,6 +472,7 @@ bool H5SeisImpl::writeTraceHeader(
     const std::string& unitsFrom,
     const std::string& unitsTo)
 {
+  traceBatch.wait();
   ptrdiff_t hdrInd = getTraceHeaderIndex(hdrName);
   if (hdrInd < 0 || hdrInd >= getNTrcHdr())
     return false;
@@ -399,13 +482,18 @@ bool H5SeisImpl::writeTraceHeader(
 
   h5gt::ElementSet elSet = h5geo::rowCols2ElementSet(hdrInd, trcInd);
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-          units::unit_from_string(unitsFrom),
-          units::unit_from_string(unitsTo));
-    hdr = hdr*coef;
-  }
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
+    if (isnan(coef))
+      return false;
 
-  traceHeaderD.select(elSet).write_raw(hdr.data());
+    // scale a copy of the header (user's data isn't modified)
+    Eigen::MatrixXd scaled = hdr*coef;
+    traceHeaderD.select(elSet).write_raw(scaled.data());
+  } else {
+    traceHeaderD.select(elSet).write_raw(hdr.data());
+  }
+  removeBoundaryIfXYChanged(hdrInd);
+  removeCompositeSortsIfHdrChanged(hdrInd);
   return true;
 }
 
@@ -416,6 +504,7 @@ bool H5SeisImpl::writeXYTraceHeaders(
     const std::string& lengthUnits,
     bool doCoordTransform)
 {
+  traceBatch.wait();
   if (xyHdrNames.size() != 2 ||
       xy.cols() != 2)
     return false;
@@ -433,34 +522,47 @@ bool H5SeisImpl::writeXYTraceHeaders(
   if (doCoordTransform){
     OGRCT_ptr coordTrans(createCoordinateTransformationToWriteData(lengthUnits));
     if (coordTrans){
-      coordTrans->Transform(xy.rows(), xy.col(0).data(), xy.col(1).data());
+      // transform a copy (user's data isn't modified)
+      Eigen::MatrixX2d xyTransformed = xy;
+      h5geo::transformCoordinates(coordTrans.get(), xyTransformed.rows(),
+                                  xyTransformed.col(0).data(), xyTransformed.col(1).data());
       traceHeaderD.select({size_t(hdrInd_0), fromTrc},
                           {(size_t)1,
-                          (size_t)xy.size()}).write_raw(xy.col(0).data());
+                          (size_t)xy.rows()}).write_raw(xyTransformed.col(0).data());
       traceHeaderD.select({size_t(hdrInd_1), fromTrc},
                           {(size_t)1,
-                          (size_t)xy.size()}).write_raw(xy.col(1).data());
+                          (size_t)xy.rows()}).write_raw(xyTransformed.col(1).data());
+      removeBoundaryIfXYChanged(hdrInd_0);
+      removeCompositeSortsIfHdrChanged(hdrInd_0);
+      removeBoundaryIfXYChanged(hdrInd_1);
+      removeCompositeSortsIfHdrChanged(hdrInd_1);
       return true;
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
   }
 #endif
 
+  double coef = 1;
   std::string unitsTo = getLengthUnits();
   if (!unitsTo.empty() && !lengthUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(lengthUnits),
-          units::unit_from_string(unitsTo));
-    xy = xy*coef;
-  }
-
-  traceHeaderD.select({size_t(hdrInd_0), fromTrc},
-                      {(size_t)1,
-                       (size_t)xy.size()}).write_raw(xy.col(0).data());
-  traceHeaderD.select({size_t(hdrInd_1), fromTrc},
-                      {(size_t)1,
-                       (size_t)xy.size()}).write_raw(xy.col(1).data());
+    coef = h5geo::getConversionFactor(lengthUnits, unitsTo);
+    if (isnan(coef))
+      return false;
+  }
+
+  // user's data isn't modified
+  if (!h5geo::writeScaledHyperslab(
+        traceHeaderD, {size_t(hdrInd_0), fromTrc},
+        {(size_t)1, (size_t)xy.rows()}, xy.col(0).data(), coef) ||
+      !h5geo::writeScaledHyperslab(
+        traceHeaderD, {size_t(hdrInd_1), fromTrc},
+        {(size_t)1, (size_t)xy.rows()}, xy.col(1).data(), coef))
+    return false;
+  removeBoundaryIfXYChanged(hdrInd_0);
+  removeCompositeSortsIfHdrChanged(hdrInd_0);
+  removeBoundaryIfXYChanged(hdrInd_1);
+  removeCompositeSortsIfHdrChanged(hdrInd_1);
   return true;
 }
 
@@ -471,6 +573,7 @@ bool H5SeisImpl::writeXYTraceHeaders(
     const std::string& lengthUnits,
     bool doCoordTransform)
 {
+  traceBatch.wait();
   if (xyHdrNames.size() != 2)
     return false;
 
@@ -489,11 +592,18 @@ bool H5SeisImpl::writeXYTraceHeaders(
   if (doCoordTransform){
     OGRCT_ptr coordTrans(createCoordinateTransformationToWriteData(lengthUnits));
     if (coordTrans){
-      coordTrans->Transform(xy.rows(), xy.col(0).data(), xy.col(1).data());
-      traceHeaderD.select(elSet_0).write_raw(xy.col(0).data());
-      traceHeaderD.select(elSet_1).write_raw(xy.col(1).data());
+      // transform a copy (user's data isn't modified)
+      Eigen::MatrixX2d xyTransformed = xy;
+      h5geo::transformCoordinates(coordTrans.get(), xyTransformed.rows(),
+                                  xyTransformed.col(0).data(), xyTransformed.col(1).data());
+      traceHeaderD.select(elSet_0).write_raw(xyTransformed.col(0).data());
+      traceHeaderD.select(elSet_1).write_raw(xyTransformed.col(1).data());
+      removeBoundaryIfXYChanged(hdrInd_0);
+      removeCompositeSortsIfHdrChanged(hdrInd_0);
+      removeBoundaryIfXYChanged(hdrInd_1);
+      removeCompositeSortsIfHdrChanged(hdrInd_1);
       return true;
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
   }
@@ -501,17 +611,134 @@ bool H5SeisImpl::writeXYTraceHeaders(
 
   std::string unitsTo = getLengthUnits();
   if (!unitsTo.empty() && !lengthUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(lengthUnits),
-          units::unit_from_string(unitsTo));
-    xy = xy*coef;
-  }
+    double coef = h5geo::getConversionFactor(lengthUnits, unitsTo);
+    if (isnan(coef))
+      return false;
 
-  traceHeaderD.select(elSet_0).write_raw(xy.col(0).data());
-  traceHeaderD.select(elSet_1).write_raw(xy.col(1).data());
+    // scale a copy (user's data isn't modified)
+    Eigen::MatrixX2d scaled = xy*coef;
+    traceHeaderD.select(elSet_0).write_raw(scaled.col(0).data());
+    traceHeaderD.select(elSet_1).write_raw(scaled.col(1).data());
+  } else {
+    traceHeaderD.select(elSet_0).write_raw(xy.col(0).data());
+    traceHeaderD.select(elSet_1).write_raw(xy.col(1).data());
+  }
+  removeBoundaryIfXYChanged(hdrInd_0);
+  removeCompositeSortsIfHdrChanged(hdrInd_0);
+  removeBoundaryIfXYChanged(hdrInd_1);
+  removeCompositeSortsIfHdrChanged(hdrInd_1);
   return true;
 }
 
+bool H5SeisImpl::reprojectXYTraceHeaders(
+    const std::string& srTo,
+    const std::vector<std::pair<std::string, std::string>>& xyHdrNames,
+    size_t nTrcBuffer)
+{
+#ifdef H5GEO_USE_GDAL
+  if (nTrcBuffer < 1 || xyHdrNames.empty())
+    return false;
+
+  // headers are stored in pairs: `X`, `Y`, `X`, `Y`...
+  std::vector<size_t> hdrInd;
+  for (const auto& xyHdrName : xyHdrNames){
+    ptrdiff_t hdrInd_0 = getTraceHeaderIndex(xyHdrName.first);
+    ptrdiff_t hdrInd_1 = getTraceHeaderIndex(xyHdrName.second);
+    if (hdrInd_0 < 0 || hdrInd_0 >= getNTrcHdr() ||
+        hdrInd_1 < 0 || hdrInd_1 >= getNTrcHdr())
+      return false;
+    hdrInd.push_back(hdrInd_0);
+    hdrInd.push_back(hdrInd_1);
+  }
+
+  // seis has single CRS: it is changed only when every XY pair is reprojected
+  bool allPairs = true;
+  for (const auto& xyPair : std::vector<std::pair<std::string, std::string>>{
+       {"SRCX", "SRCY"}, {"GRPX", "GRPY"}, {"CDP_X", "CDP_Y"}}){
+    if (std::find(xyHdrNames.begin(), xyHdrNames.end(), xyPair) == xyHdrNames.end())
+      allPairs = false;
+  }
+
+  std::string lengthUnits = getLengthUnits();
+  OGRCT_ptr coordTrans(h5geo::createCoordinateTransformation(
+                         getSpatialReference(), lengthUnits, srTo, lengthUnits));
+  if (!coordTrans)
+    return false;
+
+  size_t nTrc = getNTrc();
+  size_t nHdr = hdrInd.size();
+
+  // each column is a header of the block
+  Eigen::MatrixXd hdrBuf[2];
+
+  auto readBlock = [&](size_t fromTrc, size_t b)->bool{
+    size_t n = std::min(nTrcBuffer, nTrc - fromTrc);
+    hdrBuf[b].resize(n, nHdr);
+    try {
+      for (size_t i = 0; i < nHdr; i++)
+        traceHeaderD.select({hdrInd[i], fromTrc}, {1, n}).read(hdrBuf[b].col(i).data());
+    } catch (h5gt::Exception& err) {
+      return false;
+    }
+    return true;
+  };
+
+#ifdef H5GEO_USE_THREADS
+  std::launch readPolicy = std::launch::async;
+#else
+  std::launch readPolicy = std::launch::deferred;
+#endif
+
+  for (size_t i = 0; i < nHdr; i++){
+    removeBoundaryIfXYChanged(hdrInd[i]);
+    removeCompositeSortsIfHdrChanged(hdrInd[i]);
+  }
+
+  // must be declared after everything `readBlock` refers to: on early
+  // return its destructor waits until the running read is finished
+  std::future<bool> nextRead;
+  if (nTrc > 0)
+    nextRead = std::async(readPolicy, readBlock, 0, 0);
+
+  for (size_t fromTrc = 0, b = 0; fromTrc < nTrc; fromTrc += nTrcBuffer, b = 1-b){
+    if (!nextRead.get())
+      return false;
+
+    if (fromTrc + nTrcBuffer < nTrc)
+      nextRead = std::async(readPolicy, readBlock, fromTrc + nTrcBuffer, 1-b);
+
+    Eigen::MatrixXd& hdr = hdrBuf[b];
+    bool transformed = true;
+    for (size_t i = 0; i < nHdr; i += 2)
+      transformed = h5geo::transformCoordinates(
+            coordTrans.get(), hdr.rows(), hdr.col(i).data(), hdr.col(i+1).data()) &&
+          transformed;
+
+    // HDF5 calls must not overlap: wait until the next block is read
+    if (nextRead.valid())
+      nextRead.wait();
+
+    // failed points are set to `HUGE_VAL`: the block isn't written back
+    if (!transformed)
+      return false;
+
+    try {
+      for (size_t i = 0; i < nHdr; i++)
+        traceHeaderD.select({hdrInd[i], fromTrc}, {1, size_t(hdr.rows())}).write_raw(hdr.col(i).data());
+    } catch (h5gt::Exception& err) {
+      return false;
+    }
+  }
+
+  if (!allPairs)
+    return true;
+
+  return setSpatialReference(srTo);
+#else
+  return false;
+#endif
+}
+
 bool H5SeisImpl::setNTrc(size_t nTrc)
 {
   std::vector<size_t> trcHdrDims = traceHeaderD.getDimensions();
@@ -524,6 +751,8 @@ bool H5SeisImpl::setNTrc(size_t nTrc)
   try {
     traceHeaderD.resize({trcHdrDims[0], nTrc});
     traceD.resize({nTrc, trcDims[1]});
+    removeBoundary();
+    removeCompositeSortsIfHdrChanged(0, trcHdrDims[0]);
     return true;
   } catch (h5gt::Exception e) {
     return false;
@@ -609,9 +838,7 @@ double H5SeisImpl::getBinHeader(
   opt->select({size_t(ind)}, {1}).read(hdr);
 
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-          units::unit_from_string(unitsFrom),
-          units::unit_from_string(unitsTo));
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
     return hdr*coef;
   }
 
@@ -623,6 +850,7 @@ Eigen::MatrixXf H5SeisImpl::getTrace(
     const size_t& fromSampInd, size_t nSamp,
     const std::string& dataUnits)
 {
+  traceBatch.wait();
   if (!checkTraceLimits(fromTrc, nTrc))
     return Eigen::MatrixXf();
 
@@ -630,22 +858,129 @@ Eigen::MatrixXf H5SeisImpl::getTrace(
     return Eigen::MatrixXf();
 
   Eigen::MatrixXf TRACE(nSamp, nTrc);
+  if (!readTrace(TRACE, fromTrc, fromSampInd, dataUnits))
+    return Eigen::MatrixXf();
+
+  return TRACE;
+}
+
+bool H5SeisImpl::readTrace(
+    Eigen::Ref<Eigen::MatrixXf> TRACE,
+    const size_t& fromTrc,
+    const size_t& fromSampInd,
+    const std::string& dataUnits)
+{
+  H5GEO_PROFILE_SCOPE(prof, "H5Seis::readTrace");
+  H5GEO_PROFILE_ADD(prof, addSelections, 1);
+  size_t nTrc = TRACE.cols();
+  size_t nSamp = TRACE.rows();
+  bool val = (TRACE.cols() < 2 || TRACE.outerStride() == TRACE.rows()) &&
+      fromTrc + nTrc <= getNTrc() &&
+      fromSampInd + nSamp <= getNSamp();
+
+  double coef = 1;
+  if (val && !dataUnits.empty()){
+    coef = h5geo::getConversionFactor(getDataUnits(), dataUnits);
+    val = !isnan(coef);
+  }
+
+#ifdef H5GEO_USE_MPI
+  if (mpiIO){
+    // rank with invalid block still takes part in collective read
+    val = h5geo::readCollective(
+          traceD, {fromTrc, fromSampInd},
+          {val ? nTrc : 0, nSamp}, TRACE.data()) && val;
+    if (val && coef != 1)
+      TRACE *= coef;
+    return val;
+  }
+#endif
+
+  if (!val)
+    return false;
+
+  if (TRACE.size() < 1)
+    return true;
 
   std::vector<size_t> offset({fromTrc, fromSampInd});
   std::vector<size_t> count({nTrc, nSamp});
 
-  traceD.select(offset, count).read(TRACE.data());
-  if (!dataUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(getDataUnits()),
-          units::unit_from_string(dataUnits));
-    if (!isnan(coef))
-      return TRACE*coef;
+  try {
+    traceD.select(offset, count).read(TRACE.data());
+  } catch (h5gt::Exception& err) {
+    return false;
+  }
+  H5GEO_PROFILE_ADD(prof, addBytesRead, TRACE.size()*sizeof(float));
+  H5GEO_PROFILE_ADD(prof, addItems, nTrc);
 
-    return Eigen::MatrixXf();
+  if (coef != 1){
+    H5GEO_PROFILE_SCOPE(profUnits, "H5Seis::readTrace:units");
+    TRACE *= coef;
   }
 
-  return TRACE;
+  return true;
+}
+
+std::future<Eigen::MatrixXf> H5SeisImpl::getTraceAsync(
+    const size_t& fromTrc, size_t nTrc,
+    const size_t& fromSampInd, size_t nSamp,
+    const std::string& dataUnits)
+{
+  // limits are checked on the I/O thread as they need HDF5 calls
+  return traceBatch.enqueue(
+        TraceRequest{fromTrc, nTrc, fromSampInd, nSamp, dataUnits});
+}
+
+void H5SeisImpl::processTraceRequests(
+    const std::vector<TraceRequest>& reqs,
+    std::vector<std::promise<Eigen::MatrixXf>>& proms)
+{
+  std::vector<TraceRequest> r(reqs);
+  std::vector<size_t> ind;
+  ind.reserve(r.size());
+  for (size_t i = 0; i < r.size(); i++){
+    if (!checkTraceLimits(r[i].fromTrc, r[i].nTrc) ||
+        !checkSampleLimits(r[i].fromSampInd, r[i].nSamp))
+      proms[i].set_value(Eigen::MatrixXf());
+    else
+      ind.push_back(i);
+  }
+
+  std::sort(ind.begin(), ind.end(), [&r](size_t a, size_t b){
+    return std::tie(r[a].fromSampInd, r[a].nSamp, r[a].dataUnits, r[a].fromTrc) <
+        std::tie(r[b].fromSampInd, r[b].nSamp, r[b].dataUnits, r[b].fromTrc);
+  });
+
+  for (size_t i = 0; i < ind.size();){
+    // requests with the same samples window whose trace ranges
+    // overlap or touch each other are read by one hyperslab
+    const TraceRequest& first = r[ind[i]];
+    size_t toTrc = first.fromTrc + first.nTrc;
+    size_t j = i+1;
+    for (; j < ind.size(); j++){
+      const TraceRequest& next = r[ind[j]];
+      if (next.fromSampInd != first.fromSampInd ||
+          next.nSamp != first.nSamp ||
+          next.dataUnits != first.dataUnits ||
+          next.fromTrc > toTrc)
+        break;
+      toTrc = std::max(toTrc, next.fromTrc + next.nTrc);
+    }
+
+    Eigen::MatrixXf TRACE(first.nSamp, toTrc - first.fromTrc);
+    bool val = readTrace(TRACE, first.fromTrc, first.fromSampInd, first.dataUnits);
+    for (size_t k = i; k < j; k++){
+      if (!val)
+        proms[ind[k]].set_value(Eigen::MatrixXf());
+      else if (j-i == 1)
+        proms[ind[k]].set_value(std::move(TRACE));
+      else
+        proms[ind[k]].set_value(TRACE.middleCols(
+                                  r[ind[k]].fromTrc - first.fromTrc,
+                                  r[ind[k]].nTrc));
+    }
+    i = j;
+  }
 }
 
 Eigen::MatrixXf H5SeisImpl::getTrace(
@@ -654,6 +989,7 @@ Eigen::MatrixXf H5SeisImpl::getTrace(
     size_t nSamp,
     const std::string& dataUnits)
 {
+  traceBatch.wait();
   if (trcInd.size() < 1 || trcInd.maxCoeff() >= getNTrc())
     return Eigen::MatrixXf();
 
@@ -667,8 +1003,12 @@ Eigen::MatrixXf H5SeisImpl::getTrace(
   // Selection by rows may break the order of rows as it 
   // works with sequentially increasing order.
   // Thus after using it we should rearrange Eigen columns after reading.
+  H5GEO_PROFILE_SCOPE(prof, "H5Seis::getTrace(rows)");
   Eigen::MatrixXf TRACE(nSamp, trcInd.size());
   traceD.select_rows(rows, fromSampInd, nSamp).read(TRACE.data());
+  H5GEO_PROFILE_ADD(prof, addSelections, 1);
+  H5GEO_PROFILE_ADD(prof, addBytesRead, TRACE.size()*sizeof(float));
+  H5GEO_PROFILE_ADD(prof, addItems, TRACE.cols());
 
   Eigen::VectorX<ptrdiff_t> sortInd = h5geo::sort(trcInd);
   // it is important to have `.eval()` thus right part 
@@ -676,13 +1016,13 @@ Eigen::MatrixXf H5SeisImpl::getTrace(
   TRACE(Eigen::all, sortInd) = TRACE(Eigen::all, Eigen::all).eval();
 
   if (!dataUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(getDataUnits()),
-          units::unit_from_string(dataUnits));
-    if (!isnan(coef))
-      return TRACE*coef;
+    double coef = h5geo::getConversionFactor(getDataUnits(), dataUnits);
+    if (isnan(coef))
+      return Eigen::MatrixXf();
 
-    return Eigen::MatrixXf();
+    // in place: no second full-size matrix
+    if (coef != 1)
+      TRACE *= coef;
   }
 
   return TRACE;
@@ -696,6 +1036,7 @@ Eigen::MatrixXd H5SeisImpl::getTraceHeader(
     const std::vector<std::string>& unitsFrom,
     const std::vector<std::string>& unitsTo)
 {
+  traceBatch.wait();
   if (!checkTraceLimits(fromTrc, nTrc))
     return Eigen::VectorXd();
 
@@ -703,26 +1044,82 @@ Eigen::MatrixXd H5SeisImpl::getTraceHeader(
     return Eigen::VectorXd();
 
   Eigen::MatrixXd HDR(nTrc, nHdr);
+  if (!readTraceHeader(HDR, fromTrc, fromHdr, unitsFrom, unitsTo))
+    return Eigen::VectorXd();
 
-  std::vector<size_t> offset({fromHdr, fromTrc});
-  std::vector<size_t> count({nHdr, nTrc});
+  return HDR;
+}
 
-  traceHeaderD.select(offset, count).read(HDR.data());
+bool H5SeisImpl::readTraceHeader(
+    Eigen::Ref<Eigen::MatrixXd> HDR,
+    const size_t& fromTrc,
+    const size_t& fromHdr,
+    const std::vector<std::string>& unitsFrom,
+    const std::vector<std::string>& unitsTo)
+{
+  H5GEO_PROFILE_SCOPE(prof, "H5Seis::readTraceHeader");
+  H5GEO_PROFILE_ADD(prof, addSelections, 1);
+  size_t nTrc = HDR.rows();
+  size_t nHdr = HDR.cols();
+  bool val = (HDR.cols() < 2 || HDR.outerStride() == HDR.rows()) &&
+      fromTrc + nTrc <= getNTrc() &&
+      fromHdr + nHdr <= getNTrcHdr();
+
+#ifdef H5GEO_USE_MPI
+  if (mpiIO){
+    // rank with invalid block still takes part in collective read
+    val = h5geo::readCollective(
+          traceHeaderD, {fromHdr, fromTrc},
+          {val ? nHdr : 0, nTrc}, HDR.data()) && val;
+  } else
+#endif
+  if (val && HDR.size() > 0){
+    std::vector<size_t> offset({fromHdr, fromTrc});
+    std::vector<size_t> count({nHdr, nTrc});
 
+    try {
+      traceHeaderD.select(offset, count).read(HDR.data());
+    } catch (h5gt::Exception& err) {
+      return false;
+    }
+  }
+
+  if (!val)
+    return false;
+
+  H5GEO_PROFILE_ADD(prof, addBytesRead, HDR.size()*sizeof(double));
+  H5GEO_PROFILE_ADD(prof, addItems, nTrc);
   if (unitsFrom.size() == HDR.cols() &&
       unitsTo.size() == HDR.cols()){
     for (size_t i = 0; i < HDR.cols(); i++){
       if (!unitsFrom[i].empty() && !unitsTo[i].empty()){
-        double coef = units::convert(
-              units::unit_from_string(unitsFrom[i]),
-              units::unit_from_string(unitsTo[i]));
+        double coef = h5geo::getConversionFactor(unitsFrom[i], unitsTo[i]);
         if (!isnan(coef))
-          HDR.col(i) = HDR.col(i)*coef;
+          HDR.col(i) *= coef;
       }
     }
   }
 
-  return HDR;
+  return true;
+}
+
+bool H5SeisImpl::readTraceHeader(
+    const std::string& hdrName,
+    Eigen::Ref<Eigen::VectorXd> hdr,
+    const size_t& fromTrc,
+    const std::string& unitsFrom,
+    const std::string& unitsTo)
+{
+  ptrdiff_t ind = getTraceHeaderIndex(hdrName);
+  if (ind < 0)
+    return false;
+
+  // a column vector is contiguous `nTrc x 1` matrix
+  Eigen::Map<Eigen::MatrixXd> HDR(hdr.data(), hdr.size(), 1);
+  return readTraceHeader(
+        HDR, fromTrc, ind,
+        std::vector<std::string>({unitsFrom}),
+        std::vector<std::string>({unitsTo}));
 }
 
 Eigen::VectorXd H5SeisImpl::getTraceHeader(
@@ -732,6 +1129,7 @@ Eigen::VectorXd H5SeisImpl::getTraceHeader(
     const std::string& unitsFrom,
     const std::string& unitsTo)
 {
+  traceBatch.wait();
   ptrdiff_t ind = getTraceHeaderIndex(hdrName);
   if (ind < 0)
     return Eigen::VectorXd();
@@ -750,6 +1148,7 @@ Eigen::MatrixXd H5SeisImpl::getTraceHeader(
     const std::vector<std::string>& unitsFrom,
     const std::vector<std::string>& unitsTo)
 {
+  traceBatch.wait();
   Eigen::MatrixXd HDR(trcInd.size(), trcHdrInd.size());
   h5gt::ElementSet elSet =
       h5geo::rowsCols2ElementSet(trcHdrInd, trcInd);
@@ -759,11 +1158,9 @@ Eigen::MatrixXd H5SeisImpl::getTraceHeader(
       unitsTo.size() == HDR.cols()){
     for (size_t i = 0; i < HDR.cols(); i++){
       if (!unitsFrom[i].empty() && !unitsTo[i].empty()){
-        double coef = units::convert(
-              units::unit_from_string(unitsFrom[i]),
-              units::unit_from_string(unitsTo[i]));
+        double coef = h5geo::getConversionFactor(unitsFrom[i], unitsTo[i]);
         if (!isnan(coef))
-          HDR.col(i) = HDR.col(i)*coef;
+          HDR.col(i) *= coef;
       }
     }
   }
@@ -777,6 +1174,7 @@ Eigen::MatrixXd H5SeisImpl::getTraceHeader(
     const std::vector<std::string>& unitsFrom,
     const std::vector<std::string>& unitsTo)
 {
+  traceBatch.wait();
   Eigen::MatrixXd HDR(trcInd.size(), trcHdrInd.size());
   h5gt::ElementSet elSet =
       h5geo::rowsCols2ElementSet(trcHdrInd, trcInd);
@@ -786,11 +1184,9 @@ Eigen::MatrixXd H5SeisImpl::getTraceHeader(
       unitsTo.size() == HDR.cols()){
     for (size_t i = 0; i < HDR.cols(); i++){
       if (!unitsFrom[i].empty() && !unitsTo[i].empty()){
-        double coef = units::convert(
-              units::unit_from_string(unitsFrom[i]),
-              units::unit_from_string(unitsTo[i]));
+        double coef = h5geo::getConversionFactor(unitsFrom[i], unitsTo[i]);
         if (!isnan(coef))
-          HDR.col(i) = HDR.col(i)*coef;
+          HDR.col(i) *= coef;
       }
     }
   }
@@ -804,6 +1200,7 @@ Eigen::MatrixXd H5SeisImpl::getTraceHeader(
     const std::vector<std::string>& unitsFrom,
     const std::vector<std::string>& unitsTo)
 {
+  traceBatch.wait();
   if (hdrNames.empty())
     return Eigen::MatrixXd();
 
@@ -827,6 +1224,7 @@ Eigen::MatrixXd H5SeisImpl::getTraceHeader(
     const std::vector<std::string>& unitsFrom,
     const std::vector<std::string>& unitsTo)
 {
+  traceBatch.wait();
   if (hdrNames.empty())
     return Eigen::MatrixXd();
 
@@ -851,6 +1249,7 @@ Eigen::MatrixXd H5SeisImpl::getXYTraceHeaders(
     const std::string& lengthUnits,
     bool doCoordTransform)
 {
+  traceBatch.wait();
   if (xyHdrNames.size() != 2)
     return Eigen::MatrixXd();
 
@@ -877,9 +1276,9 @@ Eigen::MatrixXd H5SeisImpl::getXYTraceHeaders(
       if (xy.cols() != 2 || xy.rows() < 1)
         return Eigen::MatrixXd();
 
-      coordTrans->Transform(xy.rows(), xy.col(0).data(), xy.col(1).data());
+      h5geo::transformCoordinates(coordTrans.get(), xy.rows(), xy.col(0).data(), xy.col(1).data());
       return xy;
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return Eigen::MatrixXd();
     }
   }
@@ -899,6 +1298,7 @@ Eigen::MatrixXd H5SeisImpl::getXYTraceHeaders(
     const std::string& lengthUnits,
     bool doCoordTransform)
 {
+  traceBatch.wait();
   if (xyHdrNames.size() != 2)
     return Eigen::MatrixXd();
 
@@ -912,9 +1312,9 @@ Eigen::MatrixXd H5SeisImpl::getXYTraceHeaders(
       if (xy.cols() != 2 || xy.rows() < 1)
         return Eigen::MatrixXd();
 
-      coordTrans->Transform(xy.rows(), xy.col(0).data(), xy.col(1).data());
+      h5geo::transformCoordinates(coordTrans.get(), xy.rows(), xy.col(0).data(), xy.col(1).data());
       return xy;
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return Eigen::MatrixXd();
     }
   }
@@ -940,6 +1340,8 @@ Eigen::VectorX<size_t> H5SeisImpl::getSortedData(
     const std::string& lengthUnits,
     bool doCoordTransform)
 {
+  traceBatch.wait();
+  H5GEO_PROFILE_SCOPE(prof, "H5Seis::getSortedData");
   if (keyList.empty() || minList.empty() || maxList.empty())
     return Eigen::VectorX<size_t>();
 
@@ -948,6 +1350,30 @@ Eigen::VectorX<size_t> H5SeisImpl::getSortedData(
       minList.size() != maxList.size())
     return Eigen::VectorX<size_t>();
 
+  // composite sort already keeps headers sorted:
+  // no need to read and sort them again
+  if (keyList.size() > 1 && hasCompositeSort(keyList)){
+    Eigen::VectorX<size_t> traceIndexes = getCompositeSortIndexes(
+          HDR, keyList, minList, maxList, pStep);
+    if (HDR.size() < 1 || traceIndexes.size() < 1)
+      return Eigen::VectorX<size_t>();
+
+#ifdef H5GEO_USE_GDAL
+    if (doCoordTransform && HDR.cols() == 2){
+      OGRCT_ptr coordTrans(createCoordinateTransformationToReadData(lengthUnits));
+      if (coordTrans)
+        h5geo::transformCoordinates(coordTrans.get(), HDR.rows(), HDR.col(0).data(), HDR.col(1).data());
+    }
+#endif
+
+    if (fromSampInd >= getNSamp() || nSamp == 0)
+      return traceIndexes;
+
+    checkSampleLimits(fromSampInd, nSamp);
+    TRACE = getTrace(traceIndexes, fromSampInd, nSamp, dataUnits);
+    return traceIndexes;
+  }
+
   // define trace and header indexes, convert them to ElementSet
   // and read preliminary PKey indexed headers
   Eigen::VectorX<size_t> traceIndexes = getPKeyIndexes(
@@ -999,7 +1425,7 @@ Eigen::VectorX<size_t> H5SeisImpl::getSortedData(
   if (doCoordTransform && HDR.cols() == 2){
     OGRCT_ptr coordTrans(createCoordinateTransformationToReadData(lengthUnits));
     if (coordTrans)
-      coordTrans->Transform(HDR.rows(), HDR.col(0).data(), HDR.col(1).data());
+      h5geo::transformCoordinates(coordTrans.get(), HDR.rows(), HDR.col(0).data(), HDR.col(1).data());
   }
 #endif
 
@@ -1060,13 +1486,9 @@ Eigen::VectorXd H5SeisImpl::getSamples(
     double coef;
     if (getDomain() == h5geo::Domain::OWT ||
         getDomain() == h5geo::Domain::TWT)
-      coef = units::convert(
-            units::unit_from_string(getTemporalUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getTemporalUnits(), units);
     else
-      coef = units::convert(
-            units::unit_from_string(getLengthUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getLengthUnits(), units);
     if (!isnan(coef))
       return samp*coef;
 
@@ -1090,13 +1512,9 @@ double H5SeisImpl::getFirstSample(
     double coef;
     if (getDomain() == h5geo::Domain::OWT ||
         getDomain() == h5geo::Domain::TWT)
-      coef = units::convert(
-            units::unit_from_string(getTemporalUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getTemporalUnits(), units);
     else
-      coef = units::convert(
-            units::unit_from_string(getLengthUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getLengthUnits(), units);
     return firstSamp(0)*coef;
   }
 
@@ -1115,13 +1533,9 @@ double H5SeisImpl::getSampRate(const std::string& units){
     double coef;
     if (getDomain() == h5geo::Domain::OWT ||
         getDomain() == h5geo::Domain::TWT)
-      coef = units::convert(
-            units::unit_from_string(getTemporalUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getTemporalUnits(), units);
     else
-      coef = units::convert(
-            units::unit_from_string(getLengthUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getLengthUnits(), units);
     return sampRate*coef;
   }
 
@@ -1231,13 +1645,11 @@ Eigen::VectorXd H5SeisImpl::getPKeyValues(
   uvalG->getDataSet(pKey).read(v.data());
 
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-          units::unit_from_string(unitsFrom),
-          units::unit_from_string(unitsTo));
-    if (!isnan(coef))
-      return v*coef;
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
+    if (isnan(coef))
+      return Eigen::VectorXd();
 
-    return Eigen::VectorXd();
+    v *= coef;
   }
 
   return v;
@@ -1429,9 +1841,7 @@ double H5SeisImpl::getTraceHeaderMin(
     return std::nan("nan");
 
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-          units::unit_from_string(unitsFrom),
-          units::unit_from_string(unitsTo));
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
     return hdr[ind]*coef;
   }
 
@@ -1461,9 +1871,7 @@ double H5SeisImpl::getTraceHeaderMax(
     return std::nan("nan");
 
   if (!unitsFrom.empty() && !unitsTo.empty()){
-    double coef = units::convert(
-          units::unit_from_string(unitsFrom),
-          units::unit_from_string(unitsTo));
+    double coef = h5geo::getConversionFactor(unitsFrom, unitsTo);
     return hdr[ind]*coef;
   }
 
@@ -1564,16 +1972,14 @@ bool H5SeisImpl::generatePRESTKGeometry(
     if (coordTrans){
       coordTrans->Transform(1, &src_x0, &src_y0);
       coordTrans->Transform(1, &rec_x0, &rec_y0);
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
   }
 #endif
 
   if (!lengthUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(lengthUnits),
-          units::unit_from_string(getLengthUnits()));
+    double coef = h5geo::getConversionFactor(lengthUnits, getLengthUnits());
     src_dx *= coef;
     src_dy *= coef;
     rec_dx *= coef;
@@ -1618,16 +2024,14 @@ bool H5SeisImpl::generateSTKGeometry(
     OGRCT_ptr coordTrans(createCoordinateTransformationToWriteData(lengthUnits));
     if (coordTrans){
       coordTrans->Transform(1, &x0, &y0);
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
   }
 #endif
 
   if (!lengthUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(lengthUnits),
-          units::unit_from_string(getLengthUnits()));
+    double coef = h5geo::getConversionFactor(lengthUnits, getLengthUnits());
     dx *= coef;
     dy *= coef;
     if (!doCoordTransform){
@@ -1708,13 +2112,9 @@ bool H5SeisImpl::setFirstSample(double val, const std::string& units){
     double coef;
     if (getDomain() == h5geo::Domain::OWT ||
         getDomain() == h5geo::Domain::TWT)
-      coef = units::convert(
-            units::unit_from_string(getTemporalUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getTemporalUnits(), units);
     else
-      coef = units::convert(
-            units::unit_from_string(getLengthUnits()),
-            units::unit_from_string(units));
+      coef = h5geo::getConversionFactor(getLengthUnits(), units);
     val = val*coef;
   }
 
@@ -1793,6 +2193,7 @@ bool H5SeisImpl::removePKeySort(const std::string& pKeyName){
 }
 
 bool H5SeisImpl::addPKeySort(const std::string& pKeyName){
+  H5GEO_PROFILE_SCOPE(prof, "H5Seis::addPKeySort");
   auto optUValG = getUValG();
   if (!optUValG.has_value())
     return false;
@@ -1831,10 +2232,114 @@ bool H5SeisImpl::addPKeySort(const std::string& pKeyName){
           std::to_string(i), uidxS).write_raw(uidx.data());
   }
 
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return true;
 }
 
+bool H5SeisImpl::hasCompositeSort(const std::vector<std::string>& keyList)
+{
+  auto optCompositeG = getCompositeG();
+  if (!optCompositeG.has_value())
+    return false;
+
+  std::string name = getCompositeSortName(keyList);
+  if (name.empty() ||
+      !optCompositeG->hasObject(name, h5gt::ObjectType::Group))
+    return false;
+
+  h5gt::Group group = optCompositeG->getGroup(name);
+  if (group.hasObject(std::string{h5geo::detail::unique_rows}, h5gt::ObjectType::Dataset) &&
+      group.hasObject(std::string{h5geo::detail::unique_rows_from_size}, h5gt::ObjectType::Dataset) &&
+      group.hasObject(std::string{h5geo::detail::trace_order}, h5gt::ObjectType::Dataset))
+    return true;
+
+  return false;
+}
+
+bool H5SeisImpl::removeCompositeSort(const std::vector<std::string>& keyList){
+  auto optCompositeG = getCompositeG();
+  if (!optCompositeG.has_value())
+    return false;
+
+  std::string name = getCompositeSortName(keyList);
+  if (name.empty())
+    return false;
+
+  if (optCompositeG->exist(name))
+    optCompositeG->unlink(name);
+
+  return true;
+}
+
+bool H5SeisImpl::addCompositeSort(const std::vector<std::string>& keyList){
+  std::string name = getCompositeSortName(keyList);
+  if (name.empty() || keyList.size() < 2)
+    return false;
+
+  // seis created by older versions may not have composite group
+  auto optCompositeG = getCompositeG();
+  if (!optCompositeG.has_value()){
+    auto optSortG = getSortG();
+    if (!optSortG.has_value())
+      return false;
+
+    try {
+      optCompositeG = optSortG->createGroup(
+            std::string{h5geo::detail::composite});
+    } catch (h5gt::Exception& err) {
+      return false;
+    }
+  }
+
+  size_t nTrc = getNTrc();
+  Eigen::MatrixXd HDR(nTrc, keyList.size());
+  for (size_t i = 0; i < keyList.size(); i++){
+    Eigen::VectorXd hdr = getTraceHeader(keyList[i], 0, nTrc);
+    if (hdr.size() != nTrc)
+      return false;
+
+    HDR.col(i) = hdr;
+  }
+
+  if (hasCompositeSort(keyList))
+    removeCompositeSort(keyList);
+
+  Eigen::MatrixXd urows;
+  Eigen::MatrixX2<ptrdiff_t> urows_from_size;
+  Eigen::VectorX<ptrdiff_t> idx = h5geo::sort_rows_unique(
+        HDR, urows, urows_from_size);
+
+  if (idx.size() < 1)
+    return false;
+
+  // column-major Eigen matrices are written as row-major h5 datasets
+  // so that each key (and 'from'/'size') is stored as contiguous row
+  h5gt::Group group = optCompositeG->createGroup(name);
+  group.createDataSet<double>(
+        std::string{h5geo::detail::unique_rows},
+        h5gt::DataSpace({(size_t)urows.cols(), (size_t)urows.rows()})).
+      write_raw(urows.data());
+  group.createDataSet<ptrdiff_t>(
+        std::string{h5geo::detail::unique_rows_from_size},
+        h5gt::DataSpace({2, (size_t)urows_from_size.rows()})).
+      write_raw(urows_from_size.data());
+  group.createDataSet<ptrdiff_t>(
+        std::string{h5geo::detail::trace_order},
+        h5gt::DataSpace({(size_t)idx.size()})).
+      write_raw(idx.data());
+
+  h5geo::flushUnlessBatch(objG.getFile());
+  return true;
+}
+
+std::vector<std::string> H5SeisImpl::getCompositeSortNames(){
+  auto opt = getCompositeG();
+  if (!opt.has_value())
+    return std::vector<std::string>();
+
+  return opt->listObjectNames();
+}
+
 bool H5SeisImpl::updateTraceHeaderSampRate(){
   // set sampRate
   double sampRate = std::abs(this->getSampRate());
@@ -1865,6 +2370,29 @@ H5SeisContainer* H5SeisImpl::openSeisContainer(){
         file, h5geo::CreationType::OPEN_OR_CREATE);
 }
 
+void H5SeisImpl::setChunkCache(
+    const H5ChunkCacheParam& p,
+    const std::string& datasetName)
+{
+  H5BaseObjectImpl::setChunkCache(p, datasetName);
+  reopenTraceDatasets();
+}
+
+void H5SeisImpl::resetChunkCache(){
+  H5BaseObjectImpl::resetChunkCache();
+  reopenTraceDatasets();
+}
+
+void H5SeisImpl::reopenTraceDatasets(){
+  auto traceOpt = getDatasetOpt(objG, "trace");
+  if (traceOpt.has_value())
+    traceD = traceOpt.value();
+
+  auto traceHeaderOpt = getDatasetOpt(objG, "trace_header");
+  if (traceHeaderOpt.has_value())
+    traceHeaderD = traceHeaderOpt.value();
+}
+
 std::optional<h5gt::DataSet>
 H5SeisImpl::getTextHeaderD()
 {
@@ -1926,6 +2454,20 @@ H5SeisImpl::getIndexesG()
   return opt->getGroup(name);
 }
 
+std::optional<h5gt::Group>
+H5SeisImpl::getCompositeG()
+{
+  auto opt = getSortG();
+  if (!opt.has_value())
+    return std::nullopt;
+
+  std::string name = std::string{h5geo::detail::composite};
+  if (!opt->hasObject(name, h5gt::ObjectType::Group))
+    return std::nullopt;
+
+  return opt->getGroup(name);
+}
+
 std::optional<h5gt::Group> H5SeisImpl::getSEGYG()
 {
   std::string name = std::string{h5geo::detail::segy};
@@ -2049,7 +2591,7 @@ bool H5SeisImpl::updateTraceHeaderLimits(size_t nTrcBuffer)
     return false;
 
 
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return true;
 }
 
@@ -2059,16 +2601,38 @@ bool H5SeisImpl::updatePKeySort(const std::string& pKeyName)
   return addPKeySort(pKeyName);
 }
 
+bool H5SeisImpl::updateCompositeSort(const std::vector<std::string>& keyList)
+{
+  removeCompositeSort(keyList);
+  return addCompositeSort(keyList);
+}
+
 Eigen::MatrixXd H5SeisImpl::calcBoundary(
     const std::string& lengthUnits,
     bool doCoordTransform)
 {
   Eigen::MatrixX2d boundary;
-  if (getDataType() == h5geo::SeisDataType::STACK &&
-      getSurveyType() == h5geo::SurveyType::TWO_D){
-    boundary = calcBoundaryStk2D();
-  } else {
-    boundary = calcConvexHullBoundary();
+  auto opt = getBoundaryD();
+  if (opt.has_value()){
+    // `X` and `Y` are stored as rows
+    try {
+      std::vector<size_t> dims = opt->getDimensions();
+      if (dims.size() == 2 && dims[0] == 2){
+        boundary.resize(dims[1], 2);
+        opt->read(boundary.data());
+      }
+    } catch (h5gt::Exception& err) {
+      boundary.resize(0, 2);
+    }
+  }
+
+  if (boundary.size() == 0){
+    if (getDataType() == h5geo::SeisDataType::STACK &&
+        getSurveyType() == h5geo::SurveyType::TWO_D){
+      boundary = calcBoundaryStk2D();
+    } else {
+      boundary = calcConvexHullBoundary();
+    }
   }
 
   if (boundary.size() == 0 || boundary.cols() < 2)
@@ -2080,22 +2644,380 @@ Eigen::MatrixXd H5SeisImpl::calcBoundary(
     if (coordTrans){
       coordTrans->Transform(boundary.rows(), boundary.col(0).data(), boundary.col(1).data());
       return boundary;
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return Eigen::MatrixXd();
     }
   }
 #endif
 
   if (!lengthUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(getLengthUnits()),
-          units::unit_from_string(lengthUnits));
+    double coef = h5geo::getConversionFactor(getLengthUnits(), lengthUnits);
     boundary *= coef;
   }
 
   return boundary;
 }
 
+bool H5SeisImpl::calcSurveyInfo(
+    h5geo::SurveyInfo& info,
+    const std::string& xHeader,
+    const std::string& yHeader,
+    const std::string& ilHeader,
+    const std::string& xlHeader,
+    double ilMin,
+    double ilMax,
+    double xlMin,
+    double xlMax,
+    size_t nTrcBuffer)
+{
+  if (nTrcBuffer < 1 ||
+      getTraceHeaderIndex(xHeader) < 0 ||
+      getTraceHeaderIndex(yHeader) < 0 ||
+      getTraceHeaderIndex(ilHeader) < 0 ||
+      getTraceHeaderIndex(xlHeader) < 0)
+    return false;
+
+  h5geo::SurveyInfoEstimator estimator;
+  size_t nTrc = getNTrc();
+  for (size_t fromTrc = 0; fromTrc < nTrc; fromTrc += nTrcBuffer){
+    Eigen::VectorXd il = getTraceHeader(ilHeader, fromTrc, nTrcBuffer);
+    Eigen::VectorXd xl = getTraceHeader(xlHeader, fromTrc, nTrcBuffer);
+    Eigen::VectorXd x = getTraceHeader(xHeader, fromTrc, nTrcBuffer);
+    Eigen::VectorXd y = getTraceHeader(yHeader, fromTrc, nTrcBuffer);
+    if (il.size() < 1 ||
+        il.size() != xl.size() ||
+        il.size() != x.size() ||
+        il.size() != y.size())
+      return false;
+
+    Eigen::VectorX<ptrdiff_t> ind = h5geo::find_index(
+          il.array() >= ilMin && il.array() <= ilMax &&
+          xl.array() >= xlMin && xl.array() <= xlMax);
+    if (ind.size() == il.size())
+      estimator.add(il, xl, x, y);
+    else
+      estimator.add(il(ind), xl(ind), x(ind), y(ind));
+  }
+
+  return estimator.estimate(info);
+}
+
+Eigen::VectorX<ptrdiff_t> H5SeisImpl::calcTraceCellIndexes(
+    const h5geo::SurveyInfo& info,
+    const std::string& ilHeader,
+    const std::string& xlHeader,
+    size_t nTrcBuffer)
+{
+  if (nTrcBuffer < 1 ||
+      getTraceHeaderIndex(ilHeader) < 0 ||
+      getTraceHeaderIndex(xlHeader) < 0)
+    return Eigen::VectorX<ptrdiff_t>();
+
+  size_t nTrc = getNTrc();
+  Eigen::VectorX<ptrdiff_t> cells(nTrc);
+  for (size_t fromTrc = 0; fromTrc < nTrc; fromTrc += nTrcBuffer){
+    Eigen::VectorXd il = getTraceHeader(ilHeader, fromTrc, nTrcBuffer);
+    Eigen::VectorXd xl = getTraceHeader(xlHeader, fromTrc, nTrcBuffer);
+    Eigen::VectorX<ptrdiff_t> blockCells =
+        h5geo::getSurveyCellIndexes(info, il, xl);
+    if (blockCells.size() < 1)
+      return Eigen::VectorX<ptrdiff_t>();
+
+    cells.segment(fromTrc, blockCells.size()) = blockCells;
+  }
+
+  return cells;
+}
+
+Eigen::VectorXd H5SeisImpl::calcWindowAttribute(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y,
+    const Eigen::Ref<const Eigen::VectorXd>& z,
+    double windowAbove,
+    double windowBelow,
+    const h5geo::WindowAttribute& attribute,
+    const std::string& lengthUnits,
+    const std::string& zUnits,
+    const std::string& xHeader,
+    const std::string& yHeader,
+    const std::string& ilHeader,
+    const std::string& xlHeader)
+{
+  float nullValue = this->getNullValue();
+  return this->reduceWindows(
+        x, y, z, windowAbove, windowBelow, 0,
+        [&attribute, nullValue](const Eigen::Ref<const Eigen::VectorXf>& v, double){
+    return h5geo::calcWindowAttribute(v, attribute, nullValue);
+  }, lengthUnits, zUnits, xHeader, yHeader, ilHeader, xlHeader);
+}
+
+Eigen::VectorXd H5SeisImpl::interpolateAmplitudes(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y,
+    const Eigen::Ref<const Eigen::VectorXd>& z,
+    const std::string& lengthUnits,
+    const std::string& zUnits,
+    const std::string& xHeader,
+    const std::string& yHeader,
+    const std::string& ilHeader,
+    const std::string& xlHeader)
+{
+  // one neighbour sample on each side of `z`
+  float nullValue = this->getNullValue();
+  return this->reduceWindows(
+        x, y, z, 0, 0, 1,
+        [nullValue](const Eigen::Ref<const Eigen::VectorXf>& v, double pos){
+    return h5geo::interpolateSample(v, pos, nullValue);
+  }, lengthUnits, zUnits, xHeader, yHeader, ilHeader, xlHeader);
+}
+
+Eigen::VectorXd H5SeisImpl::extractAlongTrajectory(
+    const h5geo::Trajectory& traj,
+    const Eigen::Ref<const Eigen::VectorXd>& md,
+    const h5geo::TimeDepthCurve& tdCurve,
+    const std::string& lengthUnits,
+    const std::string& temporalUnits,
+    const std::string& xHeader,
+    const std::string& yHeader,
+    const std::string& ilHeader,
+    const std::string& xlHeader)
+{
+  return h5geo::extractAlongTrajectory(
+        traj, md, tdCurve, this->getDomain(), lengthUnits, temporalUnits,
+        [&](const Eigen::Ref<const Eigen::VectorXd>& x,
+            const Eigen::Ref<const Eigen::VectorXd>& y,
+            const Eigen::Ref<const Eigen::VectorXd>& z,
+            const std::string& xyUnits,
+            const std::string& zUnits){
+    return this->interpolateAmplitudes(
+          x, y, z, xyUnits, zUnits,
+          xHeader, yHeader, ilHeader, xlHeader);
+  });
+}
+
+Eigen::VectorXd H5SeisImpl::reduceWindows(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y,
+    const Eigen::Ref<const Eigen::VectorXd>& z,
+    double windowAbove,
+    double windowBelow,
+    size_t padSamples,
+    const h5geo::WindowReducer& reducer,
+    const std::string& lengthUnits,
+    const std::string& zUnits,
+    const std::string& xHeader,
+    const std::string& yHeader,
+    const std::string& ilHeader,
+    const std::string& xlHeader)
+{
+  if (x.size() != y.size() ||
+      x.size() != z.size() ||
+      x.size() < 1)
+    return Eigen::VectorXd();
+
+  size_t nTrc = this->getNTrc();
+  size_t nSamp = this->getNSamp();
+  if (nTrc < 1 || nSamp < 1)
+    return Eigen::VectorXd();
+
+  h5geo::SurveyInfo info;
+  if (!this->calcSurveyInfo(info, xHeader, yHeader, ilHeader, xlHeader))
+    return Eigen::VectorXd();
+
+  Eigen::VectorX<ptrdiff_t> volInd = h5geo::getSurveyVolIndexes(
+        info, this->calcTraceCellIndexes(info, ilHeader, xlHeader));
+  if (volInd.size() != nTrc)
+    return Eigen::VectorXd();
+
+  // grid node -> trace (the same layout as H5Seis::exportToVol() uses)
+  size_t nX = info.getVolNX();
+  size_t nY = info.getVolNY();
+  std::vector<ptrdiff_t> nodeTrc(nX*nY, -1);
+  for (ptrdiff_t i = 0; i < volInd.size(); i++)
+    if (volInd(i) >= 0)
+      nodeTrc[volInd(i)] = i;
+
+  double xyCoef = 1;
+  if (!lengthUnits.empty())
+    xyCoef = h5geo::getConversionFactor(lengthUnits, getLengthUnits());
+
+  double zCoef = 1;
+  if (!zUnits.empty()){
+    if (getDomain() == h5geo::Domain::OWT ||
+        getDomain() == h5geo::Domain::TWT)
+      zCoef = h5geo::getConversionFactor(zUnits, getTemporalUnits());
+    else
+      zCoef = h5geo::getConversionFactor(zUnits, getLengthUnits());
+  }
+
+  if (std::isnan(xyCoef) || std::isnan(zCoef))
+    return Eigen::VectorXd();
+
+  Eigen::VectorX<ptrdiff_t> nodeInd = h5geo::calcGridNodeIndexes(
+        x*xyCoef, y*xyCoef,
+        info.origin_x, info.isPlanReversed ? info.xlSpacing : info.ilSpacing, nX,
+        info.origin_y, info.isPlanReversed ? info.ilSpacing : info.xlSpacing, nY,
+        info.orientation * M_PI / 180);
+  if (nodeInd.size() != x.size())
+    return Eigen::VectorXd();
+
+  // first sample may differ from trace to trace
+  Eigen::VectorXd firstSamp = this->getTraceHeader("DELRECT", 0, nTrc);
+  double sampRate = this->getSampRate();
+  if (firstSamp.size() != nTrc || sampRate == 0 || std::isnan(sampRate))
+    return Eigen::VectorXd();
+
+  // window of samples `[from, to]` needed for each point
+  // (`pos` is fractional sample index of `z`)
+  struct WindowRequest{
+    size_t trc, from, to;
+    ptrdiff_t point;
+    double pos;
+  };
+
+  std::vector<WindowRequest> req;
+  req.reserve(x.size());
+  for (ptrdiff_t i = 0; i < x.size(); i++){
+    if (nodeInd(i) < 0 || nodeTrc[nodeInd(i)] < 0)
+      continue;
+
+    size_t trc = nodeTrc[nodeInd(i)];
+    double pos = (z(i)*zCoef - firstSamp(trc)) / sampRate;
+    double s0 = ((z(i) - windowAbove)*zCoef - firstSamp(trc)) / sampRate;
+    double s1 = ((z(i) + windowBelow)*zCoef - firstSamp(trc)) / sampRate;
+    if (std::isnan(s0) || std::isnan(s1))
+      continue;
+
+    // negative sampling rate
+    if (s0 > s1)
+      std::swap(s0, s1);
+
+    s0 = std::max(std::ceil(s0 - 1e-6) - padSamples, double(0));
+    s1 = std::min(std::floor(s1 + 1e-6) + padSamples, double(nSamp-1));
+    if (s0 > s1)
+      continue;
+
+    req.push_back({trc, size_t(s0), size_t(s1), i, pos - s0});
+  }
+
+  // traces are chunked by rows: read them chunk by chunk
+  std::sort(req.begin(), req.end(),
+            [](const WindowRequest& a, const WindowRequest& b){
+    return a.trc < b.trc;
+  });
+
+  size_t trcChunk = nTrc;
+  auto dsetCreateProps = traceD.getCreateProps();
+  if (dsetCreateProps.isChunked()){
+    std::vector<hsize_t> chunkSizeVec = dsetCreateProps.getChunk(traceD.getDimensions().size());
+    if (chunkSizeVec.size() > 0 && chunkSizeVec[0] > 0)
+      trcChunk = chunkSizeVec[0];
+  }
+
+  // ~64 Mb of samples are read at once
+  size_t maxBlockSize = (size_t(64) << 20) / sizeof(float);
+  Eigen::VectorXd res = Eigen::VectorXd::Constant(x.size(), std::nan("nan"));
+  std::vector<size_t> rows, cols;
+  for (size_t r0 = 0; r0 < req.size();){
+    size_t chunk = req[r0].trc / trcChunk;
+    size_t from = req[r0].from;
+    size_t to = req[r0].to;
+    rows.clear();
+    cols.clear();
+    size_t r1 = r0;
+    for (; r1 < req.size() && req[r1].trc / trcChunk == chunk; r1++){
+      bool isNewRow = rows.empty() || rows.back() != req[r1].trc;
+      size_t newFrom = std::min(from, req[r1].from);
+      size_t newTo = std::max(to, req[r1].to);
+      if (r1 > r0 &&
+          (rows.size() + isNewRow) * (newTo - newFrom + 1) > maxBlockSize)
+        break;
+
+      from = newFrom;
+      to = newTo;
+      if (isNewRow)
+        rows.push_back(req[r1].trc);
+      cols.push_back(rows.size()-1);
+    }
+
+    // rows are sorted thus the order of columns is kept
+    Eigen::MatrixXf TRACE(to - from + 1, rows.size());
+    try {
+      traceD.select_rows(rows, from, TRACE.rows()).read(TRACE.data());
+    } catch (h5gt::Exception& err) {
+      return Eigen::VectorXd();
+    }
+
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel for
+#endif
+    for (ptrdiff_t r = r0; r < ptrdiff_t(r1); r++){
+      const WindowRequest& w = req[r];
+      res(w.point) = reducer(
+            TRACE.col(cols[r-r0]).segment(w.from - from, w.to - w.from + 1),
+            w.pos);
+    }
+
+    r0 = r1;
+  }
+
+  return res;
+}
+
+bool H5SeisImpl::calcHorizonWindowAttribute(
+    H5Horizon* horizon,
+    const std::string& componentName,
+    double windowAbove,
+    double windowBelow,
+    const h5geo::WindowAttribute& attribute,
+    const std::string& xComponent,
+    const std::string& yComponent,
+    const std::string& zComponent,
+    const std::string& xHeader,
+    const std::string& yHeader,
+    const std::string& ilHeader,
+    const std::string& xlHeader)
+{
+  return h5geo::calcHorizonWindowAttribute(
+        horizon, componentName, this->getDomain(),
+        [&](const Eigen::Ref<const Eigen::VectorXd>& x,
+            const Eigen::Ref<const Eigen::VectorXd>& y,
+            const Eigen::Ref<const Eigen::VectorXd>& z,
+            const std::string& xyUnits,
+            const std::string& zUnits){
+    return this->calcWindowAttribute(
+          x, y, z, windowAbove, windowBelow, attribute,
+          xyUnits, zUnits,
+          xHeader, yHeader, ilHeader, xlHeader);
+  }, xComponent, yComponent, zComponent);
+}
+
+H5Map* H5SeisImpl::calcMapWindowAttribute(
+    H5Map* map,
+    std::string& mapName,
+    double windowAbove,
+    double windowBelow,
+    const h5geo::WindowAttribute& attribute,
+    h5geo::CreationType createFlag,
+    const std::string& xHeader,
+    const std::string& yHeader,
+    const std::string& ilHeader,
+    const std::string& xlHeader)
+{
+  return h5geo::calcMapWindowAttribute(
+        map, mapName, this->getDomain(), this->getDataUnits(),
+        [&](const Eigen::Ref<const Eigen::VectorXd>& x,
+            const Eigen::Ref<const Eigen::VectorXd>& y,
+            const Eigen::Ref<const Eigen::VectorXd>& z,
+            const std::string& xyUnits,
+            const std::string& zUnits){
+    return this->calcWindowAttribute(
+          x, y, z, windowAbove, windowBelow, attribute,
+          xyUnits, zUnits,
+          xHeader, yHeader, ilHeader, xlHeader);
+  }, createFlag);
+}
+
 bool H5SeisImpl::exportToVol(H5Vol* vol, 
     const std::string& xHeader,
     const std::string& yHeader,
@@ -2109,6 +3031,7 @@ bool H5SeisImpl::exportToVol(H5Vol* vol,
     size_t nSamp,
     std::function<void(double)> progressCallback)
 {
+  H5GEO_PROFILE_SCOPE(prof, "H5Seis::exportToVol");
   if (!vol)
     return false;
 
@@ -2116,82 +3039,121 @@ bool H5SeisImpl::exportToVol(H5Vol* vol,
   if (nSamp < 1)
     return false;
 
-  Eigen::MatrixXf TRACE;
-  Eigen::MatrixXd HDR;
-  std::vector<std::string> keyList = {ilHeader, xlHeader, xHeader, yHeader};
-  if (!this->hasPKeySort(keyList[0]) && !this->addPKeySort(keyList[0]))
-    return false;
-
-  std::vector<double> minList = {ilMin, xlMin, std::numeric_limits<double>::min(), std::numeric_limits<double>::min()};
-  std::vector<double> maxList = {ilMax, xlMax, std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
-  Eigen::VectorX<size_t> ind = this->getSortedData(TRACE, HDR, keyList, minList, maxList, 1, 0, 0);
-
-  double origin_x;
-  double origin_y;
-  double orientation;
-  double ilSpacing;
-  double xlSpacing;
-  bool isILReversed;
-  bool isXLReversed;
-  bool isPlanReversed;
-  bool status = h5geo::getSurveyInfoFromSortedData(
-        HDR.col(0),
-        HDR.col(1),
-        HDR.col(2),
-        HDR.col(3),
-        origin_x,
-        origin_y,
-        orientation,
-        ilSpacing,
-        xlSpacing,
-        isILReversed,
-        isXLReversed,
-        isPlanReversed);
-
-  if (!status)
-    return false;
-
-  // make plan normal by exchanging INLINE and XLINE headers
-  if (isPlanReversed){
-    keyList = {xlHeader, ilHeader, xHeader, yHeader};
-    if (!this->hasPKeySort(keyList[0]) && !this->addPKeySort(keyList[0]))
-      return false;
-
-    minList = {xlMin, ilMin, std::numeric_limits<double>::min(), std::numeric_limits<double>::min()};
-    maxList = {xlMax, ilMax, std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
-    ind = this->getSortedData(TRACE, HDR, keyList, minList, maxList, 1, 0, 0);
-  }
+  h5geo::SurveyInfo info;
+  if (!this->calcSurveyInfo(
+        info, xHeader, yHeader, ilHeader, xlHeader,
+        ilMin, ilMax, xlMin, xlMax))
+    return false;
 
-  // IL is sorted
-  size_t nxl = 0;
-  for (ptrdiff_t i = 0; i < HDR.rows(); i++){
-    nxl += 1;
-    if (HDR(i,0) != HDR(i+1,0))
-      break;
-  }
+  double origin_x = info.origin_x;
+  double origin_y = info.origin_y;
+  double orientation = info.orientation;
+  double ilSpacing = info.ilSpacing;
+  double xlSpacing = info.xlSpacing;
+  bool isPlanReversed = info.isPlanReversed;
 
-  auto dv = std::div(HDR.rows(), nxl);
-  if (dv.rem != 0)
+  // traces are binned to grid cells: missing traces and ragged edges are allowed
+  Eigen::VectorX<ptrdiff_t> volInd = h5geo::getSurveyVolIndexes(
+        info, this->calcTraceCellIndexes(info, ilHeader, xlHeader));
+  if (volInd.size() != this->getNTrc())
     return false;
 
-  size_t nil = dv.quot;
-  if (!vol->resize(nxl, nil, nSamp))
-    return false;
+  size_t nX = info.getVolNX();
+  size_t nY = info.getVolNY();
 
-  // N - number of slices written at once (usually 
-  // should be equal to Y-chunkSize to acieve best IO speed)
-  size_t N = 64;
+  // Null value must be set before the dataset is recreated as it is
+  // used as fill value: never written chunks are not allocated
+  vol->setNullValue(this->getNullValue());
   H5VolParam vp = vol->getParam();
-  if (vp.yChunkSize > 0 &&
-      vp.nY > 0 &&
-      vp.yChunkSize < vp.nY){
-    N = vp.yChunkSize;
-  } else if (vp.yChunkSize > 0 &&
-      vp.nY > 0 &&
-      vp.yChunkSize > vp.nY &&
-      vp.nY < N){
-    N = vp.nY;
+  // explicitly specify template (with gcc may fail without it)
+  vp.xChunkSize = std::min<size_t>(std::max<size_t>(vp.xChunkSize, 1), nX);
+  vp.yChunkSize = std::min<size_t>(std::max<size_t>(vp.yChunkSize, 1), nY);
+  vp.zChunkSize = std::min<size_t>(std::max<size_t>(vp.zChunkSize, 1), nSamp);
+  if (!vol->recreateVolD(nX, nY, nSamp,
+                         vp.xChunkSize, vp.yChunkSize, vp.zChunkSize,
+                         vp.compression_level))
+    return false;
+
+  // bucket traces by XY chunks (counting sort keeps trace order within a chunk)
+  size_t nXBlocks = (nX + vp.xChunkSize - 1) / vp.xChunkSize;
+  size_t nYBlocks = (nY + vp.yChunkSize - 1) / vp.yChunkSize;
+  size_t nChunks = nXBlocks * nYBlocks;
+  auto getChunk = [&](ptrdiff_t cell)->size_t{
+    return (cell / nX / vp.yChunkSize) * nXBlocks + (cell % nX) / vp.xChunkSize;
+  };
+  auto getChunkNCells = [&](size_t chunk)->size_t{
+    size_t iX0 = (chunk % nXBlocks) * vp.xChunkSize;
+    size_t iY0 = (chunk / nXBlocks) * vp.yChunkSize;
+    return std::min<size_t>(vp.xChunkSize, nX - iX0) *
+        std::min<size_t>(vp.yChunkSize, nY - iY0);
+  };
+
+  std::vector<size_t> chunkFrom(nChunks+1, 0);
+  for (ptrdiff_t i = 0; i < volInd.size(); i++)
+    if (volInd(i) >= 0)
+      chunkFrom[getChunk(volInd(i)) + 1]++;
+  for (size_t c = 0; c < nChunks; c++){
+    // more traces than cells means duplicated IL/XL
+    if (chunkFrom[c+1] > getChunkNCells(c))
+      return false;
+    chunkFrom[c+1] += chunkFrom[c];
+  }
+
+  std::vector<size_t> trcInd(chunkFrom.back());
+  {
+    std::vector<size_t> pos(chunkFrom.begin(), chunkFrom.end()-1);
+    for (ptrdiff_t i = 0; i < volInd.size(); i++)
+      if (volInd(i) >= 0)
+        trcInd[pos[getChunk(volInd(i))]++] = i;
+  }
+
+  // Work unit is a group of neighbour chunks from the same chunk row
+  // limited by `nCellBuffer` (~64 Mb of data). Empty chunks are skipped.
+  size_t nCellBuffer = std::max<size_t>(
+        vp.xChunkSize * vp.yChunkSize,
+        (size_t(64) << 20) / (nSamp * sizeof(float)));
+  std::vector<std::pair<size_t, size_t>> units; // [chunkFrom, chunkTo)
+  for (size_t c = 0; c < nChunks;){
+    if (chunkFrom[c+1] == chunkFrom[c]){
+      c++;
+      continue;
+    }
+
+    size_t c0 = c;
+    size_t nUnitCells = 0;
+    while (c < nChunks && c / nXBlocks == c0 / nXBlocks){
+      size_t nChunkCells = chunkFrom[c+1] > chunkFrom[c] ? getChunkNCells(c) : 0;
+      if (c > c0 && nUnitCells + nChunkCells > nCellBuffer)
+        break;
+      nUnitCells += nChunkCells;
+      c++;
+    }
+    units.push_back({c0, c});
+  }
+
+  // units of this process: with MPI they are dealt round-robin by rank
+  // and chunk writes are collective, thus each rank must know how many
+  // writes the busiest rank does
+  std::vector<size_t> myUnits;
+#ifdef H5GEO_USE_MPI
+  h5geo::MPIFileComm comm(vol->getH5File());
+  size_t nWrites = 0, nWritesMax = 0;
+  {
+    std::vector<size_t> nRankWrites(comm.getSize(), 0);
+    for (size_t u = 0; u < units.size(); u++){
+      int r = u % comm.getSize();
+      for (size_t c = units[u].first; c < units[u].second; c++)
+        if (chunkFrom[c+1] > chunkFrom[c])
+          nRankWrites[r]++;
+      if (r == comm.getRank())
+        myUnits.push_back(u);
+    }
+    nWritesMax = *std::max_element(nRankWrites.begin(), nRankWrites.end());
   }
+#else
+  myUnits.resize(units.size());
+  std::iota(myUnits.begin(), myUnits.end(), 0);
+#endif
 
   double progressOld = 0;
   double progressNew = 0;
@@ -2206,90 +3168,137 @@ bool H5SeisImpl::exportToVol(H5Vol* vol,
   };
 
   double sampRate = this->getSampRate();
-  if (isXLReversed && isILReversed){
-    for (size_t i = 0; i < nil; i+=N){
-      if (progressCallback)
-        cbk(i, nil);
-      size_t i0 = i*nxl;
-      size_t i1 = i0+nxl*N-1;
-      if (i1 >= ind.size())
-        i1 = ind.size()-1;
-      size_t n_fact = (i1-i0+1)/nxl;
-      Eigen::VectorX<size_t> ind_il(i1-i0+1);
-      size_t ii1 = ind_il.size()-1;
-      for (size_t n = 0; n < N; n++){
-        size_t i1 = i0+nxl-1;
-        if (i1 >= ind.size())
-          i1 = ind.size()-1;
-        size_t ii0 = ii1-nxl+1;
-        ind_il(Eigen::seq(ii0,ii1)) = ind(Eigen::seq(i1,i0,Eigen::fix<-1>));
-        ii1 = ii0-1;
-      }
-      Eigen::MatrixXf IL = this->getTrace(ind_il, fromSampInd, nSamp).
-          transpose();          // switch X and Z axes
-      if (sampRate < 0)
-        IL.rowwise().reverseInPlace();  // horizontal flip (Z axis flip)
-      vol->writeData(IL, 0, nil-(i+1), 0, nxl, n_fact, nSamp);
+  float nullValue = this->getNullValue();
+
+  // Reusable buffers: the next unit is read to one trace buffer while
+  // the current one is transposed from the other to the volume buffer.
+  // Traces are read in file order directly to the buffer (without resorting).
+  std::vector<size_t> rowsBuf[2];
+  std::vector<float> trcBuf[2];
+  trcBuf[0].resize(nCellBuffer * nSamp);
+  trcBuf[1].resize(nCellBuffer * nSamp);
+  std::vector<float> volBuf(nCellBuffer * nSamp);
+  Eigen::VectorX<ptrdiff_t> dstOffset, dstStride;
+  std::vector<size_t> chunkBase(nXBlocks);
+  std::vector<bool> isCellFilled(nX*nY, false);
+
+  auto readUnit = [&](size_t u, size_t b)->bool{
+    std::vector<size_t>& rows = rowsBuf[b];
+    rows.assign(trcInd.begin() + chunkFrom[units[u].first],
+                trcInd.begin() + chunkFrom[units[u].second]);
+    std::sort(rows.begin(), rows.end());
+    try {
+      traceD.select_rows(rows, fromSampInd, nSamp).read(trcBuf[b].data());
+    } catch (h5gt::Exception& err) {
+      return false;
     }
-  } else if (isXLReversed){
-    for (size_t i = 0; i < nil; i+=N){
-      if (progressCallback)
-        cbk(i, nil);
-      size_t i0 = i*nxl;
-      size_t i1 = i0+nxl*N-1;
-      if (i1 >= ind.size())
-        i1 = ind.size()-1;
-      size_t n_fact = (i1-i0+1)/nxl;
-      Eigen::VectorX<size_t> ind_il(i1-i0+1);
-      size_t ii1 = ind_il.size()-1;
-      for (size_t n = 0; n < N; n++){
-        size_t i1 = i0+nxl-1;
-        if (i1 >= ind.size())
-          i1 = ind.size()-1;
-        size_t ii0 = ii1-nxl+1;
-        ind_il(Eigen::seq(ii0,ii1)) = ind(Eigen::seq(i0,i1));
-        ii1 = ii0-1;
-      }
-      Eigen::MatrixXf IL = this->getTrace(ind_il, fromSampInd, nSamp).
-          transpose();          // switch X and Z axes
-      if (sampRate < 0)
-        IL.rowwise().reverseInPlace();  // horizontal flip (Z axis flip)
-      vol->writeData(IL, 0, nil-(i+1), 0, nxl, n_fact, nSamp);
+    return true;
+  };
+
+#ifdef H5GEO_USE_THREADS
+  std::launch readPolicy = std::launch::async;
+#else
+  std::launch readPolicy = std::launch::deferred;
+#endif
+
+  // must be declared after everything `readUnit` refers to: on early
+  // return its destructor waits until the running read is finished
+  std::future<bool> nextRead;
+  if (!myUnits.empty())
+    nextRead = std::async(readPolicy, readUnit, myUnits[0], 0);
+
+  bool ok = true;
+  for (size_t k = 0; ok && k < myUnits.size(); k++){
+    if (progressCallback)
+      cbk(k, myUnits.size());
+
+    size_t u = myUnits[k];
+    size_t b = k % 2;
+    if (!nextRead.get()){
+      ok = false;
+      break;
     }
-  } else if (isILReversed){
-    for (size_t i = 0; i < nil; i+=N){
-      if (progressCallback)
-        cbk(i, nil);
-      size_t i0 = i*nxl;
-      size_t i1 = i0+nxl*N-1;
-      if (i1 >= ind.size())
-        i1 = ind.size()-1;
-      size_t n_fact = (i1-i0+1)/nxl;
-      Eigen::VectorX<size_t> ind_il = ind(Eigen::seq(i1,i0,Eigen::fix<-1>));
-      Eigen::MatrixXf IL = this->getTrace(ind_il, fromSampInd, nSamp).
-          transpose();          // switch X and Z axes
-      if (sampRate < 0)
-        IL.rowwise().reverseInPlace();  // horizontal flip (Z axis flip)
-      vol->writeData(IL, 0, i, 0, nxl, n_fact, nSamp);
+
+    if (k+1 < myUnits.size())
+      nextRead = std::async(readPolicy, readUnit, myUnits[k+1], 1-b);
+
+    // each non-empty chunk is a contiguous (nCells x nSamp) block in `volBuf`
+    size_t c0 = units[u].first;
+    size_t c1 = units[u].second;
+    size_t base = 0;
+    for (size_t c = c0; c < c1; c++){
+      chunkBase[c-c0] = base;
+      if (chunkFrom[c+1] > chunkFrom[c])
+        base += getChunkNCells(c) * nSamp;
     }
-  } else {
-    for (size_t i = 0; i < nil; i+=N){
-      if (progressCallback)
-        cbk(i, nil);
-      size_t i0 = i*nxl;
-      size_t i1 = i0+nxl*N-1;
-      if (i1 >= ind.size())
-        i1 = ind.size()-1;
-      size_t n_fact = (i1-i0+1)/nxl;
-      Eigen::VectorX<size_t> ind_il = ind(Eigen::seq(i0,i1));
-      Eigen::MatrixXf IL = this->getTrace(ind_il, fromSampInd, nSamp).
-          transpose();          // switch X and Z axes
-      if (sampRate < 0)
-        IL.rowwise().reverseInPlace();  // horizontal flip (Z axis flip)
-      vol->writeData(IL, 0, i, 0, nxl, n_fact, nSamp);
+    std::fill(volBuf.begin(), volBuf.begin() + base, nullValue);
+
+    const std::vector<size_t>& rows = rowsBuf[b];
+    dstOffset.resize(rows.size());
+    dstStride.resize(rows.size());
+    for (size_t j = 0; j < rows.size(); j++){
+      ptrdiff_t cell = volInd(rows[j]);
+      if (isCellFilled[cell]){
+        ok = false;   // duplicated IL/XL
+        break;
+      }
+
+      isCellFilled[cell] = true;
+      size_t c = getChunk(cell);
+      size_t iX0 = (c % nXBlocks) * vp.xChunkSize;
+      size_t iY0 = (c / nXBlocks) * vp.yChunkSize;
+      size_t nXChunk = std::min<size_t>(vp.xChunkSize, nX - iX0);
+      dstOffset(j) = chunkBase[c-c0] + (cell / nX - iY0) * nXChunk + (cell % nX - iX0);
+      dstStride(j) = getChunkNCells(c);
+    }
+
+    if (!ok)
+      break;
+
+    Eigen::Map<Eigen::MatrixXf> TRACE(trcBuf[b].data(), nSamp, rows.size());
+    h5geo::transposeTraces(
+          TRACE, dstOffset, dstStride, volBuf.data(),
+          sampRate < 0);  // Z axis flip
+
+    // HDF5 calls must not overlap: write only after the next unit is read
+    if (nextRead.valid())
+      nextRead.wait();
+
+    for (size_t c = c0; c < c1; c++){
+      if (chunkFrom[c+1] == chunkFrom[c])
+        continue;
+
+      size_t iX0 = (c % nXBlocks) * vp.xChunkSize;
+      size_t iY0 = (c / nXBlocks) * vp.yChunkSize;
+      size_t nXChunk = std::min<size_t>(vp.xChunkSize, nX - iX0);
+      size_t nYChunk = std::min<size_t>(vp.yChunkSize, nY - iY0);
+      Eigen::Map<Eigen::MatrixXf> BLOCK(
+            volBuf.data() + chunkBase[c-c0], nXChunk*nYChunk, nSamp);
+#ifdef H5GEO_USE_MPI
+      nWrites++;
+#endif
+      if (!vol->writeData(BLOCK, iX0, iY0, 0, nXChunk, nYChunk, nSamp)){
+        ok = false;
+        break;
+      }
     }
   }
 
+  // HDF5 calls must not overlap (the loop may be left before the read is done)
+  if (nextRead.valid())
+    nextRead.wait();
+
+#ifdef H5GEO_USE_MPI
+  // rank that is done (or failed) takes part in the rest of collective writes
+  Eigen::MatrixXf EMPTY;
+  for (; nWrites < nWritesMax; nWrites++)
+    vol->writeData(EMPTY, 0, 0, 0, 0, 0, 0);
+  ok = comm.all(ok);
+#endif
+
+  if (!ok)
+    return false;
+
   Eigen::Vector3d origin;
   origin(0) = origin_x;
   origin(1) = origin_y;
@@ -2318,7 +3327,6 @@ bool H5SeisImpl::exportToVol(H5Vol* vol,
   vol->setTemporalUnits(this->getTemporalUnits());
   vol->setAngularUnits("degree");
   vol->setDataUnits(this->getDataUnits());
-  vol->setNullValue(this->getNullValue());
   vol->setSpatialReference(this->getSpatialReference());
 
   if (progressCallback)
@@ -2333,6 +3341,7 @@ bool H5SeisImpl::exportToSEGY(
     h5geo::Endian endian,
     std::function<void(double)> progressCallback)
 {
+  H5GEO_PROFILE_SCOPE(prof, "H5Seis::exportToSEGY");
   std::vector<std::string> txtHdr = this->getTextHeader();
   char txtHdr_out[40][80] = { " " };
   for (size_t i = 0; i < std::min<size_t>(40, txtHdr.size()); i++)
@@ -2404,6 +3413,130 @@ bool H5SeisImpl::exportToSEGY(
 /*---------------------- PROTECTED ----------------------*/
 /*-------------------------------------------------------*/
 
+Eigen::VectorX<size_t> H5SeisImpl::getCompositeSortIndexes(
+    Eigen::MatrixXd& HDR,
+    const std::vector<std::string>& keyList,
+    const std::vector<double>& minList,
+    const std::vector<double>& maxList,
+    size_t pStep)
+{
+  auto optCompositeG = getCompositeG();
+  if (!optCompositeG.has_value())
+    return Eigen::VectorX<size_t>();
+
+  std::string name = getCompositeSortName(keyList);
+  if (name.empty() ||
+      !optCompositeG->hasObject(name, h5gt::ObjectType::Group))
+    return Eigen::VectorX<size_t>();
+
+  h5gt::Group group = optCompositeG->getGroup(name);
+  h5gt::DataSet urowsD = group.getDataSet(
+        std::string{h5geo::detail::unique_rows});
+  h5gt::DataSet urowsFromSizeD = group.getDataSet(
+        std::string{h5geo::detail::unique_rows_from_size});
+  h5gt::DataSet traceOrderD = group.getDataSet(
+        std::string{h5geo::detail::trace_order});
+
+  std::vector<size_t> dims = urowsD.getDimensions();
+  if (dims.size() != 2 || dims[0] != keyList.size() || dims[1] < 1)
+    return Eigen::VectorX<size_t>();
+
+  size_t nKeys = dims[0];
+  size_t nURows = dims[1];
+
+  // unique rows are sorted by the first key (PKey) thus
+  // its range is found with binary search reading only the first row
+  Eigen::VectorXd pVals(nURows);
+  urowsD.select({0, 0}, {1, nURows}).read(pVals.data());
+  auto firstIt = std::lower_bound(pVals.begin(), pVals.end(), minList[0]);
+  auto lastIt = std::upper_bound(firstIt, pVals.end(), maxList[0]);
+  if (firstIt == lastIt)
+    return Eigen::VectorX<size_t>();
+
+  size_t fromURow = std::distance(pVals.begin(), firstIt);
+  size_t nURowsSel = std::distance(firstIt, lastIt);
+
+  Eigen::MatrixXd urows(nURowsSel, nKeys);
+  urowsD.select({0, fromURow}, {nKeys, nURowsSel}).read(urows.data());
+  Eigen::MatrixX2<ptrdiff_t> urows_from_size(nURowsSel, 2);
+  urowsFromSizeD.select({0, fromURow}, {2, nURowsSel}).read(urows_from_size.data());
+
+  if (pStep < 1)
+    pStep = 1;
+
+  // select unique rows taking in account pStep and SKeys
+  std::vector<ptrdiff_t> urowsInd;
+  urowsInd.reserve(nURowsSel);
+  size_t nTrcSel = 0;
+  // first time always take PKey
+  size_t pStepCounter = pStep;
+  bool takePKey = false;
+  for (size_t i = 0; i < nURowsSel; i++){
+    if (i == 0 || urows(i, 0) != urows(i-1, 0)){
+      takePKey = pStepCounter == pStep;
+      pStepCounter = takePKey ? 1 : pStepCounter + 1;
+    }
+
+    if (!takePKey)
+      continue;
+
+    bool take = true;
+    for (size_t j = 1; j < nKeys; j++){
+      if (urows(i, j) < minList[j] || urows(i, j) > maxList[j]){
+        take = false;
+        break;
+      }
+    }
+
+    if (take){
+      urowsInd.push_back(i);
+      nTrcSel += urows_from_size(i, 1);
+    }
+  }
+
+  if (nTrcSel < 1)
+    return Eigen::VectorX<size_t>();
+
+  // selected traces reside within a single contiguous block of sorted trace order
+  size_t fromTrcOrder = urows_from_size(urowsInd.front(), 0);
+  size_t nTrcOrder = urows_from_size(urowsInd.back(), 0) +
+      urows_from_size(urowsInd.back(), 1) - fromTrcOrder;
+  Eigen::VectorX<ptrdiff_t> traceOrder(nTrcOrder);
+  traceOrderD.select({fromTrcOrder}, {nTrcOrder}).read(traceOrder.data());
+
+  Eigen::VectorX<size_t> traceIndexes(nTrcSel);
+  HDR.resize(nTrcSel, nKeys);
+  size_t n = 0;
+  for (const auto& i : urowsInd){
+    size_t from = urows_from_size(i, 0) - fromTrcOrder;
+    size_t size = urows_from_size(i, 1);
+    traceIndexes.segment(n, size) =
+        traceOrder.segment(from, size).cast<size_t>();
+    HDR.middleRows(n, size).rowwise() = urows.row(i);
+    n += size;
+  }
+
+  return traceIndexes;
+}
+
+std::string H5SeisImpl::getCompositeSortName(
+    const std::vector<std::string>& keyList)
+{
+  std::string name;
+  for (size_t i = 0; i < keyList.size(); i++){
+    // `-` separates keys thus it is forbidden within key name
+    if (keyList[i].empty() ||
+        keyList[i].find_first_of("/-") != std::string::npos)
+      return std::string();
+
+    if (i > 0)
+      name += "-";
+
+    name += keyList[i];
+  }
+  return name;
+}
+
 Eigen::MatrixXd H5SeisImpl::calcBoundaryStk2D(){
   if (getDataType() != h5geo::SeisDataType::STACK ||
       getSurveyType() != h5geo::SurveyType::TWO_D)
@@ -2419,10 +3552,170 @@ Eigen::MatrixXd H5SeisImpl::calcBoundaryStk2D(){
   return hdrSorted.rightCols(2);
 }
 
-Eigen::MatrixXd H5SeisImpl::calcConvexHullBoundary(){
-  Eigen::MatrixX2d hdr(getNTrc(), 2);
-  hdr.col(0) = getTraceHeader("CDP_X", 0, getNTrc());
-  hdr.col(1) = getTraceHeader("CDP_Y", 0, getNTrc());
+Eigen::MatrixXd H5SeisImpl::calcConvexHullBoundary(size_t nTrcBuffer){
+  if (nTrcBuffer < 1)
+    return Eigen::MatrixXd();
+
+  // open hull of the previous blocks is merged with the next block
+  Eigen::MatrixX2d hull;
+  size_t nTrc = getNTrc();
+  for (size_t fromTrc = 0; fromTrc < nTrc; fromTrc += nTrcBuffer){
+    Eigen::VectorXd x = getTraceHeader("CDP_X", fromTrc, nTrcBuffer);
+    Eigen::VectorXd y = getTraceHeader("CDP_Y", fromTrc, nTrcBuffer);
+    if (x.size() < 1 || x.size() != y.size())
+      return Eigen::MatrixXd();
+
+    Eigen::MatrixX2d xy(hull.rows() + x.size(), 2);
+    xy.topRows(hull.rows()) = hull;
+    xy.bottomRows(x.size()).col(0) = x;
+    xy.bottomRows(x.size()).col(1) = y;
+    hull = h5geo::convexHull2D(xy);
+    if (hull.rows() > 0)
+      hull.conservativeResize(hull.rows()-1, 2);
+  }
+
+  if (hull.rows() < 1)
+    return Eigen::MatrixXd();
+
+  // close hull
+  hull.conservativeResize(hull.rows()+1, 2);
+  hull.row(hull.rows()-1) = hull.row(0);
+  return hull;
+}
+
+Eigen::MatrixXd H5SeisImpl::calcConcaveBoundary(
+    double cellSize, size_t nTrcBuffer)
+{
+  // extent of the survey
+  Eigen::MatrixXd hull = calcConvexHullBoundary(nTrcBuffer);
+  if (hull.rows() < 1)
+    return Eigen::MatrixXd();
+
+  h5geo::ConcaveBoundaryEstimator<double> estimator(
+        hull.col(0).minCoeff(), hull.col(1).minCoeff(),
+        hull.col(0).maxCoeff(), hull.col(1).maxCoeff(),
+        cellSize);
+
+  size_t nTrc = getNTrc();
+  for (size_t fromTrc = 0; fromTrc < nTrc; fromTrc += nTrcBuffer){
+    Eigen::VectorXd x = getTraceHeader("CDP_X", fromTrc, nTrcBuffer);
+    Eigen::VectorXd y = getTraceHeader("CDP_Y", fromTrc, nTrcBuffer);
+    if (x.size() < 1 || x.size() != y.size())
+      return Eigen::MatrixXd();
+
+    Eigen::MatrixX2d xy(x.size(), 2);
+    xy.col(0) = x;
+    xy.col(1) = y;
+    estimator.add(xy);
+  }
+
+  return estimator.getBoundary();
+}
+
+bool H5SeisImpl::updateBoundary(
+    const h5geo::BoundaryType& boundaryType,
+    double cellSize,
+    size_t nTrcBuffer)
+{
+  Eigen::MatrixXd boundary;
+  if (getDataType() == h5geo::SeisDataType::STACK &&
+      getSurveyType() == h5geo::SurveyType::TWO_D){
+    boundary = calcBoundaryStk2D();
+    return saveBoundary(boundary, h5geo::BoundaryType::LINE, 0);
+  } else if (boundaryType == h5geo::BoundaryType::CONCAVE){
+    boundary = calcConcaveBoundary(cellSize, nTrcBuffer);
+  } else {
+    boundary = calcConvexHullBoundary(nTrcBuffer);
+  }
+
+  return saveBoundary(boundary, boundaryType, cellSize);
+}
+
+bool H5SeisImpl::saveBoundary(
+    const Eigen::Ref<const Eigen::MatrixXd>& boundary,
+    h5geo::BoundaryType boundaryType,
+    double cellSize)
+{
+  if (boundary.rows() < 1 || boundary.cols() != 2)
+    return false;
+
+  // column-major Eigen matrix is written as row-major h5 dataset
+  // so that `X` and `Y` are stored as contiguous rows
+  try {
+    removeBoundary();
+    h5gt::DataSet dset = objG.createDataSet<double>(
+          std::string{h5geo::detail::boundary},
+          h5gt::DataSpace({2, (size_t)boundary.rows()}));
+    dset.write_raw(boundary.data());
+    h5geo::overwriteEnumAttribute(dset, "BoundaryType", boundaryType);
+    h5geo::overwriteAttribute(dset, "cellSize", cellSize);
+  } catch (h5gt::Exception& err) {
+    return false;
+  }
+
+  h5geo::flushUnlessBatch(objG.getFile());
+  return true;
+}
+
+bool H5SeisImpl::removeBoundary(){
+  std::string name = std::string{h5geo::detail::boundary};
+  try {
+    if (objG.hasObject(name, h5gt::ObjectType::Dataset))
+      objG.unlink(name);
+  } catch (h5gt::Exception& err) {
+    return false;
+  }
+  return true;
+}
 
-  return h5geo::quickHull2D(hdr);
+std::optional<h5gt::DataSet>
+H5SeisImpl::getBoundaryD() const
+{
+  return getDatasetOpt(objG, std::string{h5geo::detail::boundary});
+}
+
+void H5SeisImpl::removeCompositeSortsIfHdrChanged(
+    ptrdiff_t fromHdrInd, size_t nHdr)
+{
+  auto optCompositeG = getCompositeG();
+  if (!optCompositeG.has_value())
+    return;
+
+  auto isChanged = [fromHdrInd, nHdr](ptrdiff_t ind){
+    return ind >= fromHdrInd && ind < fromHdrInd + ptrdiff_t(nHdr);
+  };
+  for (const auto& name : optCompositeG->listObjectNames()){
+    bool changed = false;
+    size_t from = 0;
+    for (;;){
+      size_t to = name.find('-', from);
+      changed = isChanged(getTraceHeaderIndex(name.substr(from, to - from)));
+      if (changed || to == std::string::npos)
+        break;
+      from = to + 1;
+    }
+
+    try {
+      if (changed)
+        optCompositeG->unlink(name);
+    } catch (h5gt::Exception& err) {
+      continue;
+    }
+  }
+}
+
+void H5SeisImpl::removeBoundaryIfXYChanged(
+    ptrdiff_t fromHdrInd, size_t nHdr)
+{
+  if (!objG.hasObject(std::string{h5geo::detail::boundary},
+                      h5gt::ObjectType::Dataset))
+    return;
+
+  ptrdiff_t xInd = getTraceHeaderIndex("CDP_X");
+  ptrdiff_t yInd = getTraceHeaderIndex("CDP_Y");
+  auto isChanged = [fromHdrInd, nHdr](ptrdiff_t ind){
+    return ind >= fromHdrInd && ind < fromHdrInd + ptrdiff_t(nHdr);
+  };
+  if (isChanged(xInd) || isChanged(yInd))
+    removeBoundary();
 }
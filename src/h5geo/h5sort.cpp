@@ -1,4 +1,5 @@
 #include "../../include/h5geo/private/h5sort.h"
+#include "../../include/h5geo/private/h5profiler.h"
 #include "h5geo_export.h"
 
 #include <algorithm>    // std::sort, std::stable_sort
@@ -24,6 +25,8 @@ void _sort(
     Eigen::VectorX<ptrdiff_t>& idx,
     std::function<bool(ptrdiff_t, ptrdiff_t)> cmp_fun)
 {
+  H5GEO_PROFILE_SCOPE(prof, "h5geo::sort");
+  H5GEO_PROFILE_ADD(prof, addItems, M.rows());
   // initialize original index locations
   idx = Eigen::ArrayX<ptrdiff_t>::LinSpaced(
         M.rows(), 0, M.rows()-1);
@@ -0,0 +1,348 @@
+#include "../../include/h5geo/private/h5surveyinfo.h"
+#include "../../include/h5geo/h5core.h"
+
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+namespace h5geo
+{
+
+SurveyInfoEstimator::SurveyInfoEstimator(size_t sampleSize) :
+  sampleSize(sampleSize)
+{
+  reset();
+}
+
+void SurveyInfoEstimator::add(
+    const Eigen::Ref<const Eigen::VectorXd>& il,
+    const Eigen::Ref<const Eigen::VectorXd>& xl,
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y)
+{
+  if (il.size() != xl.size() ||
+      il.size() != x.size() ||
+      il.size() != y.size())
+    return;
+
+  for (ptrdiff_t i = 0; i < il.size(); i++){
+    if (std::isnan(il(i)) || std::isnan(xl(i)) ||
+        std::isnan(x(i)) || std::isnan(y(i)))
+      continue;
+
+    if (n == 0){
+      il0 = il(i);
+      xl0 = xl(i);
+      x0 = x(i);
+      y0 = y(i);
+    }
+
+    // number of lines is much smaller than number of traces
+    ilCounts[il(i)]++;
+    xlCounts[xl(i)]++;
+
+    // least squares sums for: [X, Y] = [1, IL, XL] * coef
+    Eigen::Vector3d a(1, il(i) - il0, xl(i) - xl0);
+    Eigen::RowVector2d b(x(i) - x0, y(i) - y0);
+    AtA.noalias() += a * a.transpose();
+    AtB.noalias() += a * b;
+
+    // reservoir sampling keeps uniformly distributed traces
+    if (n < sampleSize){
+      sample.row(n) << a(1), a(2), b(0), b(1);
+    } else {
+      std::uniform_int_distribution<size_t> dist(0, n);
+      size_t j = dist(rng);
+      if (j < sampleSize)
+        sample.row(j) << a(1), a(2), b(0), b(1);
+    }
+
+    n++;
+  }
+}
+
+bool SurveyInfoEstimator::estimate(SurveyInfo& info) const
+{
+  if (n < 1)
+    return false;
+
+  calcLineGrid(ilCounts, info.ilMin, info.ilMax, info.ilStep);
+  calcLineGrid(xlCounts, info.xlMin, info.xlMax, info.xlStep);
+  info.nIL = std::llround((info.ilMax - info.ilMin) / info.ilStep) + 1;
+  info.nXL = std::llround((info.xlMax - info.xlMin) / info.xlStep) + 1;
+  info.nTrc = n;
+
+  if (info.nIL * info.nXL < 2)
+    return false;
+
+  bool hasIL = info.nIL > 1;
+  bool hasXL = info.nXL > 1;
+  Eigen::Matrix<double,3,2> coef;
+  if (!fit(AtA, AtB, hasIL, hasXL, coef))
+    return false;
+
+  // Least median of squares on the sample: traces with broken coordinates
+  // don't affect the grid. Minimal subsets are fitted and the one with the
+  // smallest median residual is used to find inliers to refit the grid.
+  size_t nSample = std::min(n, sampleSize);
+  size_t nMin = 1 + size_t(hasIL) + size_t(hasXL);
+  auto calcResiduals = [](
+      const Eigen::Ref<const Eigen::MatrixX4d>& pts,
+      const Eigen::Matrix<double,3,2>& coef)->Eigen::VectorXd
+  {
+    return ((pts.leftCols(2) * coef.bottomRows(2)).rowwise() +
+            coef.row(0) - pts.rightCols(2)).rowwise().norm();
+  };
+  auto calcMedian = [](Eigen::VectorXd v)->double{
+    std::nth_element(v.begin(), v.begin() + v.size()/2, v.end());
+    return v(v.size()/2);
+  };
+
+  Eigen::VectorXd r = calcResiduals(sample.topRows(nSample), coef);
+  double bestMed = calcMedian(r);
+  if (nSample > nMin){
+    std::mt19937_64 gen(0);
+    std::uniform_int_distribution<size_t> dist(0, nSample-1);
+    Eigen::MatrixX4d pts(nMin, 4);
+    Eigen::Matrix<double,3,2> trialCoef;
+    for (size_t trial = 0; trial < 64; trial++){
+      for (size_t i = 0; i < nMin; i++)
+        pts.row(i) = sample.row(dist(gen));
+      if (!fit(pts, hasIL, hasXL, trialCoef))
+        continue;
+      double med = calcMedian(calcResiduals(sample.topRows(nSample), trialCoef));
+      if (med < bestMed){
+        bestMed = med;
+        coef = trialCoef;
+      }
+    }
+
+    double eps = 1e-9*(1 + std::max(std::fabs(x0), std::fabs(y0)));
+    for (size_t iter = 0; iter < 3; iter++){
+      r = calcResiduals(sample.topRows(nSample), coef);
+      double tol = std::max(3*1.4826*calcMedian(r), eps);
+      Eigen::VectorX<ptrdiff_t> ind = h5geo::find_index(r.array() <= tol);
+      if (ind.size() < ptrdiff_t(nMin) ||
+          !fit(sample(ind, Eigen::all), hasIL, hasXL, trialCoef))
+        break;
+      coef = trialCoef;
+    }
+  }
+
+  // outliers are excluded from residual
+  r = calcResiduals(sample.topRows(nSample), coef);
+  Eigen::VectorX<ptrdiff_t> inliers = h5geo::find_index(
+        r.array() <= std::max(3*1.4826*calcMedian(r), r.minCoeff()));
+  info.residual = std::sqrt(r(inliers).squaredNorm() / inliers.size());
+
+  // grid corners (IL_XL sorted) are enough to define the geometry
+  std::vector<double> ilCorners = {info.ilMin}, xlCorners = {info.xlMin};
+  if (hasIL)
+    ilCorners.push_back(info.ilMax);
+  if (hasXL)
+    xlCorners.push_back(info.xlMax);
+
+  ptrdiff_t nc = ilCorners.size()*xlCorners.size();
+  Eigen::VectorXd il_c(nc), xl_c(nc);
+  for (size_t i = 0; i < ilCorners.size(); i++){
+    for (size_t j = 0; j < xlCorners.size(); j++){
+      il_c(i*xlCorners.size()+j) = ilCorners[i];
+      xl_c(i*xlCorners.size()+j) = xlCorners[j];
+    }
+  }
+
+  Eigen::MatrixX3d A(nc, 3);
+  A.col(0).setOnes();
+  A.col(1) = il_c.array() - il0;
+  A.col(2) = xl_c.array() - xl0;
+  Eigen::MatrixX2d xy = A * coef;
+  xy.col(0).array() += x0;
+  xy.col(1).array() += y0;
+
+  bool status = h5geo::getSurveyInfoFromSortedData(
+        il_c, xl_c, xy.col(0), xy.col(1),
+        info.origin_x,
+        info.origin_y,
+        info.orientation,
+        info.ilSpacing,
+        info.xlSpacing,
+        info.isILReversed,
+        info.isXLReversed,
+        info.isPlanReversed);
+
+  if (!status)
+    return false;
+
+  // corners give spacings between the first and last lines
+  if (hasXL)
+    info.ilSpacing /= double(info.nXL - 1);
+  if (hasIL)
+    info.xlSpacing /= double(info.nIL - 1);
+
+  return true;
+}
+
+size_t SurveyInfoEstimator::getNTrc() const
+{
+  return n;
+}
+
+void SurveyInfoEstimator::reset()
+{
+  n = 0;
+  il0 = xl0 = x0 = y0 = 0;
+  ilCounts.clear();
+  xlCounts.clear();
+  AtA.setZero();
+  AtB.setZero();
+  sample.resize(sampleSize, Eigen::NoChange);
+  rng.seed(0);
+}
+
+void SurveyInfoEstimator::calcLineGrid(
+    const std::map<double, size_t>& counts,
+    double& minVal, double& maxVal, double& step)
+{
+  step = 1;
+  if (counts.empty())
+    return;
+
+  // increment is the most common distance between adjacent lines:
+  // unlike greatest common divisor it isn't spoiled by a few odd values
+  std::map<long long, size_t> diffCounts;
+  for (auto it = std::next(counts.begin()); it != counts.end(); it++){
+    long long diff = std::llround(it->first - std::prev(it)->first);
+    if (diff > 0)
+      diffCounts[diff]++;
+  }
+
+  size_t maxCount = 0;
+  for (const auto& [diff, count] : diffCounts){
+    if (count > maxCount){
+      step = double(diff);
+      maxCount = count;
+    }
+  }
+
+  // lines off the grid defined by the majority of traces don't set limits
+  long long istep = std::llround(step);
+  double first = counts.begin()->first;
+  std::map<long long, size_t> remCounts;
+  for (const auto& [val, count] : counts){
+    long long rem = std::llround(val - first) % istep;
+    remCounts[rem] += count;
+  }
+
+  long long bestRem = 0;
+  maxCount = 0;
+  for (const auto& [rem, count] : remCounts){
+    if (count > maxCount){
+      bestRem = rem;
+      maxCount = count;
+    }
+  }
+
+  bool found = false;
+  for (const auto& [val, count] : counts){
+    if (std::llround(val - first) % istep != bestRem)
+      continue;
+
+    if (!found)
+      minVal = val;
+    maxVal = val;
+    found = true;
+  }
+}
+
+bool SurveyInfoEstimator::fit(
+    const Eigen::Ref<const Eigen::MatrixX4d>& pts,
+    bool hasIL, bool hasXL,
+    Eigen::Matrix<double,3,2>& coef) const
+{
+  Eigen::MatrixX3d A(pts.rows(), 3);
+  A.col(0).setOnes();
+  A.rightCols(2) = pts.leftCols(2);
+  return fit(A.transpose() * A, A.transpose() * pts.rightCols(2),
+             hasIL, hasXL, coef);
+}
+
+bool SurveyInfoEstimator::fit(
+    const Eigen::Matrix3d& AtA,
+    const Eigen::Matrix<double,3,2>& AtB,
+    bool hasIL, bool hasXL,
+    Eigen::Matrix<double,3,2>& coef) const
+{
+  coef.setZero();
+  std::vector<ptrdiff_t> ind = {0};
+  if (hasIL)
+    ind.push_back(1);
+  if (hasXL)
+    ind.push_back(2);
+
+  // 2D lines: only one of IL/XL varies
+  Eigen::MatrixXd M = AtA(ind, ind);
+  Eigen::MatrixXd B = AtB(ind, Eigen::all);
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr(M);
+  if (qr.rank() < M.rows())
+    return false;
+
+  coef(ind, Eigen::all) = qr.solve(B);
+  return coef.allFinite();
+}
+
+Eigen::VectorX<ptrdiff_t> getSurveyCellIndexes(
+    const SurveyInfo& info,
+    const Eigen::Ref<const Eigen::VectorXd>& il,
+    const Eigen::Ref<const Eigen::VectorXd>& xl)
+{
+  if (il.size() != xl.size() ||
+      info.nIL < 1 || info.nXL < 1 ||
+      info.ilStep == 0 || info.xlStep == 0)
+    return Eigen::VectorX<ptrdiff_t>();
+
+  Eigen::VectorX<ptrdiff_t> cells(il.size());
+  for (ptrdiff_t i = 0; i < il.size(); i++){
+    double fil = (il(i) - info.ilMin) / info.ilStep;
+    double fxl = (xl(i) - info.xlMin) / info.xlStep;
+    long long iil = std::llround(fil);
+    long long ixl = std::llround(fxl);
+    if (std::isnan(fil) || std::isnan(fxl) ||
+        std::fabs(fil - iil) > 1e-3 || std::fabs(fxl - ixl) > 1e-3 ||
+        iil < 0 || iil >= (long long)info.nIL ||
+        ixl < 0 || ixl >= (long long)info.nXL){
+      cells(i) = -1;
+      continue;
+    }
+    cells(i) = iil * info.nXL + ixl;
+  }
+  return cells;
+}
+
+Eigen::VectorX<ptrdiff_t> getSurveyVolIndexes(
+    const SurveyInfo& info,
+    const Eigen::Ref<const Eigen::VectorX<ptrdiff_t>>& cells)
+{
+  ptrdiff_t nX = info.getVolNX();
+  ptrdiff_t nY = info.getVolNY();
+  Eigen::VectorX<ptrdiff_t> volInd(cells.size());
+  for (ptrdiff_t i = 0; i < cells.size(); i++){
+    if (cells(i) < 0 || cells(i) >= nX*nY){
+      volInd(i) = -1;
+      continue;
+    }
+
+    ptrdiff_t iIL = cells(i) / info.nXL;
+    ptrdiff_t iXL = cells(i) % info.nXL;
+    ptrdiff_t iX = info.isPlanReversed ? iIL : iXL;
+    ptrdiff_t iY = info.isPlanReversed ? iXL : iIL;
+    if (info.isXLReversed)
+      iX = nX-1-iX;
+    if (info.isILReversed)
+      iY = nY-1-iY;
+
+    volInd(i) = iY*nX + iX;
+  }
+  return volInd;
+}
+
+} // h5geo
@@ -0,0 +1,329 @@
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES   // should be before <cmath>, include 'pi' val
+#endif
+#include "../../include/h5geo/private/h5trajectory.h"
+
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+#include <vector>
+
+namespace h5geo
+{
+
+namespace {
+
+enum : Eigen::Index { MD_COL, X_COL, Y_COL, TVD_COL, AZIM_COL, INCL_COL };
+
+// unit tangent (East, North, Down)
+Eigen::Vector3d tangent(double azim, double incl){
+  return Eigen::Vector3d(
+        std::sin(incl)*std::sin(azim),
+        std::sin(incl)*std::cos(azim),
+        std::cos(incl));
+}
+
+double ratioFactor(double B){
+  if (B < 1e-9)
+    return 1;
+  return 2 / B * std::tan(B / 2);
+}
+
+// displacement and tangent after passing fraction `f` of the minimum
+// curvature arc of length `L` going from `t1` to `t2` (dogleg `B`)
+Eigen::Vector3d arcDelta(
+    const Eigen::Vector3d& t1,
+    const Eigen::Vector3d& t2,
+    double B, double L, double f,
+    Eigen::Vector3d& t)
+{
+  double sinB = std::sin(B);
+  if (B < 1e-9 || sinB < 1e-9){
+    t = (t1 + f*(t2 - t1)).normalized();
+    if (!t.allFinite())
+      t = t1;
+  } else {
+    t = (std::sin(B - f*B)*t1 + std::sin(f*B)*t2) / sinB;
+  }
+  return f*L/2*ratioFactor(f*B)*(t1 + t);
+}
+
+double dogleg(const Eigen::Vector3d& t1, const Eigen::Vector3d& t2){
+  return std::acos(std::clamp(t1.dot(t2), -1.0, 1.0));
+}
+
+} // namespace
+
+
+bool TimeDepthCurve::isValid() const {
+  if (tvdss.size() != twt.size())
+    return false;
+  if (tvdss.size() < 1)
+    return std::isfinite(velocity) && velocity != 0;
+  for (ptrdiff_t i = 1; i < tvdss.size(); i++)
+    if (!(tvdss(i) > tvdss(i-1)))
+      return false;
+  return tvdss.allFinite() && twt.allFinite();
+}
+
+Eigen::VectorXd TimeDepthCurve::tvdssToTwt(
+    const Eigen::Ref<const Eigen::VectorXd>& depth) const
+{
+  Eigen::VectorXd out = Eigen::VectorXd::Constant(depth.size(), std::nan("nan"));
+  if (!isValid())
+    return out;
+
+  ptrdiff_t n = tvdss.size();
+  const double* first = tvdss.data();
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel for
+#endif
+  for (ptrdiff_t i = 0; i < depth.size(); i++){
+    double d = depth(i);
+    if (std::isnan(d))
+      continue;
+
+    if (n < 1){
+      out(i) = 2*d/velocity;
+    } else if (d <= tvdss(0) || n < 2){
+      // extrapolation with replacement velocity (NaN if it is not set)
+      out(i) = d == tvdss(0) ? twt(0) : twt(0) + 2*(d - tvdss(0))/velocity;
+    } else if (d >= tvdss(n-1)){
+      out(i) = d == tvdss(n-1) ? twt(n-1) : twt(n-1) + 2*(d - tvdss(n-1))/velocity;
+    } else {
+      ptrdiff_t k = std::upper_bound(first, first + n, d) - first;
+      double f = (d - tvdss(k-1)) / (tvdss(k) - tvdss(k-1));
+      out(i) = twt(k-1) + f*(twt(k) - twt(k-1));
+    }
+  }
+  return out;
+}
+
+
+Trajectory::Trajectory(
+    const Eigen::Ref<const Eigen::MatrixXd>& M,
+    double kb) :
+  kb(kb)
+{
+  if (M.cols() != 6)
+    return;
+
+  std::vector<Eigen::Index> ind;
+  ind.reserve(M.rows());
+  for (Eigen::Index i = 0; i < M.rows(); i++)
+    if (!std::isnan(M(i, MD_COL)))
+      ind.push_back(i);
+
+  std::stable_sort(ind.begin(), ind.end(),
+                   [&M](Eigen::Index a, Eigen::Index b){
+    return M(a, MD_COL) < M(b, MD_COL);
+  });
+
+  stations.resize(ind.size(), 6);
+  tvdMax.resize(ind.size());
+  for (size_t i = 0; i < ind.size(); i++){
+    stations.row(i) = M.row(ind[i]);
+    tvdMax(i) = i > 0 ?
+          std::max(tvdMax(i-1), stations(i, TVD_COL)) :
+          stations(i, TVD_COL);
+  }
+}
+
+bool Trajectory::isValid() const {
+  return stations.rows() > 0;
+}
+
+size_t Trajectory::getNSamp() const {
+  return stations.rows();
+}
+
+double Trajectory::getKB() const {
+  return kb;
+}
+
+const Eigen::MatrixXd& Trajectory::getStations() const {
+  return stations;
+}
+
+Trajectory Trajectory::resample(double step) const {
+  if (!isValid() || !(step > 0))
+    return *this;
+
+  double md0 = stations(0, MD_COL);
+  double md1 = stations(stations.rows()-1, MD_COL);
+  Eigen::Index n = Eigen::Index(std::floor((md1 - md0) / step)) + 1;
+  if (md0 + (n-1)*step < md1)
+    n++;
+
+  Eigen::MatrixXd M(n, 6);
+  for (Eigen::Index i = 0; i < n; i++){
+    double md = std::min(md0 + i*step, md1);
+    Eigen::Index s = findSegmentByMD(md);
+    M(i, MD_COL) = md;
+    M.row(i).segment(X_COL, 3) = interpolate(s, md, true).transpose();
+
+    // direction along the arc
+    if (s+1 < stations.rows() &&
+        stations(s+1, MD_COL) > stations(s, MD_COL)){
+      Eigen::Vector3d t1 = tangent(stations(s, AZIM_COL), stations(s, INCL_COL));
+      Eigen::Vector3d t2 = tangent(stations(s+1, AZIM_COL), stations(s+1, INCL_COL));
+      double f = (md - stations(s, MD_COL)) /
+          (stations(s+1, MD_COL) - stations(s, MD_COL));
+      Eigen::Vector3d t;
+      arcDelta(t1, t2, dogleg(t1, t2), 0, f, t);
+      double azim = std::atan2(t(0), t(1));
+      M(i, AZIM_COL) = azim < 0 ? azim + 2*M_PI : azim;
+      M(i, INCL_COL) = std::acos(std::clamp(t(2), -1.0, 1.0));
+    } else {
+      M(i, AZIM_COL) = stations(s, AZIM_COL);
+      M(i, INCL_COL) = stations(s, INCL_COL);
+    }
+  }
+  return Trajectory(M, kb);
+}
+
+Eigen::MatrixXd Trajectory::mdToXYTvd(
+    const Eigen::Ref<const Eigen::VectorXd>& md,
+    bool minCurvature) const
+{
+  Eigen::MatrixXd out(md.size(), 4);
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel for
+#endif
+  for (ptrdiff_t i = 0; i < md.size(); i++){
+    ptrdiff_t s = findSegmentByMD(md(i));
+    if (s < 0){
+      out.row(i).setConstant(std::nan("nan"));
+      continue;
+    }
+    Eigen::Vector3d p = interpolate(s, md(i), minCurvature);
+    out(i, 0) = p(0);
+    out(i, 1) = p(1);
+    out(i, 2) = p(2);
+    out(i, 3) = p(2) - kb;
+  }
+  return out;
+}
+
+Eigen::VectorXd Trajectory::tvdToMd(
+    const Eigen::Ref<const Eigen::VectorXd>& tvd,
+    bool minCurvature) const
+{
+  Eigen::VectorXd out(tvd.size());
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel for
+#endif
+  for (ptrdiff_t i = 0; i < tvd.size(); i++){
+    double t = tvd(i);
+    out(i) = std::nan("nan");
+    if (std::isnan(t))
+      continue;
+
+    // first station where the well reaches `t`
+    auto it = std::lower_bound(tvdMax.data(), tvdMax.data() + tvdMax.size(), t);
+    ptrdiff_t k = it - tvdMax.data();
+    if (k >= tvdMax.size())
+      continue;
+
+    if (k == 0){
+      if (stations(0, TVD_COL) == t)
+        out(i) = stations(0, MD_COL);
+      continue;
+    }
+
+    // `t` is crossed within segment [k-1, k]
+    double md1 = stations(k-1, MD_COL);
+    double md2 = stations(k, MD_COL);
+    double tvd1 = stations(k-1, TVD_COL);
+    double tvd2 = stations(k, TVD_COL);
+    if (!minCurvature || !(tvd2 > tvd1)){
+      out(i) = tvd2 > tvd1 ?
+            md1 + (t - tvd1) / (tvd2 - tvd1) * (md2 - md1) :
+            md2;
+      continue;
+    }
+
+    // `TVD` along the arc is continuous: bisection converges to a crossing
+    double lo = md1, hi = md2;
+    for (size_t iter = 0; iter < 60 && hi - lo > 0; iter++){
+      double mid = (lo + hi) / 2;
+      if (interpolate(k-1, mid, true)(2) < t)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    out(i) = hi;
+  }
+  return out;
+}
+
+Eigen::MatrixXd Trajectory::mdToXYZ(
+    const Eigen::Ref<const Eigen::VectorXd>& md,
+    const h5geo::Domain& domain,
+    const TimeDepthCurve& tdCurve,
+    bool minCurvature) const
+{
+  Eigen::MatrixXd XYTvd = mdToXYTvd(md, minCurvature);
+  Eigen::MatrixXd out(md.size(), 3);
+  out.leftCols(2) = XYTvd.leftCols(2);
+  switch (domain) {
+  case h5geo::Domain::TVD :
+    out.col(2) = XYTvd.col(2);
+    break;
+  case h5geo::Domain::TVDSS :
+    out.col(2) = XYTvd.col(3);
+    break;
+  case h5geo::Domain::TWT :
+    out.col(2) = tdCurve.tvdssToTwt(XYTvd.col(3));
+    break;
+  case h5geo::Domain::OWT :
+    out.col(2) = tdCurve.tvdssToTwt(XYTvd.col(3)) / 2;
+    break;
+  default:
+    out.setConstant(std::nan("nan"));
+  }
+  return out;
+}
+
+Eigen::Vector3d Trajectory::interpolate(
+    ptrdiff_t i, double md, bool minCurvature) const
+{
+  Eigen::Vector3d p1 = stations.row(i).segment(X_COL, 3).transpose();
+  if (i+1 >= stations.rows())
+    return p1;
+
+  Eigen::Vector3d p2 = stations.row(i+1).segment(X_COL, 3).transpose();
+  double L = stations(i+1, MD_COL) - stations(i, MD_COL);
+  if (!(L > 0))
+    return p1;
+
+  double f = (md - stations(i, MD_COL)) / L;
+  if (!minCurvature)
+    return p1 + f*(p2 - p1);
+
+  Eigen::Vector3d t1 = tangent(stations(i, AZIM_COL), stations(i, INCL_COL));
+  Eigen::Vector3d t2 = tangent(stations(i+1, AZIM_COL), stations(i+1, INCL_COL));
+  double B = dogleg(t1, t2);
+  Eigen::Vector3d t;
+  Eigen::Vector3d d = arcDelta(t1, t2, B, L, f, t);
+  Eigen::Vector3d dFull = arcDelta(t1, t2, B, L, 1, t);
+  // stations may be not exactly on the arc (i.e. `TVD`, `DX`, `DY` were
+  // written independently of `AZIM`, `INCL`): distribute the misfit
+  // linearly so that interpolation passes through both stations
+  return p1 + d + f*(p2 - p1 - dFull);
+}
+
+ptrdiff_t Trajectory::findSegmentByMD(double md) const {
+  ptrdiff_t n = stations.rows();
+  if (n < 1 || std::isnan(md) ||
+      md < stations(0, MD_COL) ||
+      md > stations(n-1, MD_COL))
+    return -1;
+
+  const double* first = stations.col(MD_COL).data();
+  ptrdiff_t k = std::upper_bound(first, first + n, md) - first;
+  return std::min(k-1, n-1);
+}
+
+
+} // h5geo
@@ -0,0 +1,60 @@
+#include "../../include/h5geo/private/h5units.h"
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+#include <units/units.hpp>
+
+namespace h5geo
+{
+
+namespace {
+
+typedef std::map<std::pair<std::string, std::string>, double> FactorMap;
+
+// readers share the lock, writers only add new pairs
+std::shared_mutex& factorsMutex(){
+  static std::shared_mutex m;
+  return m;
+}
+
+FactorMap& factors(){
+  static FactorMap f;
+  return f;
+}
+
+} // namespace
+
+
+double getConversionFactor(
+    const std::string& unitsFrom,
+    const std::string& unitsTo)
+{
+  auto key = std::make_pair(unitsFrom, unitsTo);
+  {
+    std::shared_lock lock(factorsMutex());
+    auto it = factors().find(key);
+    if (it != factors().end())
+      return it->second;
+  }
+
+  // parsing is done without lock: the same pair may be parsed twice
+  // by concurrent threads but the result is the same
+  double coef = units::convert(
+        units::unit_from_string(unitsFrom),
+        units::unit_from_string(unitsTo));
+
+  std::unique_lock lock(factorsMutex());
+  factors().emplace(std::move(key), coef);
+  return coef;
+}
+
+void clearConversionFactors(){
+  std::unique_lock lock(factorsMutex());
+  factors().clear();
+}
+
+
+} // h5geo
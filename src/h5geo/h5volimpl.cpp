@@ -1,9 +1,14 @@
 #include "../../include/h5geo/private/h5volimpl.h"
 #include "../../include/h5geo/h5volcontainer.h"
+#include "../../include/h5geo/h5horizon.h"
+#include "../../include/h5geo/h5map.h"
+#include "../../include/h5geo/h5mapcontainer.h"
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/private/h5enum_string.h"
+#include "../../include/h5geo/private/h5profiler.h"
 
-#include <units/units.hpp>
+#include <algorithm>
+#include <tuple>
 
 #ifdef H5GEO_USE_GDAL
 #include <gdal.h>
@@ -11,7 +16,16 @@
 #endif
 
 H5VolImpl::H5VolImpl(const h5gt::Group &group) :
-  H5BaseObjectImpl(group){}
+  H5BaseObjectImpl(group),
+  dataBatch([this](
+            const std::vector<DataRequest>& reqs,
+            std::vector<std::promise<Eigen::MatrixXf>>& proms){
+  processDataRequests(reqs, proms);
+}){
+#ifdef H5GEO_USE_MPI
+  mpiIO = h5geo::isMPIFile(objG.getFile());
+#endif
+}
 
 bool H5VolImpl::writeData(
     Eigen::Ref<Eigen::MatrixXf> data,
@@ -23,6 +37,9 @@ bool H5VolImpl::writeData(
     const size_t& nZ,
     const std::string& dataUnits)
 {
+  dataBatch.wait();
+  H5GEO_PROFILE_SCOPE(prof, "H5Vol::writeData");
+  H5GEO_PROFILE_ADD(prof, addSelections, 1);
   auto opt = this->getVolD();
   if (!opt.has_value())
     return false;
@@ -31,21 +48,50 @@ bool H5VolImpl::writeData(
   if (dims.size() != 3)
     return false;
 
+#ifdef H5GEO_USE_MPI
+  if (mpiIO){
+    bool val = data.size() == nX*nY*nZ &&
+        (data.cols() < 2 || data.outerStride() == data.rows()) &&
+        iX0+nX <= dims[2] &&
+        iY0+nY <= dims[1] &&
+        iZ0+nZ <= dims[0];
+    std::string unitsTo = getDataUnits();
+    double coef = 1;
+    if (val && !unitsTo.empty() && !dataUnits.empty()){
+      coef = h5geo::getConversionFactor(dataUnits, unitsTo);
+      val = !isnan(coef);
+    }
+    // collective write is done by a single call on every rank thus
+    // the brick can't be written by parts: scale a copy instead
+    Eigen::MatrixXf scaled;
+    if (val && coef != 1)
+      scaled = data*coef;
+    // rank with invalid brick still takes part in collective write
+    return h5geo::writeCollective(
+          *opt, {iZ0, iY0, iX0},
+          {val ? nZ : 0, nY, nX},
+          scaled.size() > 0 ? scaled.data() : data.data()) && val;
+  }
+#endif
+
   if (iX0+nX > dims[2] ||
       iY0+nY > dims[1] ||
       iZ0+nZ > dims[0])
     return false;
 
+  double coef = 1;
   std::string unitsTo = getDataUnits();
   if (!unitsTo.empty() && !dataUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(dataUnits),
-          units::unit_from_string(unitsTo));
-    data = data*coef;
+    coef = h5geo::getConversionFactor(dataUnits, unitsTo);
+    if (isnan(coef))
+      return false;
   }
 
-  opt->select({iZ0, iY0, iX0},
-              {nZ, nY, nX}).write_raw(data.data());
+  // user's data isn't modified: it is scaled by parts while writing
+  if (!h5geo::writeScaledHyperslab(
+        *opt, {iZ0, iY0, iX0}, {nZ, nY, nX}, data.data(), coef))
+    return false;
+  H5GEO_PROFILE_ADD(prof, addBytesWritten, nX*nY*nZ*sizeof(float));
   return true;
 }
 
@@ -93,9 +139,7 @@ bool H5VolImpl::setOrigin(
   std::string lengthUnitsTo = getLengthUnits();
   double coef = 1.0;
   if (!lengthUnits.empty() && !lengthUnitsTo.empty()){
-    coef = units::convert(
-          units::unit_from_string(lengthUnits),
-          units::unit_from_string(lengthUnitsTo));
+    coef = h5geo::getConversionFactor(lengthUnits, lengthUnitsTo);
 
     v(0) = v(0)*coef;
     v(1) = v(1)*coef;
@@ -106,9 +150,7 @@ bool H5VolImpl::setOrigin(
       domain == h5geo::Domain::TWT){
     std::string temporalUnitsTo = getTemporalUnits();
     if (!temporalUnits.empty() && !temporalUnitsTo.empty()){
-      coef = units::convert(
-            units::unit_from_string(temporalUnits),
-            units::unit_from_string(temporalUnitsTo));
+      coef = h5geo::getConversionFactor(temporalUnits, temporalUnitsTo);
 
       v(2) = v(2)*coef;
     }
@@ -122,7 +164,7 @@ bool H5VolImpl::setOrigin(
     OGRCT_ptr coordTrans(createCoordinateTransformationToWriteData(lengthUnitsTo));
     if (coordTrans){
       coordTrans->Transform(1, &v(0), &v(1));
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
   }
@@ -142,9 +184,7 @@ bool H5VolImpl::setSpacings(
   std::string lengthUnitsTo = getLengthUnits();
   double coef = 1.0;
   if (!lengthUnits.empty() && !lengthUnitsTo.empty()){
-    coef = units::convert(
-          units::unit_from_string(lengthUnits),
-          units::unit_from_string(lengthUnitsTo));
+    coef = h5geo::getConversionFactor(lengthUnits, lengthUnitsTo);
 
     v(0) = v(0)*coef;
     v(1) = v(1)*coef;
@@ -155,9 +195,7 @@ bool H5VolImpl::setSpacings(
       domain == h5geo::Domain::TWT){
     std::string temporalUnitsTo = getTemporalUnits();
     if (!temporalUnits.empty() && !temporalUnitsTo.empty()){
-      coef = units::convert(
-            units::unit_from_string(temporalUnits),
-            units::unit_from_string(temporalUnitsTo));
+      coef = h5geo::getConversionFactor(temporalUnits, temporalUnitsTo);
 
       v(2) = v(2)*coef;
     }
@@ -211,33 +249,155 @@ Eigen::MatrixXf H5VolImpl::getData(
     const size_t& nZ,
     const std::string& dataUnits)
 {
+  dataBatch.wait();
+  Eigen::MatrixXf data(nX*nY, nZ);
+  if (!readData(data, iX0, iY0, iZ0, nX, nY, nZ, dataUnits))
+    return Eigen::MatrixXf();
+
+  return data;
+}
+
+bool H5VolImpl::readData(
+    Eigen::Ref<Eigen::MatrixXf> data,
+    const size_t& iX0,
+    const size_t& iY0,
+    const size_t& iZ0,
+    const size_t& nX,
+    const size_t& nY,
+    const size_t& nZ,
+    const std::string& dataUnits)
+{
+  H5GEO_PROFILE_SCOPE(prof, "H5Vol::readData");
+  H5GEO_PROFILE_ADD(prof, addSelections, 1);
   auto opt = this->getVolD();
   if (!opt.has_value())
-    return Eigen::MatrixXf();
+    return false;
 
   std::vector<size_t> dims = opt->getDimensions();
   if (dims.size() != 3)
-    return Eigen::MatrixXf();
+    return false;
 
-  if (iX0+nX > dims[2] ||
-      iY0+nY > dims[1] ||
-      iZ0+nZ > dims[0])
-    return Eigen::MatrixXf();
+  bool val = data.rows() == nX*nY && data.cols() == nZ &&
+      (data.cols() < 2 || data.outerStride() == data.rows()) &&
+      iX0+nX <= dims[2] &&
+      iY0+nY <= dims[1] &&
+      iZ0+nZ <= dims[0];
 
-  Eigen::MatrixXf data(nX*nY, nZ);
-  opt->select({iZ0, iY0, iX0},
-              {nZ, nY, nX}).read(data.data());
-  if (!dataUnits.empty()){
-    double coef = units::convert(
-          units::unit_from_string(getDataUnits()),
-          units::unit_from_string(dataUnits));
-    if (!isnan(coef))
-      return data*coef;
+  double coef = 1;
+  if (val && !dataUnits.empty()){
+    coef = h5geo::getConversionFactor(getDataUnits(), dataUnits);
+    val = !isnan(coef);
+  }
 
-    return Eigen::MatrixXf();
+#ifdef H5GEO_USE_MPI
+  if (mpiIO){
+    // rank with invalid brick still takes part in collective read
+    val = h5geo::readCollective(
+          *opt, {iZ0, iY0, iX0},
+          {val ? nZ : 0, nY, nX}, data.data()) && val;
+    if (val && coef != 1)
+      data *= coef;
+    return val;
   }
+#endif
 
-  return data;
+  if (!val)
+    return false;
+
+  try {
+    opt->select({iZ0, iY0, iX0},
+                {nZ, nY, nX}).read(data.data());
+  } catch (h5gt::Exception& err) {
+    return false;
+  }
+  H5GEO_PROFILE_ADD(prof, addBytesRead, nX*nY*nZ*sizeof(float));
+
+  if (coef != 1){
+    H5GEO_PROFILE_SCOPE(profUnits, "H5Vol::readData:units");
+    data *= coef;
+  }
+
+  return true;
+}
+
+std::future<Eigen::MatrixXf> H5VolImpl::getDataAsync(
+    const size_t& iX0,
+    const size_t& iY0,
+    const size_t& iZ0,
+    const size_t& nX,
+    const size_t& nY,
+    const size_t& nZ,
+    const std::string& dataUnits)
+{
+  return dataBatch.enqueue(
+        DataRequest{iX0, iY0, iZ0, nX, nY, nZ, dataUnits});
+}
+
+void H5VolImpl::processDataRequests(
+    const std::vector<DataRequest>& reqs,
+    std::vector<std::promise<Eigen::MatrixXf>>& proms)
+{
+  std::vector<size_t> dims;
+  auto opt = this->getVolD();
+  if (opt.has_value())
+    dims = opt->getDimensions();
+
+  // each brick is checked before coalescing so that invalid one
+  // gets empty result instead of spoiling the merged read
+  std::vector<size_t> ind;
+  ind.reserve(reqs.size());
+  for (size_t i = 0; i < reqs.size(); i++){
+    const DataRequest& r = reqs[i];
+    if (dims.size() != 3 ||
+        r.nX < 1 || r.nY < 1 || r.nZ < 1 ||
+        r.iX0+r.nX > dims[2] ||
+        r.iY0+r.nY > dims[1] ||
+        r.iZ0+r.nZ > dims[0]){
+      proms[i].set_value(Eigen::MatrixXf());
+      continue;
+    }
+    ind.push_back(i);
+  }
+
+  std::sort(ind.begin(), ind.end(), [&reqs](size_t a, size_t b){
+    const DataRequest& ra = reqs[a];
+    const DataRequest& rb = reqs[b];
+    return std::tie(ra.iX0, ra.nX, ra.iY0, ra.nY, ra.dataUnits, ra.iZ0) <
+        std::tie(rb.iX0, rb.nX, rb.iY0, rb.nY, rb.dataUnits, rb.iZ0);
+  });
+
+  for (size_t i = 0; i < ind.size();){
+    // `Z` is the slowest dimension: bricks with the same `X`, `Y` window
+    // whose `Z` ranges overlap or touch each other are read by one hyperslab
+    const DataRequest& first = reqs[ind[i]];
+    size_t toZ = first.iZ0 + first.nZ;
+    size_t j = i+1;
+    for (; j < ind.size(); j++){
+      const DataRequest& next = reqs[ind[j]];
+      if (next.iX0 != first.iX0 || next.nX != first.nX ||
+          next.iY0 != first.iY0 || next.nY != first.nY ||
+          next.dataUnits != first.dataUnits ||
+          next.iZ0 > toZ)
+        break;
+      toZ = std::max(toZ, next.iZ0 + next.nZ);
+    }
+
+    Eigen::MatrixXf data = getData(
+          first.iX0, first.iY0, first.iZ0,
+          first.nX, first.nY, toZ - first.iZ0,
+          first.dataUnits);
+    for (size_t k = i; k < j; k++){
+      if (data.size() < 1)
+        proms[ind[k]].set_value(Eigen::MatrixXf());
+      else if (j-i == 1)
+        proms[ind[k]].set_value(std::move(data));
+      else
+        proms[ind[k]].set_value(data.middleCols(
+                                  reqs[ind[k]].iZ0 - first.iZ0,
+                                  reqs[ind[k]].nZ));
+    }
+    i = j;
+  }
 }
 
 h5geo::Domain H5VolImpl::getDomain(){
@@ -261,9 +421,7 @@ Eigen::VectorXd H5VolImpl::getOrigin(
   std::string lengthUnitsFrom = getLengthUnits();
   double coef = 1.0;
   if (!lengthUnitsFrom.empty() && !lengthUnits.empty()){
-    coef = units::convert(
-          units::unit_from_string(lengthUnitsFrom),
-          units::unit_from_string(lengthUnits));
+    coef = h5geo::getConversionFactor(lengthUnitsFrom, lengthUnits);
 
     v(0) = v(0)*coef;
     v(1) = v(1)*coef;
@@ -274,9 +432,7 @@ Eigen::VectorXd H5VolImpl::getOrigin(
       domain == h5geo::Domain::TWT){
     std::string temporalUnitsFrom = getTemporalUnits();
     if (!temporalUnitsFrom.empty() && !temporalUnits.empty()){
-      coef = units::convert(
-            units::unit_from_string(temporalUnitsFrom),
-            units::unit_from_string(temporalUnits));
+      coef = h5geo::getConversionFactor(temporalUnitsFrom, temporalUnits);
 
       v(2) = v(2)*coef;
     }
@@ -290,7 +446,7 @@ Eigen::VectorXd H5VolImpl::getOrigin(
     OGRCT_ptr coordTrans(createCoordinateTransformationToReadData(lengthUnitsFrom));
     if (coordTrans){
       coordTrans->Transform(1, &v(0), &v(1));
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return Eigen::VectorXd();
     }
   }
@@ -313,9 +469,7 @@ Eigen::VectorXd H5VolImpl::getSpacings(
   std::string lengthUnitsFrom = getLengthUnits();
   double coef = 1.0;
   if (!lengthUnitsFrom.empty() && !lengthUnits.empty()){
-    coef = units::convert(
-          units::unit_from_string(lengthUnitsFrom),
-          units::unit_from_string(lengthUnits));
+    coef = h5geo::getConversionFactor(lengthUnitsFrom, lengthUnits);
 
     v(0) = v(0)*coef;
     v(1) = v(1)*coef;
@@ -326,9 +480,7 @@ Eigen::VectorXd H5VolImpl::getSpacings(
       domain == h5geo::Domain::TWT){
     std::string temporalUnitsFrom = getTemporalUnits();
     if (!temporalUnitsFrom.empty() && !temporalUnits.empty()){
-      coef = units::convert(
-            units::unit_from_string(temporalUnitsFrom),
-            units::unit_from_string(temporalUnits));
+      coef = h5geo::getConversionFactor(temporalUnitsFrom, temporalUnits);
 
       v(2) = v(2)*coef;
     }
@@ -396,6 +548,7 @@ H5VolParam H5VolImpl::getParam()
   p.temporalUnits = getTemporalUnits();
   p.angularUnits = getAngularUnits();
   p.dataUnits = getDataUnits();
+  p.nullValue = getNullValue();
 
   // H5VolParam
   Eigen::VectorXd origin = getOrigin();
@@ -452,6 +605,226 @@ H5VolImpl::getVolD() const
   return getDatasetOpt(objG, name);
 }
 
+Eigen::VectorXd H5VolImpl::calcWindowAttribute(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y,
+    const Eigen::Ref<const Eigen::VectorXd>& z,
+    double windowAbove,
+    double windowBelow,
+    const h5geo::WindowAttribute& attribute,
+    const std::string& lengthUnits,
+    const std::string& zUnits)
+{
+  float nullValue = this->getNullValue();
+  return this->reduceWindows(
+        x, y, z, windowAbove, windowBelow, 0,
+        [&attribute, nullValue](const Eigen::Ref<const Eigen::VectorXf>& v, double){
+    return h5geo::calcWindowAttribute(v, attribute, nullValue);
+  }, lengthUnits, zUnits);
+}
+
+Eigen::VectorXd H5VolImpl::interpolateAmplitudes(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y,
+    const Eigen::Ref<const Eigen::VectorXd>& z,
+    const std::string& lengthUnits,
+    const std::string& zUnits)
+{
+  // one neighbour sample on each side of `z`
+  float nullValue = this->getNullValue();
+  return this->reduceWindows(
+        x, y, z, 0, 0, 1,
+        [nullValue](const Eigen::Ref<const Eigen::VectorXf>& v, double pos){
+    return h5geo::interpolateSample(v, pos, nullValue);
+  }, lengthUnits, zUnits);
+}
+
+Eigen::VectorXd H5VolImpl::extractAlongTrajectory(
+    const h5geo::Trajectory& traj,
+    const Eigen::Ref<const Eigen::VectorXd>& md,
+    const h5geo::TimeDepthCurve& tdCurve,
+    const std::string& lengthUnits,
+    const std::string& temporalUnits)
+{
+  return h5geo::extractAlongTrajectory(
+        traj, md, tdCurve, this->getDomain(), lengthUnits, temporalUnits,
+        [this](const Eigen::Ref<const Eigen::VectorXd>& x,
+               const Eigen::Ref<const Eigen::VectorXd>& y,
+               const Eigen::Ref<const Eigen::VectorXd>& z,
+               const std::string& xyUnits,
+               const std::string& zUnits){
+    return this->interpolateAmplitudes(x, y, z, xyUnits, zUnits);
+  });
+}
+
+Eigen::VectorXd H5VolImpl::reduceWindows(
+    const Eigen::Ref<const Eigen::VectorXd>& x,
+    const Eigen::Ref<const Eigen::VectorXd>& y,
+    const Eigen::Ref<const Eigen::VectorXd>& z,
+    double windowAbove,
+    double windowBelow,
+    size_t padSamples,
+    const h5geo::WindowReducer& reducer,
+    const std::string& lengthUnits,
+    const std::string& zUnits)
+{
+  if (x.size() != y.size() ||
+      x.size() != z.size() ||
+      x.size() < 1)
+    return Eigen::VectorXd();
+
+  H5VolParam p = this->getParam();
+  if (p.nX < 1 || p.nY < 1 || p.nZ < 1 ||
+      p.xChunkSize < 1 || p.yChunkSize < 1 ||
+      p.dZ == 0 || std::isnan(p.dZ))
+    return Eigen::VectorXd();
+
+  double xyCoef = 1;
+  if (!lengthUnits.empty())
+    xyCoef = h5geo::getConversionFactor(lengthUnits, getLengthUnits());
+
+  double zCoef = 1;
+  if (!zUnits.empty()){
+    if (getDomain() == h5geo::Domain::OWT ||
+        getDomain() == h5geo::Domain::TWT)
+      zCoef = h5geo::getConversionFactor(zUnits, getTemporalUnits());
+    else
+      zCoef = h5geo::getConversionFactor(zUnits, getLengthUnits());
+  }
+
+  if (std::isnan(xyCoef) || std::isnan(zCoef))
+    return Eigen::VectorXd();
+
+  Eigen::VectorX<ptrdiff_t> nodeInd = h5geo::calcGridNodeIndexes(
+        x*xyCoef, y*xyCoef,
+        p.X0, p.dX, p.nX,
+        p.Y0, p.dY, p.nY,
+        this->getOrientation("radian"));
+  if (nodeInd.size() != x.size())
+    return Eigen::VectorXd();
+
+  // window of samples `[from, to]` needed for each point
+  // (`pos` is fractional sample index of `z`)
+  struct WindowRequest{
+    size_t chunk, node, from, to;
+    ptrdiff_t point;
+    double pos;
+  };
+
+  size_t nXBlocks = (p.nX + p.xChunkSize - 1) / p.xChunkSize;
+  std::vector<WindowRequest> req;
+  req.reserve(x.size());
+  for (ptrdiff_t i = 0; i < x.size(); i++){
+    if (nodeInd(i) < 0)
+      continue;
+
+    size_t iX = nodeInd(i) % p.nX;
+    size_t iY = nodeInd(i) / p.nX;
+    double pos = (z(i)*zCoef - p.Z0) / p.dZ;
+    double s0 = ((z(i) - windowAbove)*zCoef - p.Z0) / p.dZ;
+    double s1 = ((z(i) + windowBelow)*zCoef - p.Z0) / p.dZ;
+    if (std::isnan(s0) || std::isnan(s1))
+      continue;
+
+    if (s0 > s1)
+      std::swap(s0, s1);
+
+    s0 = std::max(std::ceil(s0 - 1e-6) - padSamples, double(0));
+    s1 = std::min(std::floor(s1 + 1e-6) + padSamples, double(p.nZ-1));
+    if (s0 > s1)
+      continue;
+
+    size_t chunk = (iY / p.yChunkSize) * nXBlocks + iX / p.xChunkSize;
+    req.push_back({chunk, size_t(nodeInd(i)), size_t(s0), size_t(s1), i, pos - s0});
+  }
+
+  // XY chunk is read at once (only needed Z range)
+  std::sort(req.begin(), req.end(),
+            [](const WindowRequest& a, const WindowRequest& b){
+    return a.chunk < b.chunk;
+  });
+
+  Eigen::VectorXd res = Eigen::VectorXd::Constant(x.size(), std::nan("nan"));
+  for (size_t r0 = 0; r0 < req.size();){
+    size_t chunk = req[r0].chunk;
+    size_t from = req[r0].from;
+    size_t to = req[r0].to;
+    size_t r1 = r0;
+    for (; r1 < req.size() && req[r1].chunk == chunk; r1++){
+      from = std::min(from, req[r1].from);
+      to = std::max(to, req[r1].to);
+    }
+
+    size_t iX0 = (chunk % nXBlocks) * p.xChunkSize;
+    size_t iY0 = (chunk / nXBlocks) * p.yChunkSize;
+    size_t nXChunk = std::min<size_t>(p.xChunkSize, p.nX - iX0);
+    size_t nYChunk = std::min<size_t>(p.yChunkSize, p.nY - iY0);
+    Eigen::MatrixXf BLOCK = this->getData(
+          iX0, iY0, from, nXChunk, nYChunk, to - from + 1);
+    if (BLOCK.size() < 1)
+      return Eigen::VectorXd();
+
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel for
+#endif
+    for (ptrdiff_t r = r0; r < ptrdiff_t(r1); r++){
+      const WindowRequest& w = req[r];
+      size_t row = (w.node / p.nX - iY0) * nXChunk + (w.node % p.nX - iX0);
+      res(w.point) = reducer(
+            BLOCK.row(row).segment(w.from - from, w.to - w.from + 1).transpose(),
+            w.pos);
+    }
+
+    r0 = r1;
+  }
+
+  return res;
+}
+
+bool H5VolImpl::calcHorizonWindowAttribute(
+    H5Horizon* horizon,
+    const std::string& componentName,
+    double windowAbove,
+    double windowBelow,
+    const h5geo::WindowAttribute& attribute,
+    const std::string& xComponent,
+    const std::string& yComponent,
+    const std::string& zComponent)
+{
+  return h5geo::calcHorizonWindowAttribute(
+        horizon, componentName, this->getDomain(),
+        [&](const Eigen::Ref<const Eigen::VectorXd>& x,
+            const Eigen::Ref<const Eigen::VectorXd>& y,
+            const Eigen::Ref<const Eigen::VectorXd>& z,
+            const std::string& xyUnits,
+            const std::string& zUnits){
+    return this->calcWindowAttribute(
+          x, y, z, windowAbove, windowBelow, attribute,
+          xyUnits, zUnits);
+  }, xComponent, yComponent, zComponent);
+}
+
+H5Map* H5VolImpl::calcMapWindowAttribute(
+    H5Map* map,
+    std::string& mapName,
+    double windowAbove,
+    double windowBelow,
+    const h5geo::WindowAttribute& attribute,
+    h5geo::CreationType createFlag)
+{
+  return h5geo::calcMapWindowAttribute(
+        map, mapName, this->getDomain(), this->getDataUnits(),
+        [&](const Eigen::Ref<const Eigen::VectorXd>& x,
+            const Eigen::Ref<const Eigen::VectorXd>& y,
+            const Eigen::Ref<const Eigen::VectorXd>& z,
+            const std::string& xyUnits,
+            const std::string& zUnits){
+    return this->calcWindowAttribute(
+          x, y, z, windowAbove, windowBelow, attribute,
+          xyUnits, zUnits);
+  }, createFlag);
+}
+
 bool H5VolImpl::exportToSEGY(
     const std::string& segyFile, 
     h5geo::Endian endian,
@@ -572,10 +945,13 @@ bool H5VolImpl::recreateVolD(
 
   std::vector<size_t> count = {nZ, nY, nX};
   std::vector<size_t> max_count = {h5gt::DataSpace::UNLIMITED, h5gt::DataSpace::UNLIMITED, h5gt::DataSpace::UNLIMITED};
-  std::vector<hsize_t> cdims = {xChunk, yChunk, zChunk};
+  std::vector<hsize_t> cdims = {zChunk, yChunk, xChunk};
   h5gt::DataSetCreateProps props;
   props.setChunk(cdims);
   props.setDeflate(compressionLevel);
+  // chunks that were never written are not allocated and read as `nullValue`
+  float fillValue = this->getNullValue();
+  H5Pset_fill_value(props.getId(), H5T_NATIVE_FLOAT, &fillValue);
   h5gt::DataSpace dataspace(count, max_count);
 
   try {
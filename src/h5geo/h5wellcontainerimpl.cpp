@@ -4,6 +4,7 @@
 #include "../../include/h5geo/private/h5wellimpl.h"
 #include "../../include/h5geo/private/h5enum_string.h"
 
+#include <cmath>
 #include <optional>
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -58,6 +59,21 @@ H5Well* H5WellContainerImpl::createWell(
 H5Well* H5WellContainerImpl::openWellByUWI(
     const std::string& name)
 {
+  auto catalogOpt = h5geo::readCatalog(h5File);
+  if (catalogOpt.has_value()){
+    for (const auto& entry : catalogOpt.value()){
+      if (entry.objType != h5geo::ObjectType::WELL ||
+          entry.uwi != name ||
+          !h5File.hasObject(entry.path, h5gt::ObjectType::Group))
+        continue;
+
+      h5gt::Group group = h5File.getGroup(entry.path);
+      if (h5geo::isWell(group))
+        return openWell(group);
+    }
+    return nullptr;
+  }
+
   h5gt::Group group = h5File.getGroup("/");
   std::vector<h5gt::Group> childGroupList =
       getChildGroupList(group, h5geo::ObjectType::WELL, true);
@@ -72,3 +88,108 @@ H5Well* H5WellContainerImpl::openWellByUWI(
   }
   return nullptr;
 }
+
+H5WellLogs H5WellContainerImpl::getLogCurves(
+    const std::string& logType,
+    const std::string& logName,
+    const std::vector<std::string>& wellNames,
+    const std::string& lengthUnits,
+    const std::string& dataUnits)
+{
+  H5WellLogs logs;
+  logs.offsets = Eigen::VectorX<ptrdiff_t>::Zero(1);
+
+  std::vector<std::string> wellPaths;
+  if (wellNames.empty()){
+    auto catalogOpt = h5geo::readCatalog(h5File);
+    if (catalogOpt.has_value()){
+      wellPaths = h5geo::findInCatalog(
+            catalogOpt.value(), "/", h5geo::ObjectType::WELL, true);
+    } else {
+      for (const auto& wellG : getObjGroupList(h5geo::ObjectType::WELL, true))
+        wellPaths.push_back(wellG.getPath());
+    }
+  } else {
+    wellPaths.reserve(wellNames.size());
+    for (const auto& name : wellNames)
+      wellPaths.push_back(!name.empty() && name[0] == '/' ? name : "/" + name);
+  }
+
+  std::string curvePath = std::string{h5geo::detail::LOG} + "/";
+  curvePath += logType.empty() ? logName : logType + "/" + logName;
+
+  // HDF5 reads are serialized: read each curve with a single call
+  // and gather them in parallel then
+  struct WellCurve{
+    Eigen::MatrixXd data;
+    ptrdiff_t mdInd, valInd;
+    double mdCoef, valCoef;
+  };
+  std::vector<WellCurve> curves;
+  curves.reserve(wellPaths.size());
+  logs.wellNames.reserve(wellPaths.size());
+  for (const auto& wellPath : wellPaths){
+    try {
+      std::string path = wellPath + "/" + curvePath;
+      if (!h5File.hasObject(path, h5gt::ObjectType::Group))
+        continue;
+
+      h5gt::Group curveG = h5File.getGroup(path);
+      std::string logDataName = std::string{h5geo::detail::log_data};
+      if (!curveG.hasObject(logDataName, h5gt::ObjectType::Dataset))
+        continue;
+
+      h5gt::DataSet dset = curveG.getDataSet(logDataName);
+      std::vector<size_t> dims = dset.getDimensions();
+      WellCurve curve;
+      curve.mdInd = h5geo::getIndexFromAttribute(
+            dset, std::string{magic_enum::enum_name(h5geo::LogDataType::MD)});
+      curve.valInd = h5geo::getIndexFromAttribute(
+            dset, std::string{magic_enum::enum_name(h5geo::LogDataType::VAL)});
+      if (dims.size() != 2 ||
+          curve.mdInd < 0 || curve.mdInd >= ptrdiff_t(dims[0]) ||
+          curve.valInd < 0 || curve.valInd >= ptrdiff_t(dims[0]))
+        continue;
+
+      std::string curveLengthUnits = h5geo::readStringAttribute(
+            curveG, std::string{h5geo::detail::length_units});
+      std::string curveDataUnits = h5geo::readStringAttribute(
+            curveG, std::string{h5geo::detail::data_units});
+      curve.mdCoef = lengthUnits.empty() || curveLengthUnits == lengthUnits ?
+            1 : h5geo::getConversionFactor(curveLengthUnits, lengthUnits);
+      curve.valCoef = dataUnits.empty() || curveDataUnits == dataUnits ?
+            1 : h5geo::getConversionFactor(curveDataUnits, dataUnits);
+      if (std::isnan(curve.mdCoef) || std::isnan(curve.valCoef))
+        continue;
+
+      // dataset is row-major {nCurves, nSamp}: each curve is a column here
+      curve.data.resize(dims[1], dims[0]);
+      if (curve.data.size() > 0)
+        dset.read(curve.data.data());
+
+      curves.push_back(std::move(curve));
+      logs.wellNames.push_back(wellPath);
+    } catch (h5gt::Exception& err) {
+      continue;
+    }
+  }
+
+  logs.offsets.resize(curves.size()+1);
+  logs.offsets(0) = 0;
+  for (size_t i = 0; i < curves.size(); i++)
+    logs.offsets(i+1) = logs.offsets(i) + curves[i].data.rows();
+
+  logs.md.resize(logs.offsets(curves.size()));
+  logs.val.resize(logs.offsets(curves.size()));
+#ifdef H5GEO_USE_THREADS
+#pragma omp parallel for
+#endif
+  for (ptrdiff_t i = 0; i < ptrdiff_t(curves.size()); i++){
+    const WellCurve& curve = curves[i];
+    ptrdiff_t n = curve.data.rows();
+    logs.md.segment(logs.offsets(i), n) = curve.data.col(curve.mdInd)*curve.mdCoef;
+    logs.val.segment(logs.offsets(i), n) = curve.data.col(curve.valInd)*curve.valCoef;
+  }
+
+  return logs;
+}
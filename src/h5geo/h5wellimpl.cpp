@@ -6,8 +6,6 @@
 #include "../../include/h5geo/h5core.h"
 #include "../../include/h5geo/private/h5enum_string.h"
 
-#include <units/units.hpp>
-
 #ifdef H5GEO_USE_GDAL
 #include <gdal.h>
 #include <gdal_priv.h>
@@ -238,6 +236,7 @@ bool H5WellImpl::setHeadCoord(
     const std::string& lengthUnits,
     bool doCoordTransform)
 {
+  H5DevCurveImpl::invalidateTrajectories(objG);
 #ifdef H5GEO_USE_GDAL
   if (doCoordTransform){
     OGRCT_ptr coordTrans(createCoordinateTransformationToWriteData(lengthUnits));
@@ -247,7 +246,7 @@ bool H5WellImpl::setHeadCoord(
             objG,
             std::string{h5geo::detail::head_coord},
             v);
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return false;
     }
   }
@@ -263,6 +262,7 @@ bool H5WellImpl::setKB(
     double& val,
     const std::string& lengthUnits)
 {
+  H5DevCurveImpl::invalidateTrajectories(objG);
   return h5geo::overwriteAttribute(
       objG,
       std::string{h5geo::detail::KB},
@@ -271,10 +271,14 @@ bool H5WellImpl::setKB(
 
 bool H5WellImpl::setUWI(const std::string& str)
 {
-  return h5geo::overwriteAttribute(
+  if (!h5geo::overwriteAttribute(
         objG,
         std::string{h5geo::detail::UWI},
-        str);
+        str))
+    return false;
+
+  h5geo::setCatalogUWI(objG, str);
+  return true;
 }
 
 bool H5WellImpl::setActiveDevCurve(H5DevCurve* curve)
@@ -296,13 +300,15 @@ bool H5WellImpl::setActiveDevCurve(H5DevCurve* curve)
   if (opt.has_value())
     opt->unlink(); // must be getPath (not getPath)
 
+  H5DevCurveImpl::invalidateTrajectories(objG);
+
   // create soft link with Relative path is important to keep
   // well alive while moving it within container
   objG.createLink(curve->getObjG(),
                   std::string{h5geo::detail::DEV} + "/" +
                   std::string{h5geo::detail::ACTIVE},
                   h5gt::LinkType::Soft, relativeCurveName);
-  objG.flush();
+  h5geo::flushUnlessBatch(objG.getFile());
   return true;
 }
 
@@ -323,7 +329,7 @@ Eigen::VectorXd H5WellImpl::getHeadCoord(
 
       coordTrans->Transform(1, &v(0), &v(1));
       return v;
-    } else if (!coordTrans && !h5geo::sr::getIgnoreCoordTransformOnFailure()){
+    } else if (!coordTrans && !this->getSRContext()->getIgnoreCoordTransformOnFailure()){
       return Eigen::VectorXd();
     }
   }
@@ -32,7 +32,9 @@ void HorizonParam_py(py::class_<H5HorizonParam, H5BaseObjectParam> &py_obj){
       .def_readwrite("domain", &H5HorizonParam::domain)
       .def_readwrite("nPoints", &H5HorizonParam::nPoints)
       .def_readwrite("components", &H5HorizonParam::components)
-      .def_readwrite("chunkSize", &H5HorizonParam::pointsChunkSize);
+      .def_readwrite("chunkSize", &H5HorizonParam::pointsChunkSize)
+      .def_readwrite("floatData", &H5HorizonParam::floatData)
+      .def_readwrite("compression_level", &H5HorizonParam::compression_level);
 }
 
 void MapParam_py(py::class_<H5MapParam, H5BaseObjectParam> &py_obj){
@@ -48,7 +50,9 @@ void MapParam_py(py::class_<H5MapParam, H5BaseObjectParam> &py_obj){
       .def_readwrite("nY", &H5MapParam::nY)
       .def_readwrite("domain", &H5MapParam::domain)
       .def_readwrite("xChunkSize", &H5MapParam::xChunkSize)
-      .def_readwrite("yChunkSize", &H5MapParam::yChunkSize);
+      .def_readwrite("yChunkSize", &H5MapParam::yChunkSize)
+      .def_readwrite("floatData", &H5MapParam::floatData)
+      .def_readwrite("compression_level", &H5MapParam::compression_level);
 }
 
 void WellParam_py(py::class_<H5WellParam, H5BaseObjectParam> &py_obj){
@@ -63,13 +67,15 @@ void WellParam_py(py::class_<H5WellParam, H5BaseObjectParam> &py_obj){
 void DevCurveParam_py(py::class_<H5DevCurveParam, H5BaseObjectParam> &py_obj){
   py_obj
       .def(py::init<>())
-      .def_readwrite("chunkSize", &H5DevCurveParam::chunkSize);
+      .def_readwrite("chunkSize", &H5DevCurveParam::chunkSize)
+      .def_readwrite("nSamp", &H5DevCurveParam::nSamp);
 }
 
 void LogCurveParam_py(py::class_<H5LogCurveParam, H5BaseObjectParam> &py_obj){
   py_obj
       .def(py::init<>())
-      .def_readwrite("chunkSize", &H5LogCurveParam::chunkSize);
+      .def_readwrite("chunkSize", &H5LogCurveParam::chunkSize)
+      .def_readwrite("nSamp", &H5LogCurveParam::nSamp);
 }
 
 void SeisParam_py(py::class_<H5SeisParam, H5BaseObjectParam> &py_obj){
@@ -107,6 +113,44 @@ void VolParam_py(py::class_<H5VolParam, H5BaseObjectParam> &py_obj){
       .def_readwrite("compression_level", &H5VolParam::compression_level);
 }
 
+void ChunkCacheParam_py(py::class_<H5ChunkCacheParam> &py_obj){
+  py_obj
+      .def(py::init<>())
+      .def_readwrite("nBytes", &H5ChunkCacheParam::nBytes)
+      .def_readwrite("nSlots", &H5ChunkCacheParam::nSlots)
+      .def_readwrite("w0", &H5ChunkCacheParam::w0);
+}
+
+void FileAccessParam_py(py::class_<H5FileAccessParam> &py_obj){
+  py_obj
+      .def(py::init<>())
+      .def_readwrite("chunkCache", &H5FileAccessParam::chunkCache)
+      .def_readwrite("mdcInitSize", &H5FileAccessParam::mdcInitSize)
+      .def_readwrite("mdcMaxSize", &H5FileAccessParam::mdcMaxSize)
+      .def_readwrite("pageBufferSize", &H5FileAccessParam::pageBufferSize)
+      .def_readwrite("alignThreshold", &H5FileAccessParam::alignThreshold)
+      .def_readwrite("alignment", &H5FileAccessParam::alignment)
+      .def_readwrite("libverLow", &H5FileAccessParam::libverLow)
+      .def_readwrite("libverHigh", &H5FileAccessParam::libverHigh);
+}
+
+void FileCreateParam_py(py::class_<H5FileCreateParam> &py_obj){
+  py_obj
+      .def(py::init<>())
+      .def_readwrite("pagedAggregation", &H5FileCreateParam::pagedAggregation)
+      .def_readwrite("pageSize", &H5FileCreateParam::pageSize)
+      .def_readwrite("persistFreeSpace", &H5FileCreateParam::persistFreeSpace)
+      .def_readwrite("freeSpaceThreshold", &H5FileCreateParam::freeSpaceThreshold);
+}
+
+void CatalogEntry_py(py::class_<H5CatalogEntry> &py_obj){
+  py_obj
+      .def(py::init<>())
+      .def_readwrite("path", &H5CatalogEntry::path)
+      .def_readwrite("objType", &H5CatalogEntry::objType)
+      .def_readwrite("uwi", &H5CatalogEntry::uwi);
+}
+
 void ObjectDeleter_py(py::class_<ObjectDeleter> &py_obj){
   py_obj
       .def("__call__", [](const ObjectDeleter& obj, H5Base * base) { obj(base); });
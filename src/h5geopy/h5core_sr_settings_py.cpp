@@ -165,6 +165,8 @@ void defineSRSettingsFunctions(py::module_& m_sr){
   m_sr.def("setDomain", py::overload_cast<const h5geo::Domain&>(&sr::setDomain));
   m_sr.def("getDomain", &sr::getDomain);
   m_sr.def("getDomainEnum", &sr::getDomainEnum);
+  m_sr.def("clearCoordinateTransformations", &clearCoordinateTransformations,
+           "Remove cached coordinate transformations in all threads");
   m_sr.def("convertUnits", &ext::convertUnitsD,
            py::arg("m"), py::arg("unitsFrom"), py::arg("unitsTo"));
   m_sr.def("convertUnits", &ext::convertUnitsF,
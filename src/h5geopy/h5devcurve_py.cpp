@@ -5,6 +5,62 @@
 
 namespace h5geopy {
 
+namespace ext {
+
+// python holder can't be `shared_ptr<const T>` (no mutating methods are exposed anyway)
+std::shared_ptr<Trajectory> getTrajectory(
+    H5DevCurve& self,
+    const std::string& lengthUnits,
+    double resampleStep,
+    bool doCoordTransform)
+{
+  return std::const_pointer_cast<Trajectory>(
+        self.getTrajectory(lengthUnits, resampleStep, doCoordTransform));
+}
+
+} // ext
+
+void Trajectory_py(
+    py::class_<Trajectory, std::shared_ptr<Trajectory>>
+    &py_obj){
+  py_obj
+      .def(py::init<const Eigen::Ref<const Eigen::MatrixXd>&, double>(),
+           py::arg("M"),
+           py::arg_v("kb", 0, "0"),
+           "M: columns `MD`, `X`, `Y`, `TVD`, `AZIM`, `INCL` (radian)")
+      .def("isValid", &Trajectory::isValid)
+      .def("getNSamp", &Trajectory::getNSamp)
+      .def("getKB", &Trajectory::getKB)
+      .def("getStations", &Trajectory::getStations)
+      .def("resample", &Trajectory::resample,
+           py::arg("step"))
+      .def("mdToXYTvd", &Trajectory::mdToXYTvd,
+           py::arg("md"),
+           py::arg_v("minCurvature", true, "True"),
+           "Return: matrix with columns `X`, `Y`, `TVD`, `TVDSS`")
+      .def("tvdToMd", &Trajectory::tvdToMd,
+           py::arg("tvd"),
+           py::arg_v("minCurvature", true, "True"))
+      .def("mdToXYZ", &Trajectory::mdToXYZ,
+           py::arg("md"),
+           py::arg("domain"),
+           py::arg_v("tdCurve", TimeDepthCurve(), "TimeDepthCurve()"),
+           py::arg_v("minCurvature", true, "True"),
+           "Return: matrix with columns `X`, `Y`, `Z` where `Z` is in `domain`");
+}
+
+void TimeDepthCurve_py(
+    py::class_<TimeDepthCurve> &py_obj){
+  py_obj
+      .def(py::init<>())
+      .def_readwrite("tvdss", &TimeDepthCurve::tvdss)
+      .def_readwrite("twt", &TimeDepthCurve::twt)
+      .def_readwrite("velocity", &TimeDepthCurve::velocity)
+      .def("isValid", &TimeDepthCurve::isValid)
+      .def("tvdssToTwt", &TimeDepthCurve::tvdssToTwt,
+           py::arg("depth"));
+}
+
 void H5DevCurve_py(
     py::class_<
     H5DevCurve,
@@ -61,6 +117,21 @@ void H5DevCurve_py(
            py::arg_v("units", "", "str()"),
            py::arg_v("doCoordTransform", false, "False"))
 
+      .def("getTrajectory", &ext::getTrajectory,
+           py::arg_v("lengthUnits", "", "str()"),
+           py::arg_v("resampleStep", 0, "0"),
+           py::arg_v("doCoordTransform", false, "False"))
+      .def("mdToXYTvd", &H5DevCurve::mdToXYTvd,
+           py::arg("md"),
+           py::arg_v("lengthUnits", "", "str()"),
+           py::arg_v("minCurvature", true, "True"),
+           py::arg_v("doCoordTransform", false, "False"),
+           "Return: matrix with columns `X`, `Y`, `TVD`, `TVDSS`")
+      .def("tvdToMd", &H5DevCurve::tvdToMd,
+           py::arg("tvd"),
+           py::arg_v("lengthUnits", "", "str()"),
+           py::arg_v("minCurvature", true, "True"))
+
       .def("getRelativeName", &H5DevCurve::getRelativeName)
       .def("getParam", &H5DevCurve::getParam)
 
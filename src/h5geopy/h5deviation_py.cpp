@@ -279,6 +279,26 @@ void defineDeviationFunctions(py::module_& m){
         py::arg("angularUnitsTo"),
         py::arg("trajFormat"),
         py::arg("XNorth"));
+  m.def("traj2ALL", py::overload_cast<
+        const std::vector<Eigen::MatrixXd>&,
+        const Eigen::Ref<const Eigen::VectorXd>&,
+        const Eigen::Ref<const Eigen::VectorXd>&,
+        const Eigen::Ref<const Eigen::VectorXd>&,
+        const std::string&,
+        const std::string&,
+        const h5geo::TrajectoryFormat&,
+        const bool&>(&h5geo::traj2ALL),
+        py::arg("M"),
+        py::arg("x0"),
+        py::arg("y0"),
+        py::arg("kb"),
+        py::arg("angularUnitsFrom"),
+        py::arg("angularUnitsTo"),
+        py::arg("trajFormat"),
+        py::arg("XNorth"),
+        py::call_guard<py::gil_scoped_release>(),
+        "Convert list of trajectories (one per well) in parallel. "
+"`x0`, `y0`, `kb` are arrays with a value per well");
 
   m.def("TvdssDxDy2ALL", &ext::TvdssDxDy2ALL<Eigen::MatrixXf>,
         py::arg("M"),
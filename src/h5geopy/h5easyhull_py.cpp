@@ -14,6 +14,30 @@ Eigen::MatrixX2<T> quickHull2D(
   return h5geo::quickHull2D(v);
 }
 
+template<typename T>
+Eigen::MatrixX2<T> convexHull2D(
+    const Eigen::MatrixX2<T>& v,
+    ptrdiff_t chunkSize)
+{
+  return h5geo::convexHull2D(v, chunkSize);
+}
+
+template<typename T>
+Eigen::MatrixX2<T> concaveBoundary2D(
+    const Eigen::MatrixX2<T>& v,
+    T cellSize)
+{
+  if (v.rows() < 1)
+    return Eigen::MatrixX2<T>();
+
+  h5geo::ConcaveBoundaryEstimator<T> estimator(
+        v.col(0).minCoeff(), v.col(1).minCoeff(),
+        v.col(0).maxCoeff(), v.col(1).maxCoeff(),
+        cellSize);
+  estimator.add(v);
+  return estimator.getBoundary();
+}
+
 
 } // ext
 
@@ -27,6 +51,24 @@ void defineEasyHullFunctions(py::module_& m){
 "Return two column matrix (XY)");
   m.def("quickHull2D", &ext::quickHull2D<double>,
         py::arg("M"));
+  m.def("convexHull2D", &ext::convexHull2D<float>,
+        py::arg("M"),
+        py::arg_v("chunkSize", 1 << 16, "65536"),
+        py::call_guard<py::gil_scoped_release>(),
+        "Chunked parallel convex hull with Akl-Toussaint filtering. "
+"Return closed two column matrix (XY)");
+  m.def("convexHull2D", &ext::convexHull2D<double>,
+        py::arg("M"),
+        py::arg_v("chunkSize", 1 << 16, "65536"),
+        py::call_guard<py::gil_scoped_release>());
+  m.def("concaveBoundary2D", &ext::concaveBoundary2D<float>,
+        py::arg("M"),
+        py::arg_v("cellSize", 0, "0"),
+        "Concave boundary of points at resolution `cellSize` "
+"(`0` means 1/64 of the extent). Return closed two column matrix (XY)");
+  m.def("concaveBoundary2D", &ext::concaveBoundary2D<double>,
+        py::arg("M"),
+        py::arg_v("cellSize", 0, "0"));
 }
 
 
@@ -146,5 +146,21 @@ void Delimiter_py(py::enum_<Delimiter> &py_obj){
       .value("COMMA", Delimiter::COMMA);
 }
 
+void WindowAttribute_py(py::enum_<WindowAttribute> &py_obj){
+  py_obj
+      .value("RMS", WindowAttribute::RMS)
+      .value("MEAN", WindowAttribute::MEAN)
+      .value("MAX", WindowAttribute::MAX)
+      .value("MIN", WindowAttribute::MIN)
+      .value("MAX_ABS", WindowAttribute::MAX_ABS);
+}
+
+void BoundaryType_py(py::enum_<BoundaryType> &py_obj){
+  py_obj
+      .value("CONVEX", BoundaryType::CONVEX)
+      .value("CONCAVE", BoundaryType::CONCAVE)
+      .value("LINE", BoundaryType::LINE);
+}
+
 
 } // h5geopy
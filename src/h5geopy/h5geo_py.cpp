@@ -9,8 +9,11 @@
 #include "../../include/h5geopy/h5easyhull_py.h"
 #include "../../include/h5geopy/h5geofunctions_py.h"
 #include "../../include/h5geopy/h5interpolation_py.h"
+#include "../../include/h5geopy/h5ioqueue_py.h"
+#include "../../include/h5geopy/h5profiler_py.h"
 #include "../../include/h5geopy/h5core_segy_py.h"
 #include "../../include/h5geopy/h5sort_py.h"
+#include "../../include/h5geopy/h5surveyinfo_py.h"
 #include "../../include/h5geopy/h5logcurve_py.h"
 #include "../../include/h5geopy/h5basepoints_py.h"
 #include "../../include/h5geopy/h5points_py.h"
@@ -66,6 +69,8 @@ PYBIND11_MODULE(_h5geo, m) {
   auto pyCreationType = py::enum_<CreationType>(m, "CreationType", py::arithmetic());
   auto pyCaseSensitivity = py::enum_<CaseSensitivity>(m, "CaseSensitivity", py::arithmetic());
   auto pyDelimiter = py::enum_<Delimiter>(m, "Delimiter", py::arithmetic());
+  auto pyWindowAttribute = py::enum_<WindowAttribute>(m, "WindowAttribute", py::arithmetic());
+  auto pyBoundaryType = py::enum_<BoundaryType>(m, "BoundaryType", py::arithmetic());
 
   // _DELETER
   auto pyObjectDeleter = py::class_<ObjectDeleter>(m, "ObjectDeleter");
@@ -81,6 +86,11 @@ PYBIND11_MODULE(_h5geo, m) {
   auto pyLogCurveParam = py::class_<H5LogCurveParam, H5BaseObjectParam>(m, "H5LogCurveParam");
   auto pySeisParam = py::class_<H5SeisParam, H5BaseObjectParam>(m, "H5SeisParam");
   auto pyVolParam = py::class_<H5VolParam, H5BaseObjectParam>(m, "H5VolParam");
+  auto pyChunkCacheParam = py::class_<H5ChunkCacheParam>(m, "H5ChunkCacheParam");
+  auto pyFileAccessParam = py::class_<H5FileAccessParam>(m, "H5FileAccessParam");
+  auto pyFileCreateParam = py::class_<H5FileCreateParam>(m, "H5FileCreateParam");
+  auto pyCatalogEntry = py::class_<H5CatalogEntry>(m, "H5CatalogEntry");
+  auto pyWellLogs = py::class_<H5WellLogs>(m, "H5WellLogs");
   auto pyBase = py::class_<
       H5Base,
       H5BaseImpl<H5Base>,
@@ -120,6 +130,36 @@ PYBIND11_MODULE(_h5geo, m) {
       py::class_<Point4>
       (m, "Point4");
 
+  // H5GEO::SURVEYINFO
+  auto pySurveyInfo =
+      py::class_<SurveyInfo>
+      (m, "SurveyInfo");
+
+  auto pySurveyInfoEstimator =
+      py::class_<SurveyInfoEstimator>
+      (m, "SurveyInfoEstimator");
+
+  // H5GEO::TRAJECTORY
+  auto pyTrajectory =
+      py::class_<Trajectory, std::shared_ptr<Trajectory>>
+      (m, "Trajectory");
+  auto pyTimeDepthCurve =
+      py::class_<TimeDepthCurve>
+      (m, "TimeDepthCurve");
+
+  // ASYNC I/O
+  auto pyIOFutureMatrixXf =
+      py::class_<ext::IOFuture<Eigen::MatrixXf>>
+      (m, "IOFutureMatrixXf");
+  auto pyIOFutureMatrixXd =
+      py::class_<ext::IOFuture<Eigen::MatrixXd>>
+      (m, "IOFutureMatrixXd");
+
+  // PROFILING
+  auto pyProfileCounter =
+      py::class_<ProfileCounter>
+      (m, "ProfileCounter");
+
   // POINTS
   auto pyBasePoints =
       py::class_<
@@ -315,6 +355,8 @@ PYBIND11_MODULE(_h5geo, m) {
   CreationType_py(pyCreationType);
   CaseSensitivity_py(pyCaseSensitivity);
   Delimiter_py(pyDelimiter);
+  WindowAttribute_py(pyWindowAttribute);
+  BoundaryType_py(pyBoundaryType);
 
   // DELETER
   ObjectDeleter_py(pyObjectDeleter);
@@ -330,6 +372,10 @@ PYBIND11_MODULE(_h5geo, m) {
   LogCurveParam_py(pyLogCurveParam);
   SeisParam_py(pySeisParam);
   VolParam_py(pyVolParam);
+  ChunkCacheParam_py(pyChunkCacheParam);
+  FileAccessParam_py(pyFileAccessParam);
+  FileCreateParam_py(pyFileCreateParam);
+  CatalogEntry_py(pyCatalogEntry);
   H5Base_py pyBase_inst(pyBase);
 
   // BASECONTAINER
@@ -348,6 +394,21 @@ PYBIND11_MODULE(_h5geo, m) {
   Point4_py(pyPoint4);
   py::bind_vector<Point4Array>(m, "Point4Array");
 
+  // H5GEO::SURVEYINFO
+  SurveyInfo_py(pySurveyInfo);
+  SurveyInfoEstimator_py(pySurveyInfoEstimator);
+
+  // H5GEO::TRAJECTORY
+  Trajectory_py(pyTrajectory);
+  TimeDepthCurve_py(pyTimeDepthCurve);
+
+  // ASYNC I/O
+  IOFutureMatrixXf_py(pyIOFutureMatrixXf);
+  IOFutureMatrixXd_py(pyIOFutureMatrixXd);
+
+  // PROFILING
+  ProfileCounter_py(pyProfileCounter);
+
   // POINTS
   H5BasePoints_py pyBasePoints_inst(pyBasePoints);
   H5Points1_py(pyPoints1);
@@ -380,6 +441,7 @@ PYBIND11_MODULE(_h5geo, m) {
   H5Vol_py(pyVol);
 
   // WELLCONTAINER
+  WellLogs_py(pyWellLogs);
   H5WellContainer_py(pyWellContainer);
 
   // WELL
@@ -398,6 +460,8 @@ PYBIND11_MODULE(_h5geo, m) {
   defineSortFunctions(m);
   defineSEGYFunctions(m);
   defineInterpolationFunctions(m);
+  defineIOQueueFunctions(m);
+  defineProfilerFunctions(m);
 
 #ifdef H5GEO_USE_GDAL
   defineSRSettingsFunctions(m_sr);
@@ -200,9 +200,26 @@ void defineGeoFunctions(py::module_& m){
   m.def("isWellTops", &isWellTops);
 
   // from UTIL
-  m.def("openFile", &openFile);
+  m.def("openFile", py::overload_cast<
+        const std::string&>(&openFile));
+  m.def("openFile", py::overload_cast<
+        const std::string&,
+        const H5FileAccessParam&>(&openFile),
+        py::arg("fileName"), py::arg("p"));
+  m.def("getDefaultFileAccessParam", &getDefaultFileAccessParam,
+        py::arg("cntType"));
+  m.def("createFile", &createFile,
+        py::arg("fileName"), py::arg("cp"), py::arg("ap"));
+  m.def("getDefaultFileCreateParam", &getDefaultFileCreateParam,
+        py::arg("cntType"));
   m.def("openGroup", &openGroup);
   m.def("openDataSet", &openDataSet);
+  m.def("beginBatch", &beginBatch, py::arg("file"));
+  m.def("endBatch", &endBatch, py::arg("file"));
+  m.def("isBatchActive", &isBatchActive, py::arg("file"));
+  m.def("hasCatalog", &hasCatalog, py::arg("file"));
+  m.def("rebuildCatalog", &rebuildCatalog, py::arg("file"));
+  m.def("readCatalog", &readCatalog, py::arg("file"));
 
   m.def("getTraceHeaderNames", &ext::getTraceHeaderNames);
   m.def("getBinHeaderNames", &ext::getTraceHeaderNames);
@@ -243,6 +260,41 @@ void defineGeoFunctions(py::module_& m){
         "Return: status, origin_x, origin_y, orientation, ilSpacing, xlSpacing, "
         "isILReversed, isXLReversed, isPlanReversed");
 
+  m.def("getSurveyCellIndexes", &getSurveyCellIndexes,
+        py::arg("info"),
+        py::arg("il"),
+        py::arg("xl"),
+        "Map traces to survey grid cells: `cell = iIL*nXL + iXL`. "
+        "Traces that don't belong to the grid get `-1`");
+
+  m.def("calcGridNodeIndexes", &calcGridNodeIndexes,
+        py::arg("x"),
+        py::arg("y"),
+        py::arg("x0"), py::arg("dx"), py::arg("nx"),
+        py::arg("y0"), py::arg("dy"), py::arg("ny"),
+        py::arg("orientation"),
+        "Find the nearest nodes of rotated regular XY grid. "
+        "`orientation` is counter clock angle in radians. "
+        "Return node indexes `iY*nx + iX` (`-1` for points outside the grid)");
+  m.def("calcWindowAttribute", &calcWindowAttribute,
+        py::arg("v"),
+        py::arg("attribute"),
+        py::arg_v("nullValue", std::nan("nan"), "nan"),
+        "Calculate amplitude attribute of the samples window. "
+        "`NaN` samples and samples equal to `nullValue` are skipped");
+  m.def("interpolateSample", &interpolateSample,
+        py::arg("v"),
+        py::arg("pos"),
+        py::arg_v("nullValue", std::nan("nan"), "nan"),
+        "Linearly interpolate samples at fractional index `pos`");
+  m.def("getConversionFactor", &getConversionFactor,
+        py::arg("unitsFrom"),
+        py::arg("unitsTo"),
+        "Get factor to convert values from `unitsFrom` to `unitsTo`. "
+        "Factors are cached by units pair. Return `NaN` if units are incompatible");
+  m.def("clearConversionFactors", &clearConversionFactors,
+        "Remove all cached conversion factors");
+
   m.def("isStraightLine", py::overload_cast<const Eigen::Ref<const Eigen::VectorXf>&,const Eigen::Ref<const Eigen::VectorXf>&,float>(&isStraightLine));
   m.def("isStraightLine", py::overload_cast<const Eigen::Ref<const Eigen::VectorXd>&,const Eigen::Ref<const Eigen::VectorXd>&,double>(&isStraightLine));
 
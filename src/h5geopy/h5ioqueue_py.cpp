@@ -0,0 +1,48 @@
+#include "../../include/h5geopy/h5ioqueue_py.h"
+
+namespace h5geopy {
+
+namespace {
+
+template<typename T>
+void IOFuture_py(py::class_<ext::IOFuture<T>>& py_obj){
+  py_obj
+      .def("result", &ext::IOFuture<T>::result,
+           py::call_guard<py::gil_scoped_release>(),
+           "Block until the data is read and return it")
+      .def("done", &ext::IOFuture<T>::done,
+           "Return `True` if the data is already read")
+      // `await` waits for the result in the loop's default executor
+      // so that the event loop is not blocked
+      .def("__await__", [](py::object self){
+    py::object loop = py::module_::import("asyncio").attr("get_running_loop")();
+    return loop.attr("run_in_executor")(
+          py::none(), self.attr("result")).attr("__await__")();
+  });
+}
+
+} // namespace
+
+
+void IOFutureMatrixXf_py(
+    py::class_<ext::IOFuture<Eigen::MatrixXf>>
+    &py_obj)
+{
+  IOFuture_py(py_obj);
+}
+
+void IOFutureMatrixXd_py(
+    py::class_<ext::IOFuture<Eigen::MatrixXd>>
+    &py_obj)
+{
+  IOFuture_py(py_obj);
+}
+
+void defineIOQueueFunctions(py::module_& m){
+  m.def("waitIO", [](){ IOQueue::instance().wait(); },
+        py::call_guard<py::gil_scoped_release>(),
+        "Block until all the asynchronous reads queued before the call are done");
+}
+
+
+} // h5geopy
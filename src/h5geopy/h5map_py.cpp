@@ -1,7 +1,26 @@
 #include "../../include/h5geopy/h5map_py.h"
+#include "../../include/h5geopy/h5ioqueue_py.h"
 
 namespace h5geopy {
 
+namespace ext {
+
+ext::IOFuture<Eigen::MatrixXd>
+getDataAsync(
+    H5Map* self,
+    const size_t& iX0,
+    const size_t& iY0,
+    const size_t& nX,
+    const size_t& nY,
+    const size_t& stride = 1,
+    const std::string& dataUnits = "")
+{
+  return ext::IOFuture<Eigen::MatrixXd>(self->getDataAsync(
+        iX0, iY0, nX, nY, stride, dataUnits));
+}
+
+} // ext
+
 void H5Map_py(
     py::class_<
     H5Map,
@@ -28,11 +47,51 @@ void H5Map_py(
            "`h5geopy.GDALAllRegister()` must be called before using GDAL readers")
       #endif  // H5GEO_USE_GDAL
 
-      .def("writeData", &H5Map::writeData,
+      .def("writeData", py::overload_cast<
+           Eigen::Ref<Eigen::MatrixXd>,
+           const std::string&>(
+             &H5Map::writeData),
            py::arg("data"),
            py::arg_v("dataUnits", "", "str()"))
-      .def("getData", &H5Map::getData,
+      .def("writeData", py::overload_cast<
+           Eigen::Ref<Eigen::MatrixXd>,
+           const size_t&,
+           const size_t&,
+           const std::string&>(
+             &H5Map::writeData),
+           py::arg("data"),
+           py::arg("iX0"),
+           py::arg("iY0"),
+           py::arg_v("dataUnits", "", "str()"),
+           "write block of data starting from `iX0, iY0` (the block must fit the map)")
+      .def("getData", py::overload_cast<
+           const std::string&>(
+             &H5Map::getData),
            py::arg_v("dataUnits", "", "str()"))
+      .def("getData", py::overload_cast<
+           const size_t&,
+           const size_t&,
+           const size_t&,
+           const size_t&,
+           const size_t&,
+           const std::string&>(
+             &H5Map::getData),
+           py::arg("iX0"),
+           py::arg("iY0"),
+           py::arg("nX"),
+           py::arg("nY"),
+           py::arg_v("stride", 1, "1"),
+           py::arg_v("dataUnits", "", "str()"),
+           "read window of data taking every `stride` node")
+      .def("getDataAsync", &ext::getDataAsync,
+           py::arg("iX0"),
+           py::arg("iY0"),
+           py::arg("nX"),
+           py::arg("nY"),
+           py::arg_v("stride", 1, "1"),
+           py::arg_v("dataUnits", "", "str()"),
+           "Queue reading window of data to the I/O thread. "
+           "Return awaitable `IOFutureMatrixXd` (use `result()` to block)")
 
       .def("setDomain", &H5Map::setDomain)
       .def("setOrigin", &H5Map::setOrigin,
@@ -0,0 +1,55 @@
+#include "../../include/h5geopy/h5profiler_py.h"
+
+namespace h5geopy {
+
+void ProfileCounter_py(
+    py::class_<ProfileCounter>
+    &py_obj)
+{
+  py_obj
+      .def(py::init<>())
+      .def_readonly("calls", &ProfileCounter::calls)
+      .def_readonly("seconds", &ProfileCounter::seconds)
+      .def_readonly("maxSeconds", &ProfileCounter::maxSeconds)
+      .def_readonly("bytesRead", &ProfileCounter::bytesRead)
+      .def_readonly("bytesWritten", &ProfileCounter::bytesWritten)
+      .def_readonly("selections", &ProfileCounter::selections)
+      .def_readonly("items", &ProfileCounter::items)
+      .def("__repr__", [](const ProfileCounter& c){
+    return "ProfileCounter(calls=" + std::to_string(c.calls) +
+        ", seconds=" + std::to_string(c.seconds) +
+        ", bytesRead=" + std::to_string(c.bytesRead) +
+        ", bytesWritten=" + std::to_string(c.bytesWritten) +
+        ", selections=" + std::to_string(c.selections) +
+        ", items=" + std::to_string(c.items) + ")";
+  });
+}
+
+void defineProfilerFunctions(py::module_& m){
+  m.def("isProfilingCompiled", &Profiler::isCompiled,
+        "Return `True` if h5geo is built with `H5GEO_USE_PROFILING`");
+  m.def("setProfilingEnabled", [](bool val){
+    Profiler::instance().setEnabled(val);
+  }, py::arg("val"),
+  "Start/stop collecting I/O statistics");
+  m.def("isProfilingEnabled", [](){
+    return Profiler::instance().isEnabled();
+  });
+  m.def("setProfileTraceEnabled", [](bool val, size_t maxEvents){
+    Profiler::instance().setTraceEnabled(val, maxEvents);
+  }, py::arg("val"), py::arg_v("maxEvents", 1000000, "1000000"),
+  "Also keep every call as event to be saved by `writeProfileChromeTrace`");
+  m.def("getProfileStats", [](){
+    return Profiler::instance().snapshot();
+  }, "Return dict {operation name: ProfileCounter}");
+  m.def("resetProfileStats", [](){
+    Profiler::instance().reset();
+  });
+  m.def("writeProfileChromeTrace", [](const std::string& fileName){
+    return Profiler::instance().writeChromeTrace(fileName);
+  }, py::arg("fileName"),
+  "Write events in Chrome trace format (open with `chrome://tracing` or Perfetto)");
+}
+
+
+} // h5geopy
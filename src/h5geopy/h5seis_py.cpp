@@ -1,5 +1,8 @@
 #include "../../include/h5geopy/h5seis_py.h"
+#include "../../include/h5geopy/h5ioqueue_py.h"
 #include <h5geo/private/h5volimpl.h>
+#include <h5geo/private/h5horizonimpl.h>
+#include <h5geo/private/h5mapimpl.h>
 
 namespace h5geopy {
 
@@ -29,6 +32,28 @@ getSortedData(
   return std::make_tuple(std::move(TRACE), std::move(HDR), std::move(idx));
 }
 
+std::tuple<bool, SurveyInfo>
+calcSurveyInfo(
+    H5Seis* self,
+    const std::string& xHeader = "CDP_X",
+    const std::string& yHeader = "CDP_Y",
+    const std::string& ilHeader = "INLINE",
+    const std::string& xlHeader = "XLINE",
+    double ilMin = std::numeric_limits<double>::lowest(),
+    double ilMax = std::numeric_limits<double>::max(),
+    double xlMin = std::numeric_limits<double>::lowest(),
+    double xlMax = std::numeric_limits<double>::max(),
+    size_t nTrcBuffer = 1e6)
+{
+  SurveyInfo info;
+  bool status = self->calcSurveyInfo(
+        info,
+        xHeader, yHeader, ilHeader, xlHeader,
+        ilMin, ilMax, xlMin, xlMax,
+        nTrcBuffer);
+  return std::make_tuple(std::move(status), std::move(info));
+}
+
 std::tuple<size_t, bool>
 checkTraceLimits(H5Seis* self, const size_t& fromTrc, size_t& nTrc)
 {
@@ -53,6 +78,19 @@ checkSampleLimits(H5Seis* self, const size_t& fromSampInd, size_t& nSamp)
   return std::make_tuple(nSamp, val);
 }
 
+ext::IOFuture<Eigen::MatrixXf>
+getTraceAsync(
+    H5Seis* self,
+    const size_t& fromTrc,
+    size_t nTrc = 1,
+    const size_t& fromSampInd = 0,
+    size_t nSamp = std::numeric_limits<size_t>::max(),
+    const std::string& dataUnits = "")
+{
+  return ext::IOFuture<Eigen::MatrixXf>(self->getTraceAsync(
+        fromTrc, nTrc, fromSampInd, nSamp, dataUnits));
+}
+
 
 }
 
@@ -187,6 +225,14 @@ void H5Seis_py(
            py::arg("trcInd"),
            py::arg_v("lengthUnits", "", "str()"),
            py::arg_v("doCoordTransform", false, "False"))
+      .def("reprojectXYTraceHeaders", &H5Seis::reprojectXYTraceHeaders,
+           py::arg("srTo"),
+           py::arg_v("xyHdrNames",
+                     std::vector<std::pair<std::string, std::string>>{
+                       {"SRCX", "SRCY"}, {"GRPX", "GRPY"}, {"CDP_X", "CDP_Y"}},
+                     "[('SRCX', 'SRCY'), ('GRPX', 'GRPY'), ('CDP_X', 'CDP_Y')]"),
+           py::arg_v("nTrcBuffer", size_t(1e6), "int(1e6)"),
+           py::call_guard<gil_scoped_release_h5io>())
 
       .def("setNTrc", &H5Seis::setNTrc)
       .def("setNSamp", &H5Seis::setNSamp)
@@ -215,7 +261,8 @@ void H5Seis_py(
            py::arg_v("fromSampInd", 0, "0"),
            py::arg_v("nSamp", std::numeric_limits<size_t>::max(), "sys.maxint"),
            py::arg_v("dataUnits", "", "str()"),
-           "Get block of traces. If `nTrc` or `nSamp` exceed max values then these values are changed to max allowed (that is why they are not `const`)")
+           "Get block of traces. If `nTrc` or `nSamp` exceed max values then these values are changed to max allowed (that is why they are not `const`)",
+           py::call_guard<gil_scoped_release_h5io>())
       .def("getTrace", py::overload_cast<
            const Eigen::Ref<const Eigen::VectorX<size_t>>&,
            const size_t&,
@@ -225,7 +272,54 @@ void H5Seis_py(
            py::arg("trcInd"),
            py::arg_v("fromSampInd", 0, "0"),
            py::arg_v("nSamp", std::numeric_limits<size_t>::max(), "sys.maxint"),
-           py::arg_v("dataUnits", "", "str()"))
+           py::arg_v("dataUnits", "", "str()"),
+           py::call_guard<gil_scoped_release_h5io>())
+      .def("readTrace", &H5Seis::readTrace,
+           py::arg("TRACE").noconvert(),
+           py::arg("fromTrc"),
+           py::arg_v("fromSampInd", 0, "0"),
+           py::arg_v("dataUnits", "", "str()"),
+           py::call_guard<gil_scoped_release_h5io>(),
+           "Read block of traces directly to `TRACE` array (`nSamp x nTrc`) without copying. "
+           "`TRACE` must be writeable Fortran ordered `float32` array")
+      .def("getTraceAsync", &ext::getTraceAsync,
+           py::arg("fromTrc"),
+           py::arg_v("nTrc", 1, "1"),
+           py::arg_v("fromSampInd", 0, "0"),
+           py::arg_v("nSamp", std::numeric_limits<size_t>::max(), "sys.maxint"),
+           py::arg_v("dataUnits", "", "str()"),
+           "Queue reading block of traces to the I/O thread. "
+           "Return awaitable `IOFutureMatrixXf` (use `result()` to block). "
+           "Adjacent requests queued together are read by one hyperslab")
+      .def("readTraceHeader", py::overload_cast<
+           Eigen::Ref<Eigen::MatrixXd>,
+           const size_t&,
+           const size_t&,
+           const std::vector<std::string>&,
+           const std::vector<std::string>&>(
+             &H5Seis::readTraceHeader),
+           py::arg("HDR").noconvert(),
+           py::arg("fromTrc"),
+           py::arg_v("fromHdr", 0, "0"),
+           py::arg_v("unitsFrom", std::vector<std::string>(), "list()"),
+           py::arg_v("unitsTo", std::vector<std::string>(), "list()"),
+           py::call_guard<gil_scoped_release_h5io>(),
+           "Read block of trace headers directly to `HDR` array (`nTrc x nHdr`) without copying. "
+           "`HDR` must be writeable Fortran ordered `float64` array")
+      .def("readTraceHeader", py::overload_cast<
+           const std::string&,
+           Eigen::Ref<Eigen::VectorXd>,
+           const size_t&,
+           const std::string&,
+           const std::string&>(
+             &H5Seis::readTraceHeader),
+           py::arg("hdrName"),
+           py::arg("hdr").noconvert(),
+           py::arg("fromTrc"),
+           py::arg_v("unitsFrom", "", "str()"),
+           py::arg_v("unitsTo", "", "str()"),
+           py::call_guard<gil_scoped_release_h5io>(),
+           "Read block of trace header directly to `hdr` (`float64` array) without copying")
       .def("getTraceHeader", py::overload_cast<
            const size_t&,
            size_t,
@@ -239,7 +333,8 @@ void H5Seis_py(
            py::arg_v("nHdr", std::numeric_limits<size_t>::max(), "sys.maxint"),
            py::arg_v("unitsFrom", std::vector<std::string>(), "list()"),
            py::arg_v("unitsTo", std::vector<std::string>(), "list()"),
-           "Get block of trace headers. If `nTrc` or `nHdr` exceed max values then these values are changed to max allowed (that is why they are not `const`)")
+           "Get block of trace headers. If `nTrc` or `nHdr` exceed max values then these values are changed to max allowed (that is why they are not `const`)",
+           py::call_guard<gil_scoped_release_h5io>())
       .def("getTraceHeader", py::overload_cast<
            const std::string&,
            const size_t&,
@@ -251,7 +346,8 @@ void H5Seis_py(
            py::arg_v("fromTrc", 0, "0"),
            py::arg_v("nTrc", 1, "1"),
            py::arg_v("unitsFrom", "", "str()"),
-           py::arg_v("unitsTo", "", "str()"))
+           py::arg_v("unitsTo", "", "str()"),
+           py::call_guard<gil_scoped_release_h5io>())
       .def("getTraceHeader", py::overload_cast<
            const std::vector<size_t>&,
            const std::vector<size_t>&,
@@ -261,7 +357,8 @@ void H5Seis_py(
            py::arg("trcInd"),
            py::arg("trcHdrInd"),
            py::arg_v("unitsFrom", std::vector<std::string>(), "list()"),
-           py::arg_v("unitsTo", std::vector<std::string>(), "list()"))
+           py::arg_v("unitsTo", std::vector<std::string>(), "list()"),
+           py::call_guard<gil_scoped_release_h5io>())
       .def("getTraceHeader", py::overload_cast<
            const std::vector<std::string>&,
            const std::vector<size_t>&,
@@ -271,8 +368,8 @@ void H5Seis_py(
            py::arg("hdrNames"),
            py::arg("trcHdrInd"),
            py::arg_v("unitsFrom", std::vector<std::string>(), "list()"),
-           py::arg_v("unitsTo", std::vector<std::string>(), "list()"))
-
+           py::arg_v("unitsTo", std::vector<std::string>(), "list()"),
+           py::call_guard<gil_scoped_release_h5io>())
       .def("getXYTraceHeaders", py::overload_cast<
            const std::vector<std::string>&,
            const size_t&,
@@ -284,7 +381,8 @@ void H5Seis_py(
            py::arg_v("fromTrc", 0, "0"),
            py::arg_v("nTrc", std::numeric_limits<size_t>::max(), "sys.maxint"),
            py::arg_v("lengthUnits", "", "str()"),
-           py::arg_v("doCoordTransform", false, "False"))
+           py::arg_v("doCoordTransform", false, "False"),
+           py::call_guard<gil_scoped_release_h5io>())
       .def("getXYTraceHeaders", py::overload_cast<
            const std::vector<std::string>&,
            const Eigen::Ref<const Eigen::VectorX<size_t>>&,
@@ -294,8 +392,8 @@ void H5Seis_py(
            py::arg("xyHdrNames"),
            py::arg("trcInd"),
            py::arg_v("lengthUnits", "", "str()"),
-           py::arg_v("doCoordTransform", false, "False"))
-
+           py::arg_v("doCoordTransform", false, "False"),
+           py::call_guard<gil_scoped_release_h5io>())
 
       .def("getSortedData", &ext::getSortedData,
            py::arg("keyList"),
@@ -448,6 +546,15 @@ void H5Seis_py(
            py::arg("pKeyName"))
       .def("addPKeySort", &H5Seis::addPKeySort,
            py::arg("pKeyName"))
+      .def("hasCompositeSort", &H5Seis::hasCompositeSort,
+           py::arg("keyList"))
+      .def("removeCompositeSort", &H5Seis::removeCompositeSort,
+           py::arg("keyList"))
+      .def("addCompositeSort", &H5Seis::addCompositeSort,
+           py::arg("keyList"),
+           "Prepare composite sort (for ex. `['INLINE', 'XLINE']`). "
+           "`getSortedData(...)` with the same `keyList` then doesn't need to sort headers")
+      .def("getCompositeSortNames", &H5Seis::getCompositeSortNames)
 
       .def("updateTraceHeaderSampRate", &H5Seis::updateTraceHeaderSampRate)
       .def("updateTraceHeaderNSamp", &H5Seis::updateTraceHeaderNSamp)
@@ -461,6 +568,7 @@ void H5Seis_py(
       .def("getSortG", &H5Seis::getSortG)
       .def("getUValG", &H5Seis::getUValG)
       .def("getIndexesG", &H5Seis::getIndexesG)
+      .def("getCompositeG", &H5Seis::getCompositeG)
 
       .def("getSEGYG", &H5Seis::getSEGYG)
       .def("getSEGYTextHeaderD", &H5Seis::getSEGYTextHeaderD)
@@ -475,11 +583,106 @@ void H5Seis_py(
            py::arg_v("nTrcBuffer", 1e7, "int(1e7)")) // `int` is important
       .def("updatePKeySort", &H5Seis::updatePKeySort,
            py::arg("pKeyName"))
+      .def("updateCompositeSort", &H5Seis::updateCompositeSort,
+           py::arg("keyList"))
 
       .def("calcBoundary", &H5Seis::calcBoundary,
            py::arg_v("lengthUnits", "", "str()"),
            py::arg_v("doCoordTransform", false, "False"),
            "calculate boundary of 2D or 3D seismic survey")
+      .def("updateBoundary", &H5Seis::updateBoundary,
+           py::arg_v("boundaryType", BoundaryType::CONVEX, "BoundaryType.CONVEX"),
+           py::arg_v("cellSize", 0, "0"),
+           py::arg_v("nTrcBuffer", size_t(1e6), "int(1e6)"),
+           py::call_guard<gil_scoped_release_h5io>(),
+           "calculate boundary streaming `CDP_X`, `CDP_Y` and save it within seis group")
+      .def("removeBoundary", &H5Seis::removeBoundary)
+      .def("getBoundaryD", &H5Seis::getBoundaryD)
+
+      .def("calcSurveyInfo", &ext::calcSurveyInfo,
+           py::arg_v("xHeader", "CDP_X", "CDP_X"),
+           py::arg_v("yHeader", "CDP_Y", "CDP_Y"),
+           py::arg_v("ilHeader", "INLINE", "INLINE"),
+           py::arg_v("xlHeader", "XLINE", "XLINE"),
+           py::arg_v("ilMin", std::numeric_limits<double>::lowest(), "-sys.float_info.max"),
+           py::arg_v("ilMax", std::numeric_limits<double>::max(), "sys.float_info.max"),
+           py::arg_v("xlMin", std::numeric_limits<double>::lowest(), "-sys.float_info.max"),
+           py::arg_v("xlMax", std::numeric_limits<double>::max(), "sys.float_info.max"),
+           py::arg_v("nTrcBuffer", 1e6, "int(1e6)"), // `int` is important
+           "estimate survey geometry without sorting trace headers. "
+           "Return: status, SurveyInfo")
+      .def("calcTraceCellIndexes", &H5Seis::calcTraceCellIndexes,
+           py::arg("info"),
+           py::arg_v("ilHeader", "INLINE", "INLINE"),
+           py::arg_v("xlHeader", "XLINE", "XLINE"),
+           py::arg_v("nTrcBuffer", 1e6, "int(1e6)"),
+           "map each trace to survey grid cell (`-1` if trace is outside the grid)")
+
+      .def("calcWindowAttribute", &H5Seis::calcWindowAttribute,
+           py::arg("x"),
+           py::arg("y"),
+           py::arg("z"),
+           py::arg("windowAbove"),
+           py::arg("windowBelow"),
+           py::arg("attribute"),
+           py::arg_v("lengthUnits", "", "str()"),
+           py::arg_v("zUnits", "", "str()"),
+           py::arg_v("xHeader", "CDP_X", "CDP_X"),
+           py::arg_v("yHeader", "CDP_Y", "CDP_Y"),
+           py::arg_v("ilHeader", "INLINE", "INLINE"),
+           py::arg_v("xlHeader", "XLINE", "XLINE"),
+           "calculate amplitude attribute within window `[z-windowAbove, z+windowBelow]` "
+           "at the nearest traces (`NaN` for points outside the survey)")
+      .def("interpolateAmplitudes", &H5Seis::interpolateAmplitudes,
+           py::arg("x"),
+           py::arg("y"),
+           py::arg("z"),
+           py::arg_v("lengthUnits", "", "str()"),
+           py::arg_v("zUnits", "", "str()"),
+           py::arg_v("xHeader", "CDP_X", "CDP_X"),
+           py::arg_v("yHeader", "CDP_Y", "CDP_Y"),
+           py::arg_v("ilHeader", "INLINE", "INLINE"),
+           py::arg_v("xlHeader", "XLINE", "XLINE"),
+           "interpolate amplitudes along Z at the nearest traces "
+           "(`NaN` for points outside the survey)")
+      .def("extractAlongTrajectory", &H5Seis::extractAlongTrajectory,
+           py::arg("traj"),
+           py::arg("md"),
+           py::arg_v("tdCurve", TimeDepthCurve(), "TimeDepthCurve()"),
+           py::arg_v("lengthUnits", "", "str()"),
+           py::arg_v("temporalUnits", "", "str()"),
+           py::arg_v("xHeader", "CDP_X", "CDP_X"),
+           py::arg_v("yHeader", "CDP_Y", "CDP_Y"),
+           py::arg_v("ilHeader", "INLINE", "INLINE"),
+           py::arg_v("xlHeader", "XLINE", "XLINE"),
+           "interpolate amplitudes along well trajectory sampled at `md`")
+      .def("calcHorizonWindowAttribute", &H5Seis::calcHorizonWindowAttribute,
+           py::arg("horizon"),
+           py::arg("componentName"),
+           py::arg("windowAbove"),
+           py::arg("windowBelow"),
+           py::arg("attribute"),
+           py::arg_v("xComponent", "X", "X"),
+           py::arg_v("yComponent", "Y", "Y"),
+           py::arg_v("zComponent", "Z", "Z"),
+           py::arg_v("xHeader", "CDP_X", "CDP_X"),
+           py::arg_v("yHeader", "CDP_Y", "CDP_Y"),
+           py::arg_v("ilHeader", "INLINE", "INLINE"),
+           py::arg_v("xlHeader", "XLINE", "XLINE"),
+           "calculate amplitude attribute along horizon and write it as horizon component")
+      .def("calcMapWindowAttribute", &H5Seis::calcMapWindowAttribute,
+           py::arg("map"),
+           py::arg("mapName"),
+           py::arg("windowAbove"),
+           py::arg("windowBelow"),
+           py::arg("attribute"),
+           py::arg_v("createFlag", h5geo::CreationType::CREATE_OR_OVERWRITE, "_h5geo.CreationType.CREATE_OR_OVERWRITE"),
+           py::arg_v("xHeader", "CDP_X", "CDP_X"),
+           py::arg_v("yHeader", "CDP_Y", "CDP_Y"),
+           py::arg_v("ilHeader", "INLINE", "INLINE"),
+           py::arg_v("xlHeader", "XLINE", "XLINE"),
+           "calculate amplitude attribute along map and write it to new map "
+           "(the same geometry and container)")
 
       .def("exportToVol", &H5Seis::exportToVol,
            py::arg("vol"),
@@ -487,10 +690,10 @@ void H5Seis_py(
            py::arg_v("CDP_Y", "CDP_Y", "CDP_Y"),
            py::arg_v("INLINE", "INLINE", "INLINE"),
            py::arg_v("XLINE", "XLINE", "XLINE"),
-           py::arg_v("ilMin", std::numeric_limits<size_t>::min(), "sys.minint"),
-           py::arg_v("ilMax", std::numeric_limits<size_t>::max(), "sys.maxint"),
-           py::arg_v("xlMin", std::numeric_limits<size_t>::min(), "sys.minint"),
-           py::arg_v("xlMax", std::numeric_limits<size_t>::max(), "sys.maxint"),
+           py::arg_v("ilMin", std::numeric_limits<double>::lowest(), "-sys.float_info.max"),
+           py::arg_v("ilMax", std::numeric_limits<double>::max(), "sys.float_info.max"),
+           py::arg_v("xlMin", std::numeric_limits<double>::lowest(), "-sys.float_info.max"),
+           py::arg_v("xlMax", std::numeric_limits<double>::max(), "sys.float_info.max"),
            py::arg_v("fromSampInd", 0, "0"),
            py::arg_v("nSamp", std::numeric_limits<size_t>::max(), "sys.maxint"),
            py::arg_v("progressCallback", nullptr, "None"),
@@ -0,0 +1,62 @@
+#include "../../include/h5geopy/h5surveyinfo_py.h"
+
+namespace h5geopy {
+
+namespace ext {
+
+std::tuple<bool, SurveyInfo>
+estimate(SurveyInfoEstimator* self)
+{
+  SurveyInfo info;
+  bool status = self->estimate(info);
+  return std::make_tuple(std::move(status), std::move(info));
+}
+
+} // ext
+
+void SurveyInfo_py(
+    py::class_<SurveyInfo>
+    &py_obj){
+  py_obj
+      .def(py::init<>())
+      .def_readwrite("origin_x", &SurveyInfo::origin_x)
+      .def_readwrite("origin_y", &SurveyInfo::origin_y)
+      .def_readwrite("orientation", &SurveyInfo::orientation)
+      .def_readwrite("ilSpacing", &SurveyInfo::ilSpacing)
+      .def_readwrite("xlSpacing", &SurveyInfo::xlSpacing)
+      .def_readwrite("isILReversed", &SurveyInfo::isILReversed)
+      .def_readwrite("isXLReversed", &SurveyInfo::isXLReversed)
+      .def_readwrite("isPlanReversed", &SurveyInfo::isPlanReversed)
+      .def_readwrite("ilMin", &SurveyInfo::ilMin)
+      .def_readwrite("ilMax", &SurveyInfo::ilMax)
+      .def_readwrite("ilStep", &SurveyInfo::ilStep)
+      .def_readwrite("nIL", &SurveyInfo::nIL)
+      .def_readwrite("xlMin", &SurveyInfo::xlMin)
+      .def_readwrite("xlMax", &SurveyInfo::xlMax)
+      .def_readwrite("xlStep", &SurveyInfo::xlStep)
+      .def_readwrite("nXL", &SurveyInfo::nXL)
+      .def_readwrite("nTrc", &SurveyInfo::nTrc)
+      .def_readwrite("residual", &SurveyInfo::residual)
+      .def("isRegular", &SurveyInfo::isRegular,
+           "each grid cell is occupied by exactly one trace");
+}
+
+void SurveyInfoEstimator_py(
+    py::class_<SurveyInfoEstimator>
+    &py_obj){
+  py_obj
+      .def(py::init<size_t>(),
+           py::arg_v("sampleSize", 4096, "4096"))
+      .def("add", &SurveyInfoEstimator::add,
+           py::arg("il"),
+           py::arg("xl"),
+           py::arg("x"),
+           py::arg("y"),
+           "accumulate block of trace headers (any order)")
+      .def("estimate", &ext::estimate,
+           "Return: status, SurveyInfo")
+      .def("getNTrc", &SurveyInfoEstimator::getNTrc)
+      .def("reset", &SurveyInfoEstimator::reset);
+}
+
+} // h5geopy
@@ -1,7 +1,29 @@
 #include "../../include/h5geopy/h5vol_py.h"
+#include "../../include/h5geopy/h5ioqueue_py.h"
+#include <h5geo/private/h5horizonimpl.h>
+#include <h5geo/private/h5mapimpl.h>
 
 namespace h5geopy {
 
+namespace ext {
+
+ext::IOFuture<Eigen::MatrixXf>
+getDataAsync(
+    H5Vol* self,
+    const size_t& iX0,
+    const size_t& iY0,
+    const size_t& iZ0,
+    const size_t& nX,
+    const size_t& nY,
+    const size_t& nZ,
+    const std::string& dataUnits = "")
+{
+  return ext::IOFuture<Eigen::MatrixXf>(self->getDataAsync(
+        iX0, iY0, iZ0, nX, nY, nZ, dataUnits));
+}
+
+} // ext
+
 void H5Vol_py(
     py::class_<
     H5Vol,
@@ -67,7 +89,31 @@ void H5Vol_py(
            py::arg("nX"),
            py::arg("nY"),
            py::arg("nZ"),
-           py::arg_v("dataUnits", "", "str()"))
+           py::arg_v("dataUnits", "", "str()"),
+           py::call_guard<gil_scoped_release_h5io>())
+      .def("readData", &H5Vol::readData,
+           py::arg("data").noconvert(),
+           py::arg("iX0"),
+           py::arg("iY0"),
+           py::arg("iZ0"),
+           py::arg("nX"),
+           py::arg("nY"),
+           py::arg("nZ"),
+           py::arg_v("dataUnits", "", "str()"),
+           py::call_guard<gil_scoped_release_h5io>(),
+           "Read subvolume directly to `data` array (`nX*nY x nZ`) without copying. "
+           "`data` must be writeable Fortran ordered `float32` array")
+      .def("getDataAsync", &ext::getDataAsync,
+           py::arg("iX0"),
+           py::arg("iY0"),
+           py::arg("iZ0"),
+           py::arg("nX"),
+           py::arg("nY"),
+           py::arg("nZ"),
+           py::arg_v("dataUnits", "", "str()"),
+           "Queue reading subvolume to the I/O thread. "
+           "Return awaitable `IOFutureMatrixXf` (use `result()` to block). "
+           "Bricks queued together having adjacent `Z` ranges are read by one hyperslab")
       .def("getDomain", &H5Vol::getDomain)
       .def("getOrigin", &H5Vol::getOrigin,
            py::arg_v("lengthUnits", "", "str()"),
@@ -85,6 +131,52 @@ void H5Vol_py(
       .def("openVolContainer", &H5Vol::openVolContainer)
       .def("getVolD", &H5Vol::getVolD)
 
+      .def("calcWindowAttribute", &H5Vol::calcWindowAttribute,
+           py::arg("x"),
+           py::arg("y"),
+           py::arg("z"),
+           py::arg("windowAbove"),
+           py::arg("windowBelow"),
+           py::arg("attribute"),
+           py::arg_v("lengthUnits", "", "str()"),
+           py::arg_v("zUnits", "", "str()"),
+           "calculate amplitude attribute within window `[z-windowAbove, z+windowBelow]` "
+           "at the nearest XY nodes (`NaN` for points outside the volume)")
+      .def("interpolateAmplitudes", &H5Vol::interpolateAmplitudes,
+           py::arg("x"),
+           py::arg("y"),
+           py::arg("z"),
+           py::arg_v("lengthUnits", "", "str()"),
+           py::arg_v("zUnits", "", "str()"),
+           "interpolate amplitudes along Z at the nearest XY nodes "
+           "(`NaN` for points outside the volume)")
+      .def("extractAlongTrajectory", &H5Vol::extractAlongTrajectory,
+           py::arg("traj"),
+           py::arg("md"),
+           py::arg_v("tdCurve", TimeDepthCurve(), "TimeDepthCurve()"),
+           py::arg_v("lengthUnits", "", "str()"),
+           py::arg_v("temporalUnits", "", "str()"),
+           "interpolate amplitudes along well trajectory sampled at `md`")
+      .def("calcHorizonWindowAttribute", &H5Vol::calcHorizonWindowAttribute,
+           py::arg("horizon"),
+           py::arg("componentName"),
+           py::arg("windowAbove"),
+           py::arg("windowBelow"),
+           py::arg("attribute"),
+           py::arg_v("xComponent", "X", "X"),
+           py::arg_v("yComponent", "Y", "Y"),
+           py::arg_v("zComponent", "Z", "Z"),
+           "calculate amplitude attribute along horizon and write it as horizon component")
+      .def("calcMapWindowAttribute", &H5Vol::calcMapWindowAttribute,
+           py::arg("map"),
+           py::arg("mapName"),
+           py::arg("windowAbove"),
+           py::arg("windowBelow"),
+           py::arg("attribute"),
+           py::arg_v("createFlag", h5geo::CreationType::CREATE_OR_OVERWRITE, "_h5geo.CreationType.CREATE_OR_OVERWRITE"),
+           "calculate amplitude attribute along map and write it to new map "
+           "(the same geometry and container)")
+
       .def("exportToSEGY", &H5Vol::exportToSEGY,
            py::arg("segyFile"),
            py::arg_v("endian", h5geo::Endian::Big, "_h5geo.Endian.Big"),
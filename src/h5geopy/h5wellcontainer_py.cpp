@@ -2,6 +2,16 @@
 
 namespace h5geopy {
 
+void WellLogs_py(py::class_<H5WellLogs> &py_obj){
+  py_obj
+      .def(py::init<>())
+      .def_readwrite("wellNames", &H5WellLogs::wellNames)
+      .def_readwrite("offsets", &H5WellLogs::offsets)
+      .def_readwrite("md", &H5WellLogs::md)
+      .def_readwrite("val", &H5WellLogs::val)
+      .def("getNWells", &H5WellLogs::getNWells);
+}
+
 void H5WellContainer_py(
     py::class_<
     H5WellContainer,
@@ -23,6 +33,11 @@ void H5WellContainer_py(
            CreationType>(
              &H5WellContainer::createWell))
       .def("openWellByUWI", &H5WellContainer::openWellByUWI)
+      .def("getLogCurves", &H5WellContainer::getLogCurves,
+           py::arg("logType"), py::arg("logName"),
+           py::arg_v("wellNames", std::vector<std::string>(), "list()"),
+           py::arg_v("lengthUnits", "", "str()"),
+           py::arg_v("dataUnits", "", "str()"))
       .def("createWell", py::overload_cast<
            h5gt::Group,
            H5WellParam&,
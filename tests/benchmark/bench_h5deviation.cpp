@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+#include <h5geo/private/h5deviation.h>
+
+#include <algorithm>
+#include <vector>
+
+// Synthetic J-shaped well: vertical part, build up to 60 degree and
+// tangent section while azimuth slowly turns
+static Eigen::MatrixXd syntheticMdAzIncl(ptrdiff_t nSamp, double azim0 = 0){
+  Eigen::MatrixXd M(nSamp, 3);
+  for (ptrdiff_t i = 0; i < nSamp; i++){
+    M(i, 0) = 10*i;
+    M(i, 1) = std::fmod(azim0 + 0.05*i, 360);
+    M(i, 2) = std::clamp(0.1*(i - nSamp/10), 0.0, 60.0);
+  }
+  return M;
+}
+
+// Input of `trajFormat` calculated from synthetic MD_AZIM_INCL well
+static Eigen::MatrixXd syntheticTrajectory(
+    ptrdiff_t nSamp, h5geo::TrajectoryFormat trajFormat, double azim0 = 0)
+{
+  Eigen::MatrixXd MdAzIncl = syntheticMdAzIncl(nSamp, azim0);
+  if (trajFormat == h5geo::TrajectoryFormat::MD_AZIM_INCL)
+    return MdAzIncl;
+
+  Eigen::MatrixXd ALL = h5geo::MdAzIncl2ALL(
+        MdAzIncl, 1000, 2000, 50, "degree", "degree", false);
+  switch (trajFormat) {
+  case h5geo::TrajectoryFormat::TVD_X_Y:
+    return ALL(Eigen::all, {4, 1, 2});
+  case h5geo::TrajectoryFormat::TVD_DX_DY:
+    return ALL(Eigen::all, {4, 5, 6});
+  case h5geo::TrajectoryFormat::TVDSS_X_Y:
+    return ALL(Eigen::all, {3, 1, 2});
+  case h5geo::TrajectoryFormat::TVDSS_DX_DY:
+    return ALL(Eigen::all, {3, 5, 6});
+  default:
+    return Eigen::MatrixXd();
+  }
+}
+
+static void BM_MdAzIncl2MdXYTvd(benchmark::State& state){
+  ptrdiff_t nSamp = state.range(0);
+  Eigen::MatrixXd M = syntheticMdAzIncl(nSamp);
+  for (auto _ : state){
+    Eigen::MatrixXd out = h5geo::MdAzIncl2MdXYTvd(M, 1000.0, 2000.0, "degree", false);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.counters["stations/s"] = benchmark::Counter(
+        double(state.iterations() * nSamp), benchmark::Counter::kIsRate);
+}
+
+static void BM_MdAzIncl2MdXYTvd_float(benchmark::State& state){
+  ptrdiff_t nSamp = state.range(0);
+  Eigen::MatrixXf M = syntheticMdAzIncl(nSamp).cast<float>();
+  for (auto _ : state){
+    Eigen::MatrixXf out = h5geo::MdAzIncl2MdXYTvd(M, 1000.0, 2000.0, "degree", false);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.counters["stations/s"] = benchmark::Counter(
+        double(state.iterations() * nSamp), benchmark::Counter::kIsRate);
+}
+
+static void BM_TvdDxDy2MdAzIncl(benchmark::State& state){
+  ptrdiff_t nSamp = state.range(0);
+  Eigen::MatrixXd M = syntheticTrajectory(nSamp, h5geo::TrajectoryFormat::TVD_DX_DY);
+  for (auto _ : state){
+    Eigen::MatrixXd out = h5geo::TvdDxDy2MdAzIncl(M, "degree", false);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.counters["stations/s"] = benchmark::Counter(
+        double(state.iterations() * nSamp), benchmark::Counter::kIsRate);
+}
+
+// args: number of stations, h5geo::TrajectoryFormat
+static void BM_traj2ALL(benchmark::State& state){
+  ptrdiff_t nSamp = state.range(0);
+  auto trajFormat = static_cast<h5geo::TrajectoryFormat>(state.range(1));
+  Eigen::MatrixXd M = syntheticTrajectory(nSamp, trajFormat);
+  for (auto _ : state){
+    Eigen::MatrixXd out = h5geo::traj2ALL(
+          M, 1000, 2000, 50, "degree", "degree", trajFormat, false);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.counters["stations/s"] = benchmark::Counter(
+        double(state.iterations() * nSamp), benchmark::Counter::kIsRate);
+}
+
+// args: number of wells, number of stations, h5geo::TrajectoryFormat
+static void BM_traj2ALLWellByWell(benchmark::State& state){
+  ptrdiff_t nWell = state.range(0);
+  ptrdiff_t nSamp = state.range(1);
+  auto trajFormat = static_cast<h5geo::TrajectoryFormat>(state.range(2));
+  std::vector<Eigen::MatrixXd> M(nWell);
+  for (ptrdiff_t i = 0; i < nWell; i++)
+    M[i] = syntheticTrajectory(nSamp, trajFormat, i);
+
+  for (auto _ : state){
+    for (ptrdiff_t i = 0; i < nWell; i++){
+      Eigen::MatrixXd out = h5geo::traj2ALL(
+            M[i], 1000, 2000, 50, "degree", "degree", trajFormat, false);
+      benchmark::DoNotOptimize(out.data());
+    }
+  }
+  state.counters["wells/s"] = benchmark::Counter(
+        double(state.iterations() * nWell), benchmark::Counter::kIsRate);
+}
+
+// args: number of wells, number of stations, h5geo::TrajectoryFormat
+static void BM_traj2ALLBatch(benchmark::State& state){
+  ptrdiff_t nWell = state.range(0);
+  ptrdiff_t nSamp = state.range(1);
+  auto trajFormat = static_cast<h5geo::TrajectoryFormat>(state.range(2));
+  std::vector<Eigen::MatrixXd> M(nWell);
+  for (ptrdiff_t i = 0; i < nWell; i++)
+    M[i] = syntheticTrajectory(nSamp, trajFormat, i);
+
+  Eigen::VectorXd x0 = Eigen::VectorXd::Constant(nWell, 1000);
+  Eigen::VectorXd y0 = Eigen::VectorXd::Constant(nWell, 2000);
+  Eigen::VectorXd kb = Eigen::VectorXd::Constant(nWell, 50);
+  for (auto _ : state){
+    std::vector<Eigen::MatrixXd> out = h5geo::traj2ALL(
+          M, x0, y0, kb, "degree", "degree", trajFormat, false);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.counters["wells/s"] = benchmark::Counter(
+        double(state.iterations() * nWell), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_MdAzIncl2MdXYTvd)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_MdAzIncl2MdXYTvd_float)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_TvdDxDy2MdAzIncl)->Arg(100)->Arg(1000)->Arg(10000);
+// 1 - MD_AZIM_INCL, 2 - TVD_X_Y, 3 - TVD_DX_DY, 4 - TVDSS_X_Y, 5 - TVDSS_DX_DY
+BENCHMARK(BM_traj2ALL)->ArgsProduct({{1000}, {1, 2, 3, 4, 5}});
+BENCHMARK(BM_traj2ALLWellByWell)
+->ArgsProduct({{50000}, {300}, {1, 3}})
+->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_traj2ALLBatch)
+->ArgsProduct({{50000}, {300}, {1, 3}})
+->Unit(benchmark::kMillisecond);
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include <h5geo/private/h5easyhull.h>
+
+// Prestack-like survey: each CDP is repeated by the fold
+static Eigen::MatrixX2d syntheticCDP(ptrdiff_t nTrc, ptrdiff_t fold = 60){
+  Eigen::MatrixX2d xy(nTrc, 2);
+  ptrdiff_t nCdp = std::max<ptrdiff_t>(nTrc / fold, 1);
+  ptrdiff_t nX = std::max<ptrdiff_t>(std::sqrt(nCdp), 1);
+  for (ptrdiff_t i = 0; i < nTrc; i++){
+    ptrdiff_t cdp = i % nCdp;
+    xy(i, 0) = 1000 + 25*(cdp % nX);
+    xy(i, 1) = 2000 + 12.5*(cdp / nX);
+  }
+  return xy;
+}
+
+static void BM_quickHull2D(benchmark::State& state){
+  Eigen::MatrixX2d xy = syntheticCDP(state.range(0));
+  for (auto _ : state){
+    Eigen::MatrixX2d hull = h5geo::quickHull2D(xy);
+    benchmark::DoNotOptimize(hull.data());
+  }
+  state.counters["points/s"] = benchmark::Counter(
+        double(state.iterations() * xy.rows()), benchmark::Counter::kIsRate);
+}
+
+static void BM_convexHull2D(benchmark::State& state){
+  Eigen::MatrixX2d xy = syntheticCDP(state.range(0));
+  for (auto _ : state){
+    Eigen::MatrixX2d hull = h5geo::convexHull2D(xy);
+    benchmark::DoNotOptimize(hull.data());
+  }
+  state.counters["points/s"] = benchmark::Counter(
+        double(state.iterations() * xy.rows()), benchmark::Counter::kIsRate);
+}
+
+static void BM_ConcaveBoundaryEstimator(benchmark::State& state){
+  Eigen::MatrixX2d xy = syntheticCDP(state.range(0));
+  for (auto _ : state){
+    h5geo::ConcaveBoundaryEstimator<double> estimator(
+          xy.col(0).minCoeff(), xy.col(1).minCoeff(),
+          xy.col(0).maxCoeff(), xy.col(1).maxCoeff());
+    estimator.add(xy);
+    Eigen::MatrixX2d boundary = estimator.getBoundary();
+    benchmark::DoNotOptimize(boundary.data());
+  }
+  state.counters["points/s"] = benchmark::Counter(
+        double(state.iterations() * xy.rows()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_quickHull2D)->Arg(1e5)->Arg(1e7)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_convexHull2D)->Arg(1e5)->Arg(1e7)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConcaveBoundaryEstimator)->Arg(1e5)->Arg(1e7)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include <h5geo/h5mapcontainer.h>
+#include <h5geo/h5map.h>
+#include <h5geo/h5core.h>
+
+#include <h5gt/H5File.hpp>
+
+#include <algorithm>
+#include <string>
+
+static H5Map* createSyntheticMap(
+    H5MapContainer* mapContainer, size_t n, bool floatData)
+{
+  H5MapParam p;
+  p.X0 = 0;
+  p.Y0 = 0;
+  p.X1 = 25*n;
+  p.Y1 = 0;
+  p.X2 = 0;
+  p.Y2 = 25*n;
+  p.nX = n;
+  p.nY = n;
+  p.domain = h5geo::Domain::TVD;
+  p.lengthUnits = "meter";
+  p.floatData = floatData;
+  return mapContainer->createMap(
+        "map", p, h5geo::CreationType::CREATE_OR_OVERWRITE);
+}
+
+// Write the whole n x n map: `floatData` stores it as 32-bit float
+static void BM_mapWriteData(benchmark::State& state){
+  size_t n = state.range(0);
+  bool floatData = state.range(1);
+
+  h5gt::File mapFile("bench_map.h5", h5gt::File::OpenOrCreate |
+                     h5gt::File::Overwrite);
+  H5MapCnt_ptr mapContainer(h5geo::createMapContainer(
+                              mapFile, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  H5Map_ptr map(createSyntheticMap(mapContainer.get(), n, floatData));
+  if (!map){
+    state.SkipWithError("Unable to create synthetic data");
+    return;
+  }
+
+  Eigen::MatrixXd M = Eigen::MatrixXd::Random(n, n);
+  for (auto _ : state){
+    if (!map->writeData(M)){
+      state.SkipWithError("writeData failed");
+      break;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+
+// Read the whole map (`stride == 0`) or a 256 x 256 tile taking every `stride` node
+static void BM_mapGetData(benchmark::State& state){
+  size_t n = state.range(0);
+  size_t stride = state.range(1);
+
+  h5gt::File mapFile("bench_map.h5", h5gt::File::OpenOrCreate |
+                     h5gt::File::Overwrite);
+  H5MapCnt_ptr mapContainer(h5geo::createMapContainer(
+                              mapFile, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  H5Map_ptr map(createSyntheticMap(mapContainer.get(), n, false));
+  Eigen::MatrixXd M = Eigen::MatrixXd::Random(n, n);
+  if (!map || !map->writeData(M)){
+    state.SkipWithError("Unable to create synthetic data");
+    return;
+  }
+
+  size_t nRead = 0;
+  for (auto _ : state){
+    Eigen::MatrixXd data = stride < 1 ?
+          map->getData() :
+          map->getData(n/4, n/4, std::min<size_t>(256, n/2), std::min<size_t>(256, n/2), stride);
+    benchmark::DoNotOptimize(data.data());
+    nRead = data.size();
+  }
+  state.SetBytesProcessed(state.iterations() * nRead * sizeof(double));
+}
+
+BENCHMARK(BM_mapWriteData)
+->ArgsProduct({{1024, 4096}, {0, 1}})
+->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_mapGetData)
+->ArgsProduct({{1024, 4096}, {0, 1, 4}})
+->Unit(benchmark::kMillisecond);
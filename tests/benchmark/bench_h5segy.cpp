@@ -0,0 +1,178 @@
+#include <benchmark/benchmark.h>
+#include <h5geo/h5seiscontainer.h>
+#include <h5geo/h5seis.h>
+#include <h5geo/h5core.h>
+
+#include <h5gt/H5File.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+void putBigEndian(std::vector<char>& buf, size_t pos, uint32_t v){
+  buf[pos] = char(v >> 24);
+  buf[pos+1] = char(v >> 16);
+  buf[pos+2] = char(v >> 8);
+  buf[pos+3] = char(v);
+}
+
+void putBigEndian(std::vector<char>& buf, size_t pos, uint16_t v){
+  buf[pos] = char(v >> 8);
+  buf[pos+1] = char(v);
+}
+
+// IBM float: sign, base-16 exponent biased by 64, 24-bit fraction
+uint32_t ieee2ibm(float f){
+  if (f == 0 || !std::isfinite(f))
+    return 0;
+
+  uint32_t sign = f < 0 ? 0x80000000u : 0;
+  double a = std::fabs(f);
+  int e = 0;
+  while (a >= 1){
+    a /= 16;
+    e++;
+  }
+  while (a < 1.0/16){
+    a *= 16;
+    e--;
+  }
+  return sign | (uint32_t(e + 64) << 24) | (uint32_t(a * (1 << 24)) & 0xFFFFFF);
+}
+
+uint16_t getFormatCode(h5geo::SegyFormat format){
+  switch (format) {
+  case h5geo::SegyFormat::FourByte_IBM:
+    return 1;
+  case h5geo::SegyFormat::FourByte_integer:
+    return 2;
+  default:
+    return 5;
+  }
+}
+
+} // namespace
+
+// Synthetic big endian SEGY of `nTrc` traces (IL/XL/CDP_X/CDP_Y are set)
+static std::string createSyntheticSEGY(
+    size_t nTrc, size_t nSamp, h5geo::SegyFormat format)
+{
+  std::string fileName =
+      "bench_" + std::to_string(nTrc) + "_" + std::to_string(nSamp) + "_" +
+      std::to_string(getFormatCode(format)) + ".sgy";
+  size_t bytesPerTrc = 240 + 4*nSamp;
+  if (std::filesystem::exists(fileName) &&
+      std::filesystem::file_size(fileName) == 3600 + nTrc*bytesPerTrc)
+    return fileName;
+
+  std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+  if (!file.is_open())
+    return "";
+
+  std::vector<char> buf(3600, 0x40);  // EBCDIC spaces
+  std::fill(buf.begin() + 3200, buf.end(), 0);
+  putBigEndian(buf, 3216, uint16_t(2000));   // sample interval (us)
+  putBigEndian(buf, 3220, uint16_t(nSamp));
+  putBigEndian(buf, 3224, getFormatCode(format));
+  file.write(buf.data(), buf.size());
+
+  size_t nXL = std::max<size_t>(1, size_t(std::sqrt(double(nTrc))));
+  std::srand(0);
+  buf.resize(bytesPerTrc);
+  for (size_t j = 0; j < nTrc; j++){
+    std::fill(buf.begin(), buf.end(), 0);
+    putBigEndian(buf, 0, uint32_t(j+1));             // TRACENO
+    putBigEndian(buf, 114, uint16_t(nSamp));          // NSAMP
+    putBigEndian(buf, 116, uint16_t(2000));           // SAMP_RATE
+    putBigEndian(buf, 180, uint32_t(500000 + 25*(j % nXL)));   // CDP_X
+    putBigEndian(buf, 184, uint32_t(6000000 + 25*(j / nXL)));  // CDP_Y
+    putBigEndian(buf, 188, uint32_t(1000 + j / nXL)); // INLINE
+    putBigEndian(buf, 192, uint32_t(2000 + j % nXL)); // XLINE
+    for (size_t i = 0; i < nSamp; i++){
+      float v = 1000 * (std::rand() / float(RAND_MAX) - 0.5f);
+      uint32_t bits;
+      if (format == h5geo::SegyFormat::FourByte_IBM){
+        bits = ieee2ibm(v);
+      } else if (format == h5geo::SegyFormat::FourByte_integer){
+        bits = uint32_t(int32_t(v));
+      } else {
+        std::memcpy(&bits, &v, 4);
+      }
+      putBigEndian(buf, 240 + 4*i, bits);
+    }
+    file.write(buf.data(), buf.size());
+  }
+  return fileName;
+}
+
+// SEGY import to H5Seis: `mmap` selects memory mapped reader
+static void readSEGY(benchmark::State& state, bool mmap){
+  size_t nTrc = state.range(0);
+  size_t nSamp = state.range(1);
+  h5geo::SegyFormat format = static_cast<h5geo::SegyFormat>(state.range(2));
+
+  std::string segy = createSyntheticSEGY(nTrc, nSamp, format);
+  h5gt::File seisFile("bench_segy.h5", h5gt::File::OpenOrCreate |
+                      h5gt::File::Overwrite);
+  H5SeisCnt_ptr seisContainer(h5geo::createSeisContainer(
+                                seisFile, h5geo::CreationType::CREATE_OR_OVERWRITE));
+
+  H5SeisParam p;
+  p.domain = h5geo::Domain::TWT;
+  p.lengthUnits = "meter";
+  p.temporalUnits = "millisecond";
+  p.dataType = h5geo::SeisDataType::STACK;
+  p.surveyType = h5geo::SurveyType::THREE_D;
+  p.nTrc = 1;
+  p.nSamp = nSamp;
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    "seis", p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  if (segy.empty() || !seis){
+    state.SkipWithError("Unable to create synthetic data");
+    return;
+  }
+
+  for (auto _ : state){
+    bool val = mmap ?
+          h5geo::readSEGYTracesMMap(
+            seis.get(), segy, false, nSamp, nTrc, format, h5geo::Endian::Big) :
+          h5geo::readSEGYTraces(
+            seis.get(), segy, false, nSamp, nTrc, format, h5geo::Endian::Big);
+    if (!val){
+      state.SkipWithError("SEGY import failed");
+      break;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * nTrc * (240 + nSamp * sizeof(float)));
+  state.counters["traces/s"] = benchmark::Counter(
+        double(state.iterations() * nTrc), benchmark::Counter::kIsRate);
+}
+
+static void BM_readSEGYTraces(benchmark::State& state){
+  readSEGY(state, false);
+}
+
+static void BM_readSEGYTracesMMap(benchmark::State& state){
+  readSEGY(state, true);
+}
+
+BENCHMARK(BM_readSEGYTraces)
+->ArgsProduct({{5000, 50000}, {500},
+                {h5geo::SegyFormatUType(h5geo::SegyFormat::FourByte_IBM),
+                 h5geo::SegyFormatUType(h5geo::SegyFormat::FourByte_IEEE),
+                 h5geo::SegyFormatUType(h5geo::SegyFormat::FourByte_integer)}})
+->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_readSEGYTracesMMap)
+->ArgsProduct({{5000, 50000}, {500},
+                {h5geo::SegyFormatUType(h5geo::SegyFormat::FourByte_IBM),
+                 h5geo::SegyFormatUType(h5geo::SegyFormat::FourByte_IEEE),
+                 h5geo::SegyFormatUType(h5geo::SegyFormat::FourByte_integer)}})
+->Unit(benchmark::kMillisecond);
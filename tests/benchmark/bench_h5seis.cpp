@@ -0,0 +1,294 @@
+#include <benchmark/benchmark.h>
+#include <h5geo/h5seiscontainer.h>
+#include <h5geo/h5seis.h>
+#include <h5geo/h5volcontainer.h>
+#include <h5geo/h5vol.h>
+#include <h5geo/h5core.h>
+
+#include <h5gt/H5File.hpp>
+
+#include <cstdlib>
+#include <set>
+#include <string>
+
+// Traces (nSamp x nTrc) are scattered to XY chunk (nTrc x nSamp)
+static void BM_transposeTracesNaive(benchmark::State& state){
+  ptrdiff_t nSamp = state.range(0);
+  ptrdiff_t nTrc = state.range(1);
+  Eigen::MatrixXf src = Eigen::MatrixXf::Random(nSamp, nTrc);
+  Eigen::MatrixXf dst(nTrc, nSamp);
+  for (auto _ : state){
+    for (ptrdiff_t j = 0; j < nTrc; j++)
+      dst.row(j) = src.col(j).transpose();
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * nSamp * nTrc * sizeof(float));
+}
+
+static void BM_transposeTracesTiled(benchmark::State& state){
+  ptrdiff_t nSamp = state.range(0);
+  ptrdiff_t nTrc = state.range(1);
+  Eigen::MatrixXf src = Eigen::MatrixXf::Random(nSamp, nTrc);
+  Eigen::MatrixXf dst(nTrc, nSamp);
+  Eigen::VectorX<ptrdiff_t> dstOffset =
+      Eigen::VectorX<ptrdiff_t>::LinSpaced(nTrc, 0, nTrc-1);
+  Eigen::VectorX<ptrdiff_t> dstStride =
+      Eigen::VectorX<ptrdiff_t>::Constant(nTrc, nTrc);
+  for (auto _ : state){
+    h5geo::transposeTraces(src, dstOffset, dstStride, dst.data());
+    benchmark::DoNotOptimize(dst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * nSamp * nTrc * sizeof(float));
+}
+
+BENCHMARK(BM_transposeTracesNaive)
+->Args({1000, 64*64})->Args({4000, 64*64})->Args({1000, 128*128});
+BENCHMARK(BM_transposeTracesTiled)
+->Args({1000, 64*64})->Args({4000, 64*64})->Args({1000, 128*128});
+
+// Synthetic post-stack survey: nIL x nXL grid with nSamp samples.
+// It is overwritten once per process (a stale one may be left by a previous run)
+// and reused by the following benchmarks.
+static H5Seis* openSyntheticStack(
+    H5SeisContainer* seisContainer,
+    size_t nIL, size_t nXL, size_t nSamp)
+{
+  static std::set<std::string> created;
+  std::string seisName =
+      std::to_string(nIL) + "_" + std::to_string(nXL) + "_" + std::to_string(nSamp);
+  if (created.count(seisName) > 0)
+    return seisContainer->openSeis(seisName);
+
+  H5SeisParam p;
+  p.domain = h5geo::Domain::TWT;
+  p.lengthUnits = "meter";
+  p.temporalUnits = "millisecond";
+  p.dataType = h5geo::SeisDataType::STACK;
+  p.surveyType = h5geo::SurveyType::THREE_D;
+  p.nTrc = nIL*nXL;
+  p.nSamp = nSamp;
+  H5Seis* seis = seisContainer->createSeis(
+        seisName, p, h5geo::CreationType::CREATE_OR_OVERWRITE);
+  if (!seis)
+    return nullptr;
+
+  Eigen::MatrixXd il(p.nTrc, 1), xl(p.nTrc, 1), x(p.nTrc, 1), y(p.nTrc, 1);
+  for (size_t i = 0; i < nIL; i++){
+    for (size_t j = 0; j < nXL; j++){
+      il(i*nXL+j) = 1000+i;
+      xl(i*nXL+j) = 2000+j;
+      x(i*nXL+j) = 500000 + 25*j;
+      y(i*nXL+j) = 6000000 + 12.5*i;
+    }
+  }
+
+  seis->writeTraceHeader("INLINE", il);
+  seis->writeTraceHeader("XLINE", xl);
+  seis->writeTraceHeader("CDP_X", x);
+  seis->writeTraceHeader("CDP_Y", y);
+  for (size_t i = 0; i < nIL; i++)
+    seis->writeTrace(Eigen::MatrixXf::Random(nSamp, nXL), i*nXL);
+  created.insert(seisName);
+  return seis;
+}
+
+static void BM_exportToVol(benchmark::State& state){
+  size_t nIL = state.range(0);
+  size_t nXL = state.range(1);
+  size_t nSamp = state.range(2);
+
+  h5gt::File seisFile("bench_seis.h5", h5gt::File::OpenOrCreate);
+  H5SeisCnt_ptr seisContainer(h5geo::createSeisContainer(
+                                seisFile, h5geo::CreationType::OPEN_OR_CREATE));
+  H5Seis_ptr seis(openSyntheticStack(seisContainer.get(), nIL, nXL, nSamp));
+
+  h5gt::File volFile("bench_vol.h5", h5gt::File::OpenOrCreate |
+                     h5gt::File::Overwrite);
+  H5VolCnt_ptr volContainer(h5geo::createVolContainer(
+                              volFile, h5geo::CreationType::CREATE_OR_OVERWRITE));
+
+  H5VolParam vp;
+  vp.nX = 1;
+  vp.nY = 1;
+  vp.nZ = 1;
+  H5Vol_ptr vol(volContainer->createVol(
+                  "vol", vp, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  if (!seis || !vol){
+    state.SkipWithError("Unable to create synthetic data");
+    return;
+  }
+
+  for (auto _ : state){
+    if (!seis->exportToVol(vol.get())){
+      state.SkipWithError("exportToVol failed");
+      break;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * nIL * nXL * nSamp * sizeof(float));
+  state.counters["traces/s"] = benchmark::Counter(
+        double(state.iterations() * nIL * nXL), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_exportToVol)
+->Args({64, 64, 500})->Args({128, 128, 1000})->Args({256, 256, 1000})
+->Unit(benchmark::kMillisecond);
+
+// Read `nRead` traces starting from the middle of the survey
+static void BM_getTraceRange(benchmark::State& state){
+  size_t nIL = state.range(0);
+  size_t nXL = state.range(1);
+  size_t nSamp = state.range(2);
+  size_t nRead = state.range(3);
+
+  h5gt::File seisFile("bench_seis.h5", h5gt::File::OpenOrCreate);
+  H5SeisCnt_ptr seisContainer(h5geo::createSeisContainer(
+                                seisFile, h5geo::CreationType::OPEN_OR_CREATE));
+  H5Seis_ptr seis(openSyntheticStack(seisContainer.get(), nIL, nXL, nSamp));
+  if (!seis || nRead > seis->getNTrc()){
+    state.SkipWithError("Unable to create synthetic data");
+    return;
+  }
+
+  size_t fromTrc = (seis->getNTrc() - nRead) / 2;
+  for (auto _ : state){
+    Eigen::MatrixXf TRACE = seis->getTrace(fromTrc, nRead);
+    benchmark::DoNotOptimize(TRACE.data());
+  }
+  state.SetBytesProcessed(state.iterations() * nRead * nSamp * sizeof(float));
+  state.counters["traces/s"] = benchmark::Counter(
+        double(state.iterations() * nRead), benchmark::Counter::kIsRate);
+}
+
+// Read `nRead` traces scattered over the survey (random order)
+static void BM_getTraceByIndex(benchmark::State& state){
+  size_t nIL = state.range(0);
+  size_t nXL = state.range(1);
+  size_t nSamp = state.range(2);
+  size_t nRead = state.range(3);
+
+  h5gt::File seisFile("bench_seis.h5", h5gt::File::OpenOrCreate);
+  H5SeisCnt_ptr seisContainer(h5geo::createSeisContainer(
+                                seisFile, h5geo::CreationType::OPEN_OR_CREATE));
+  H5Seis_ptr seis(openSyntheticStack(seisContainer.get(), nIL, nXL, nSamp));
+  if (!seis){
+    state.SkipWithError("Unable to create synthetic data");
+    return;
+  }
+
+  std::srand(0);
+  Eigen::VectorX<size_t> trcInd(nRead);
+  for (size_t i = 0; i < nRead; i++)
+    trcInd(i) = std::rand() % seis->getNTrc();
+
+  for (auto _ : state){
+    Eigen::MatrixXf TRACE = seis->getTrace(trcInd);
+    benchmark::DoNotOptimize(TRACE.data());
+  }
+  state.SetBytesProcessed(state.iterations() * nRead * nSamp * sizeof(float));
+  state.counters["traces/s"] = benchmark::Counter(
+        double(state.iterations() * nRead), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_getTraceRange)
+->Args({64, 64, 500, 1000})->Args({128, 128, 1000, 1000})->Args({128, 128, 1000, 10000})
+->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_getTraceByIndex)
+->Args({64, 64, 500, 1000})->Args({128, 128, 1000, 1000})->Args({128, 128, 1000, 10000})
+->Unit(benchmark::kMillisecond);
+
+static void BM_addPKeySort(benchmark::State& state){
+  size_t nIL = state.range(0);
+  size_t nXL = state.range(1);
+  size_t nSamp = state.range(2);
+
+  h5gt::File seisFile("bench_seis.h5", h5gt::File::OpenOrCreate);
+  H5SeisCnt_ptr seisContainer(h5geo::createSeisContainer(
+                                seisFile, h5geo::CreationType::OPEN_OR_CREATE));
+  H5Seis_ptr seis(openSyntheticStack(seisContainer.get(), nIL, nXL, nSamp));
+  if (!seis){
+    state.SkipWithError("Unable to create synthetic data");
+    return;
+  }
+
+  for (auto _ : state){
+    state.PauseTiming();
+    seis->removePKeySort("XLINE");
+    state.ResumeTiming();
+    if (!seis->addPKeySort("XLINE")){
+      state.SkipWithError("addPKeySort failed");
+      break;
+    }
+  }
+  state.counters["traces/s"] = benchmark::Counter(
+        double(state.iterations() * nIL * nXL), benchmark::Counter::kIsRate);
+}
+
+// Read a quarter of inlines sorted by `INLINE-XLINE`
+static void BM_getSortedData(benchmark::State& state){
+  size_t nIL = state.range(0);
+  size_t nXL = state.range(1);
+  size_t nSamp = state.range(2);
+
+  h5gt::File seisFile("bench_seis.h5", h5gt::File::OpenOrCreate);
+  H5SeisCnt_ptr seisContainer(h5geo::createSeisContainer(
+                                seisFile, h5geo::CreationType::OPEN_OR_CREATE));
+  H5Seis_ptr seis(openSyntheticStack(seisContainer.get(), nIL, nXL, nSamp));
+  if (!seis || !seis->addPKeySort("INLINE")){
+    state.SkipWithError("Unable to create synthetic data");
+    return;
+  }
+
+  std::vector<std::string> keyList({"INLINE", "XLINE"});
+  std::vector<double> minList({1000, 2000});
+  std::vector<double> maxList({1000 + nIL/4.0 - 1, 2000 + nXL - 1.0});
+  size_t nTrc = 0;
+  for (auto _ : state){
+    Eigen::MatrixXf TRACE;
+    Eigen::MatrixXd HDR;
+    Eigen::VectorX<size_t> trcInd = seis->getSortedData(
+          TRACE, HDR, keyList, minList, maxList);
+    benchmark::DoNotOptimize(TRACE.data());
+    nTrc = trcInd.size();
+  }
+  state.SetBytesProcessed(state.iterations() * nTrc * nSamp * sizeof(float));
+  state.counters["traces/s"] = benchmark::Counter(
+        double(state.iterations() * nTrc), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_addPKeySort)
+->Args({64, 64, 500})->Args({128, 128, 1000})->Args({256, 256, 1000})
+->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_getSortedData)
+->Args({64, 64, 500})->Args({128, 128, 1000})->Args({256, 256, 1000})
+->Unit(benchmark::kMillisecond);
+
+static void BM_exportToSEGY(benchmark::State& state){
+  size_t nIL = state.range(0);
+  size_t nXL = state.range(1);
+  size_t nSamp = state.range(2);
+
+  h5gt::File seisFile("bench_seis.h5", h5gt::File::OpenOrCreate);
+  H5SeisCnt_ptr seisContainer(h5geo::createSeisContainer(
+                                seisFile, h5geo::CreationType::OPEN_OR_CREATE));
+  H5Seis_ptr seis(openSyntheticStack(seisContainer.get(), nIL, nXL, nSamp));
+  if (!seis){
+    state.SkipWithError("Unable to create synthetic data");
+    return;
+  }
+
+  for (auto _ : state){
+    if (!seis->exportToSEGY("bench_export.sgy")){
+      state.SkipWithError("exportToSEGY failed");
+      break;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * nIL * nXL * (240 + nSamp * sizeof(float)));
+  state.counters["traces/s"] = benchmark::Counter(
+        double(state.iterations() * nIL * nXL), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_exportToSEGY)
+->Args({64, 64, 500})->Args({128, 128, 1000})
+->Unit(benchmark::kMillisecond);
@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+#include <h5geo/h5core.h>
+
+#include <Eigen/Dense>
+
+#include <cstdlib>
+
+// Trace header like keys: `n` values with `n/nUnique` duplicates each (random order)
+static Eigen::MatrixXd randomKeys(ptrdiff_t n, ptrdiff_t nUnique){
+  std::srand(0);
+  Eigen::MatrixXd v(n, 1);
+  for (ptrdiff_t i = 0; i < n; i++)
+    v(i) = std::rand() % nUnique;
+  return v;
+}
+
+static void BM_sort(benchmark::State& state){
+  ptrdiff_t n = state.range(0);
+  Eigen::MatrixXd v = randomKeys(n, n);
+  for (auto _ : state){
+    Eigen::VectorX<ptrdiff_t> idx = h5geo::sort(v);
+    benchmark::DoNotOptimize(idx.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// `INLINE-XLINE` pairs
+static void BM_sort_rows(benchmark::State& state){
+  ptrdiff_t n = state.range(0);
+  Eigen::MatrixXd M(n, 2);
+  M.col(0) = randomKeys(n, 1000);
+  M.col(1) = randomKeys(n, n);
+  for (auto _ : state){
+    Eigen::VectorX<ptrdiff_t> idx = h5geo::sort_rows(M);
+    benchmark::DoNotOptimize(idx.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Primary key sort (see H5Seis::addPKeySort())
+static void BM_sort_unique(benchmark::State& state){
+  ptrdiff_t n = state.range(0);
+  Eigen::MatrixXd v = randomKeys(n, 1000);
+  for (auto _ : state){
+    Eigen::VectorXd uvals;
+    Eigen::MatrixX2<ptrdiff_t> uvals_from_size;
+    Eigen::VectorX<ptrdiff_t> idx = h5geo::sort_unique(v, uvals, uvals_from_size);
+    benchmark::DoNotOptimize(idx.data());
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_sort)->Arg(1e4)->Arg(1e6)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_sort_rows)->Arg(1e4)->Arg(1e6)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_sort_unique)->Arg(1e4)->Arg(1e6)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include <h5geo/h5volcontainer.h>
+#include <h5geo/h5vol.h>
+#include <h5geo/h5core.h>
+
+#include <h5gt/H5File.hpp>
+
+#include <algorithm>
+#include <set>
+#include <string>
+
+// Synthetic cube n x n x n (chunks 64^3).
+// It is overwritten once per process (a stale one may be left by a previous run)
+// and reused by the following benchmarks.
+static H5Vol* openSyntheticVol(H5VolContainer* volContainer, size_t n)
+{
+  static std::set<std::string> created;
+  std::string volName = std::to_string(n);
+  if (created.count(volName) > 0)
+    return volContainer->openVol(volName);
+
+  H5VolParam vp;
+  vp.X0 = 0;
+  vp.Y0 = 0;
+  vp.Z0 = 0;
+  vp.dX = 25;
+  vp.dY = 25;
+  vp.dZ = 2;
+  vp.nX = n;
+  vp.nY = n;
+  vp.nZ = n;
+  vp.orientation = 0;
+  vp.domain = h5geo::Domain::TWT;
+  vp.lengthUnits = "meter";
+  vp.temporalUnits = "millisecond";
+  vp.angularUnits = "degree";
+  vp.compression_level = 0;
+  H5Vol* vol = volContainer->createVol(
+        volName, vp, h5geo::CreationType::CREATE_OR_OVERWRITE);
+  if (!vol)
+    return nullptr;
+
+  // Z slice by Z slice
+  for (size_t iZ = 0; iZ < n; iZ += vp.zChunkSize){
+    size_t nZ = std::min<size_t>(vp.zChunkSize, n - iZ);
+    Eigen::MatrixXf data = Eigen::MatrixXf::Random(n*n, nZ);
+    if (!vol->writeData(data, 0, 0, iZ, n, n, nZ)){
+      h5geo::ObjectDeleter()(vol);
+      return nullptr;
+    }
+  }
+  created.insert(volName);
+  return vol;
+}
+
+// Slice through the cube: `axis` 0 - X (inline), 1 - Y (crossline), 2 - Z (time slice)
+static void BM_volSlice(benchmark::State& state){
+  size_t n = state.range(0);
+  int axis = state.range(1);
+
+  h5gt::File volFile("bench_vol_slice.h5", h5gt::File::OpenOrCreate);
+  H5VolCnt_ptr volContainer(h5geo::createVolContainer(
+                              volFile, h5geo::CreationType::OPEN_OR_CREATE));
+  H5Vol_ptr vol(openSyntheticVol(volContainer.get(), n));
+  if (!vol){
+    state.SkipWithError("Unable to create synthetic data");
+    return;
+  }
+
+  size_t nX = axis == 0 ? 1 : n;
+  size_t nY = axis == 1 ? 1 : n;
+  size_t nZ = axis == 2 ? 1 : n;
+  for (auto _ : state){
+    Eigen::MatrixXf data = vol->getData(
+          axis == 0 ? n/2 : 0, axis == 1 ? n/2 : 0, axis == 2 ? n/2 : 0,
+          nX, nY, nZ);
+    benchmark::DoNotOptimize(data.data());
+  }
+  state.SetBytesProcessed(state.iterations() * nX * nY * nZ * sizeof(float));
+}
+
+BENCHMARK(BM_volSlice)
+->ArgsProduct({{128, 256}, {0, 1, 2}})
+->Unit(benchmark::kMillisecond);
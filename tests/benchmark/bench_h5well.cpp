@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+#include <h5geo/h5wellcontainer.h>
+#include <h5geo/h5well.h>
+#include <h5geo/h5logcurve.h>
+#include <h5geo/h5core.h>
+
+#include <h5gt/H5File.hpp>
+
+#include <set>
+#include <string>
+
+// Well container with many small objects: nWell wells each having nLog logs.
+// `fixedLayout` selects paged file space and unchunked (compact) curves
+// against HDF5 defaults and chunked curves.
+// The file is recreated once per process (a stale one may be left by a previous run)
+// and reused by the following benchmarks.
+static std::string createSyntheticWells(
+    size_t nWell, size_t nLog, size_t nSamp, bool fixedLayout)
+{
+  static std::set<std::string> created;
+  std::string fileName =
+      std::string(fixedLayout ? "bench_wells_paged_" : "bench_wells_default_") +
+      std::to_string(nWell) + "_" + std::to_string(nLog) + "_" +
+      std::to_string(nSamp) + ".h5";
+  if (created.count(fileName) > 0)
+    return fileName;
+
+  H5FileCreateParam cp;
+  cp.pagedAggregation = fixedLayout;
+  auto fileOpt = h5geo::createFile(
+        fileName, cp, h5geo::getDefaultFileAccessParam(h5geo::ContainerType::WELL));
+  if (!fileOpt.has_value())
+    return "";
+
+  H5WellCnt_ptr wellContainer(h5geo::createWellContainer(
+                                  fileOpt.value(), h5geo::CreationType::CREATE_OR_OVERWRITE));
+  if (!wellContainer)
+    return "";
+
+  wellContainer->beginBatch();
+  H5WellParam wp;
+  wp.headX = 0;
+  wp.headY = 0;
+  H5LogCurveParam lp;
+  lp.chunkSize = 100;
+  lp.nSamp = fixedLayout ? nSamp : 0;
+  Eigen::VectorXd md = Eigen::VectorXd::LinSpaced(nSamp, 0, nSamp-1);
+  for (size_t i = 0; i < nWell; i++){
+    std::string wellName = "well_" + std::to_string(i);
+    H5Well_ptr well(wellContainer->createWell(
+                      wellName, wp, h5geo::CreationType::CREATE_OR_OVERWRITE));
+    if (!well)
+      return "";
+    for (size_t j = 0; j < nLog; j++){
+      std::string logType = "type_" + std::to_string(j);
+      std::string logName = "log";
+      H5LogCurve_ptr log(well->createLogCurve(
+                           logType, logName, lp, h5geo::CreationType::CREATE_OR_OVERWRITE));
+      if (!log)
+        return "";
+      Eigen::VectorXd val = Eigen::VectorXd::Random(nSamp);
+      log->writeCurve(h5geo::LogDataType::MD, md);
+      log->writeCurve(h5geo::LogDataType::VAL, val);
+    }
+  }
+  wellContainer->endBatch();
+  created.insert(fileName);
+  return fileName;
+}
+
+static void BM_openWellContainer(benchmark::State& state){
+  std::string fileName = createSyntheticWells(
+        state.range(0), state.range(1), state.range(2), state.range(3));
+  if (fileName.empty()){
+    state.SkipWithError("Unable to create synthetic wells");
+    return;
+  }
+
+  for (auto _ : state){
+    H5WellCnt_ptr wellContainer(h5geo::openWellContainerByName(fileName));
+    if (!wellContainer){
+      state.SkipWithError("Unable to open well container");
+      break;
+    }
+    benchmark::DoNotOptimize(wellContainer.get());
+  }
+}
+
+static void BM_listWells(benchmark::State& state){
+  std::string fileName = createSyntheticWells(
+        state.range(0), state.range(1), state.range(2), state.range(3));
+  H5WellCnt_ptr wellContainer(h5geo::openWellContainerByName(fileName));
+  if (!wellContainer){
+    state.SkipWithError("Unable to open synthetic wells");
+    return;
+  }
+
+  for (auto _ : state){
+    auto names = wellContainer->getObjNameList(h5geo::ObjectType::WELL, false);
+    benchmark::DoNotOptimize(names.data());
+  }
+  state.counters["wells/s"] = benchmark::Counter(
+        double(state.iterations() * state.range(0)), benchmark::Counter::kIsRate);
+}
+
+static void BM_readWellLogs(benchmark::State& state){
+  size_t nLog = state.range(1);
+  size_t nSamp = state.range(2);
+  std::string fileName = createSyntheticWells(
+        state.range(0), nLog, nSamp, state.range(3));
+  H5WellCnt_ptr wellContainer(h5geo::openWellContainerByName(fileName));
+  if (!wellContainer){
+    state.SkipWithError("Unable to open synthetic wells");
+    return;
+  }
+
+  H5Well_ptr well(wellContainer->openWell("well_0"));
+  if (!well){
+    state.SkipWithError("Unable to open well");
+    return;
+  }
+
+  for (auto _ : state){
+    for (auto& logGroup : well->getLogCurveGroupList()){
+      H5LogCurve_ptr log(well->openLogCurve(logGroup));
+      if (!log)
+        continue;
+      Eigen::VectorXd val = log->getCurve(h5geo::LogDataType::VAL);
+      benchmark::DoNotOptimize(val.data());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * nLog * nSamp * sizeof(double));
+}
+
+// last arg: 0 - default chunked curves, 1 - paged file space with compact curves
+BENCHMARK(BM_openWellContainer)
+->Args({1000, 10, 1000, 0})->Args({1000, 10, 1000, 1})
+->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_listWells)
+->Args({1000, 10, 1000, 0})->Args({1000, 10, 1000, 1})
+->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_readWellLogs)
+->Args({1000, 10, 1000, 0})->Args({1000, 10, 1000, 1})
+->Args({100, 50, 1000, 0})->Args({100, 50, 1000, 1})
+->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#ifdef H5GEO_USE_GDAL
+#include <gdal_priv.h>
+#endif
+
+int main(int argc, char **argv) {
+  MPI_Init(&argc, &argv);
+  ::testing::InitGoogleTest(&argc, argv);
+
+  // only the first rank prints results
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  if (rank != 0){
+    ::testing::TestEventListeners& listeners =
+        ::testing::UnitTest::GetInstance()->listeners();
+    delete listeners.Release(listeners.default_result_printer());
+  }
+
+  #ifdef H5GEO_USE_GDAL
+  // must be called before reading files to initialize data readers
+  GDALAllRegister();
+  #endif
+  int val = RUN_ALL_TESTS();
+
+  // test fails if it fails on any rank
+  int valAll = 0;
+  MPI_Allreduce(&val, &valAll, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Finalize();
+  return valAll;
+}
@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <h5geo/h5seiscontainer.h>
+#include <h5geo/h5seis.h>
+#include <h5geo/h5volcontainer.h>
+#include <h5geo/h5vol.h>
+#include <h5geo/h5core.h>
+#include <h5geo/private/h5core_mpi.h>
+
+#include <h5gt/H5File.hpp>
+#include <h5gt/H5Group.hpp>
+#include <h5gt/H5DataSet.hpp>
+
+#include <mpi.h>
+
+#include <cstdlib>
+#include <string>
+
+// Every rank runs the same test: files created with `mpiComm` are shared
+// by the ranks (calls are collective) while `serial_<rank>` files are
+// private to the rank and used as a reference
+class H5MPIFixture: public ::testing::Test {
+public:
+
+  virtual void SetUp() override{
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    ap = h5geo::getDefaultFileAccessParam(h5geo::ContainerType::SEISMIC);
+    ap.mpiComm = MPI_COMM_WORLD;
+
+    auto seisFile = h5geo::createFile("mpi_seis.h5", H5FileCreateParam(), ap);
+    ASSERT_TRUE(seisFile.has_value());
+    seisContainer = H5SeisCnt_ptr(h5geo::createSeisContainer(
+          *seisFile, h5geo::CreationType::CREATE_OR_OVERWRITE));
+
+    auto volFile = h5geo::createFile("mpi_vol.h5", H5FileCreateParam(), ap);
+    ASSERT_TRUE(volFile.has_value());
+    volContainer = H5VolCnt_ptr(h5geo::createVolContainer(
+          *volFile, h5geo::CreationType::CREATE_OR_OVERWRITE));
+
+    std::string suffix = std::to_string(rank) + ".h5";
+    h5gt::File serialSeisFile("serial_seis_" + suffix, h5gt::File::OpenOrCreate |
+                              h5gt::File::Overwrite);
+    serialSeisContainer = H5SeisCnt_ptr(h5geo::createSeisContainer(
+          serialSeisFile, h5geo::CreationType::CREATE_OR_OVERWRITE));
+    h5gt::File serialVolFile("serial_vol_" + suffix, h5gt::File::OpenOrCreate |
+                             h5gt::File::Overwrite);
+    serialVolContainer = H5VolCnt_ptr(h5geo::createVolContainer(
+          serialVolFile, h5geo::CreationType::CREATE_OR_OVERWRITE));
+
+    p.domain = h5geo::Domain::OWT;
+    p.lengthUnits = "meter";
+    p.temporalUnits = "millisecond";
+    p.angularUnits = "degree";
+    p.dataUnits = "m/s";
+    p.dataType = h5geo::SeisDataType::STACK;
+    p.surveyType = h5geo::SurveyType::THREE_D;
+    p.nTrc = 1;
+    p.nSamp = 1;
+    p.trcChunk = 16;
+
+    vp.nX = 1;
+    vp.nY = 1;
+    vp.nZ = 1;
+    vp.xChunkSize = 2;
+    vp.yChunkSize = 2;
+    vp.zChunkSize = 64;
+    vp.lengthUnits = "meter";
+    vp.dataUnits = "m/s";
+  }
+
+public:
+  int rank = 0, size = 1;
+  H5FileAccessParam ap;
+  H5SeisCnt_ptr seisContainer, serialSeisContainer;
+  H5VolCnt_ptr volContainer, serialVolContainer;
+  H5SeisParam p;
+  H5VolParam vp;
+};
+
+TEST_F(H5MPIFixture, fileIsShared){
+  ASSERT_TRUE(h5geo::isMPIFile(seisContainer->getH5File()));
+  ASSERT_FALSE(h5geo::isMPIFile(serialSeisContainer->getH5File()));
+
+  h5geo::MPIFileComm comm(seisContainer->getH5File());
+  ASSERT_TRUE(comm.isValid());
+  ASSERT_EQ(comm.getRank(), rank);
+  ASSERT_EQ(comm.getSize(), size);
+  ASSERT_TRUE(comm.all(true));
+  ASSERT_FALSE(comm.all(rank != 0));
+}
+
+TEST_F(H5MPIFixture, readSEGYTracesMMap){
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    "seis", p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr);
+  H5Seis_ptr serialSeis(serialSeisContainer->createSeis(
+                          "seis", p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(serialSeis != nullptr);
+
+  // small buffer: every rank gets several blocks and the last one is partial
+  size_t trcBuffer = 7;
+  ASSERT_TRUE(h5geo::readSEGYTracesMMap(
+                seis.get(), TEST_DATA_DIR"/1.segy",
+                false, 0, 0,
+                static_cast<h5geo::SegyFormat>(0),
+                static_cast<h5geo::Endian>(0),
+                std::vector<std::string>(), trcBuffer));
+  ASSERT_TRUE(h5geo::readSEGYTracesMMap(
+                serialSeis.get(), TEST_DATA_DIR"/1.segy",
+                false, 0, 0,
+                static_cast<h5geo::SegyFormat>(0),
+                static_cast<h5geo::Endian>(0),
+                std::vector<std::string>(), trcBuffer));
+
+  ASSERT_EQ(seis->getNTrc(), serialSeis->getNTrc());
+  ASSERT_EQ(seis->getNSamp(), serialSeis->getNSamp());
+
+  // collective reads of the whole data by every rank
+  Eigen::MatrixXf trace = seis->getTrace(0, seis->getNTrc());
+  Eigen::MatrixXd hdr = seis->getTraceHeader(0, seis->getNTrc());
+  ASSERT_TRUE(trace.isApprox(serialSeis->getTrace(0, serialSeis->getNTrc())));
+  ASSERT_TRUE(hdr.isApprox(serialSeis->getTraceHeader(0, serialSeis->getNTrc())));
+  ASSERT_TRUE(trace.isApprox(h5geo::readSEGYTraces(TEST_DATA_DIR"/1.segy")));
+}
+
+TEST_F(H5MPIFixture, writeReadTracePartitioned){
+  p.nTrc = 45;
+  p.nSamp = 10;
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    "seis", p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr);
+
+  // the same data on every rank
+  std::srand(0);
+  Eigen::MatrixXf traces = Eigen::MatrixXf::Random(p.nSamp, p.nTrc);
+
+  size_t fromTrc, nTrc;
+  h5geo::partitionMPI(p.nTrc, rank, size, fromTrc, nTrc);
+  Eigen::MatrixXf part = traces.middleCols(fromTrc, nTrc);
+  ASSERT_TRUE(seis->writeTrace(part, fromTrc));
+
+  // rank with invalid block fails alone and doesn't block the others
+  Eigen::MatrixXf outOfRange(p.nSamp, rank == 0 ? 1 : 0);
+  ASSERT_EQ(seis->readTrace(outOfRange, p.nTrc), rank != 0);
+
+  Eigen::MatrixXf own(p.nSamp, nTrc);
+  ASSERT_TRUE(seis->readTrace(own, fromTrc));
+  ASSERT_TRUE(own.isApprox(part));
+  ASSERT_TRUE(seis->getTrace(0, p.nTrc).isApprox(traces));
+}
+
+TEST_F(H5MPIFixture, writeReadDataPartitioned){
+  vp.nX = 5;
+  vp.nY = 7;
+  vp.nZ = 9;
+  H5Vol_ptr vol(volContainer->createVol(
+                  "vol", vp, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(vol != nullptr);
+  H5Vol_ptr serialVol(serialVolContainer->createVol(
+                        "vol", vp, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(serialVol != nullptr);
+
+  std::srand(0);
+  Eigen::MatrixXf data = Eigen::MatrixXf::Random(vp.nX*vp.nY, vp.nZ);
+  ASSERT_TRUE(serialVol->writeData(data, 0, 0, 0, vp.nX, vp.nY, vp.nZ));
+
+  // Z slices are split between ranks
+  size_t iZ0, nZ;
+  h5geo::partitionMPI(vp.nZ, rank, size, iZ0, nZ);
+  Eigen::MatrixXf brick = data.middleCols(iZ0, nZ);
+  ASSERT_TRUE(vol->writeData(brick, 0, 0, iZ0, vp.nX, vp.nY, nZ));
+
+  Eigen::MatrixXf own(vp.nX*vp.nY, nZ);
+  ASSERT_TRUE(vol->readData(own, 0, 0, iZ0, vp.nX, vp.nY, nZ));
+  ASSERT_TRUE(own.isApprox(brick));
+
+  Eigen::MatrixXf all = vol->getData(0, 0, 0, vp.nX, vp.nY, vp.nZ);
+  ASSERT_TRUE(all.isApprox(serialVol->getData(0, 0, 0, vp.nX, vp.nY, vp.nZ)));
+}
+
+TEST_F(H5MPIFixture, exportToVol){
+  // 6x6 grid (IL 100:105, XL 20:25) without corner `IL>=104 && XL>=23`
+  p.nTrc = 30;
+  p.nSamp = 10;
+  Eigen::MatrixXd il(p.nTrc, 1), xl(p.nTrc, 1), x(p.nTrc, 1), y(p.nTrc, 1);
+  size_t n = 0;
+  for (size_t i = 0; i < 6; i++){
+    for (size_t j = 0; j < 6; j++){
+      if (i >= 4 && j >= 3)
+        continue;
+      il(n) = 100+i;
+      xl(n) = 20+j;
+      x(n) = 1000+25*j;
+      y(n) = 2000+12.5*i;
+      n++;
+    }
+  }
+
+  std::srand(0);
+  Eigen::MatrixXf traces = Eigen::MatrixXf::Random(p.nSamp, p.nTrc);
+
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    "seis", p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr);
+  H5Seis_ptr serialSeis(serialSeisContainer->createSeis(
+                          "seis", p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(serialSeis != nullptr);
+
+  Eigen::MatrixXd HDR = serialSeis->getTraceHeader(0, p.nTrc);
+  HDR.col(serialSeis->getTraceHeaderIndex("INLINE")) = il;
+  HDR.col(serialSeis->getTraceHeaderIndex("XLINE")) = xl;
+  HDR.col(serialSeis->getTraceHeaderIndex("CDP_X")) = x;
+  HDR.col(serialSeis->getTraceHeaderIndex("CDP_Y")) = y;
+  ASSERT_TRUE(serialSeis->writeTrace(traces, 0));
+  ASSERT_TRUE(serialSeis->writeTraceHeader(HDR, 0));
+
+  // only the first rank writes
+  size_t nTrc = rank == 0 ? p.nTrc : 0;
+  Eigen::MatrixXf tracePart = traces.leftCols(nTrc);
+  Eigen::MatrixXd hdrPart = HDR.topRows(nTrc);
+  ASSERT_TRUE(seis->writeTrace(tracePart, 0));
+  ASSERT_TRUE(seis->writeTraceHeader(hdrPart, 0));
+
+  H5Vol_ptr vol(volContainer->createVol(
+                  "vol", vp, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(vol != nullptr);
+  H5Vol_ptr serialVol(serialVolContainer->createVol(
+                        "vol", vp, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(serialVol != nullptr);
+
+  ASSERT_TRUE(seis->exportToVol(vol.get()));
+  ASSERT_TRUE(serialSeis->exportToVol(serialVol.get()));
+  ASSERT_EQ(vol->getNX(), serialVol->getNX());
+  ASSERT_EQ(vol->getNY(), serialVol->getNY());
+  ASSERT_EQ(vol->getNZ(), serialVol->getNZ());
+
+  Eigen::MatrixXf data = vol->getData(
+        0, 0, 0, vol->getNX(), vol->getNY(), vol->getNZ());
+  Eigen::MatrixXf serialData = serialVol->getData(
+        0, 0, 0, serialVol->getNX(), serialVol->getNY(), serialVol->getNZ());
+  ASSERT_EQ(data.rows(), serialData.rows());
+  ASSERT_EQ(data.cols(), serialData.cols());
+  // empty cells are NaN
+  ASSERT_TRUE((data.array().isNaN() == serialData.array().isNaN()).all());
+  ASSERT_TRUE((data.array() == serialData.array() ||
+               data.array().isNaN()).all());
+}
@@ -1,12 +1,14 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <h5geo/h5core.h>
+#include <h5geo/private/h5profiler.h>
 
 #include <h5gt/H5File.hpp>
 #include <h5gt/H5Group.hpp>
 #include <h5gt/H5DataSet.hpp>
 
 #include <cmath>
+#include <vector>
 #include <filesystem>
 namespace fs = std::filesystem;
 
@@ -223,3 +225,220 @@ TEST_F(H5CoreFixture, interp1MonotonicIncreasing){
   ASSERT_TRUE(std::isnan(ynew(Eigen::last-1)));
   ASSERT_TRUE(std::isnan(ynew(Eigen::last)));
 }
+
+TEST_F(H5CoreFixture, surveyInfoEstimator){
+  // rotated grid: IL 100:2:112, XL 10:3:40, one missing trace
+  ptrdiff_t nil = 7, nxl = 11;
+  double ilSpacing = 25, xlSpacing = 12.5, orientation = 30;
+  double a = orientation*M_PI/180;
+  Eigen::MatrixXd HDR(nil*nxl-1, 4);
+  ptrdiff_t n = 0;
+  for (ptrdiff_t i = 0; i < nil; i++){
+    for (ptrdiff_t j = 0; j < nxl; j++){
+      if (i == 3 && j == 4)
+        continue;
+      double u = j*ilSpacing, v = i*xlSpacing;
+      HDR.row(n) << 100+2*i, 10+3*j,
+          1000 + u*std::cos(a) - v*std::sin(a),
+          2000 + u*std::sin(a) + v*std::cos(a);
+      n++;
+    }
+  }
+
+  // unsorted blocks of headers
+  Eigen::MatrixXd HDR_shuffled = HDR.colwise().reverse();
+  h5geo::SurveyInfoEstimator estimator;
+  estimator.add(HDR_shuffled.col(0).head(30), HDR_shuffled.col(1).head(30),
+                HDR_shuffled.col(2).head(30), HDR_shuffled.col(3).head(30));
+  estimator.add(HDR_shuffled.col(0).tail(n-30), HDR_shuffled.col(1).tail(n-30),
+                HDR_shuffled.col(2).tail(n-30), HDR_shuffled.col(3).tail(n-30));
+
+  h5geo::SurveyInfo info;
+  ASSERT_TRUE(estimator.estimate(info));
+  ASSERT_EQ(info.nIL, size_t(nil));
+  ASSERT_EQ(info.nXL, size_t(nxl));
+  ASSERT_EQ(info.ilStep, 2);
+  ASSERT_EQ(info.xlStep, 3);
+  ASSERT_EQ(info.nTrc, size_t(n));
+  ASSERT_FALSE(info.isRegular());
+  ASSERT_NEAR(info.origin_x, 1000, 1e-6);
+  ASSERT_NEAR(info.origin_y, 2000, 1e-6);
+  ASSERT_NEAR(info.orientation, orientation, 1e-6);
+  ASSERT_NEAR(info.ilSpacing, ilSpacing, 1e-6);
+  ASSERT_NEAR(info.xlSpacing, xlSpacing, 1e-6);
+  ASSERT_FALSE(info.isILReversed);
+  ASSERT_FALSE(info.isXLReversed);
+  ASSERT_FALSE(info.isPlanReversed);
+
+  // traces with broken coordinates don't affect the grid (least median of squares)
+  Eigen::MatrixXd HDR_outliers(n+4, 4);
+  HDR_outliers.topRows(n) = HDR_shuffled;
+  HDR_outliers.bottomRows(4) <<
+      100, 10, 0, 0,
+      104, 22, 1000 + 5000, 2000,
+      106, 25, 1000, 2000 - 300,
+      112, 40, 1000 + 7.3, 2000 + 11.1;
+  h5geo::SurveyInfoEstimator robustEstimator;
+  robustEstimator.add(HDR_outliers.col(0).head(40), HDR_outliers.col(1).head(40),
+                      HDR_outliers.col(2).head(40), HDR_outliers.col(3).head(40));
+  robustEstimator.add(HDR_outliers.col(0).tail(n+4-40), HDR_outliers.col(1).tail(n+4-40),
+                      HDR_outliers.col(2).tail(n+4-40), HDR_outliers.col(3).tail(n+4-40));
+
+  h5geo::SurveyInfo robustInfo;
+  ASSERT_TRUE(robustEstimator.estimate(robustInfo));
+  ASSERT_EQ(robustInfo.nIL, size_t(nil));
+  ASSERT_EQ(robustInfo.nXL, size_t(nxl));
+  ASSERT_EQ(robustInfo.nTrc, size_t(n+4));
+  ASSERT_NEAR(robustInfo.origin_x, 1000, 1e-6);
+  ASSERT_NEAR(robustInfo.origin_y, 2000, 1e-6);
+  ASSERT_NEAR(robustInfo.orientation, orientation, 1e-6);
+  ASSERT_NEAR(robustInfo.ilSpacing, ilSpacing, 1e-6);
+  ASSERT_NEAR(robustInfo.xlSpacing, xlSpacing, 1e-6);
+  ASSERT_NEAR(robustInfo.residual, 0, 1e-6);
+
+  // odd inline number doesn't change the increment nor the limits
+  Eigen::MatrixXd HDR_badIL = HDR_shuffled;
+  HDR_badIL(10, 0) = 105;
+  h5geo::SurveyInfoEstimator badILEstimator;
+  badILEstimator.add(HDR_badIL.col(0), HDR_badIL.col(1),
+                     HDR_badIL.col(2), HDR_badIL.col(3));
+
+  h5geo::SurveyInfo badILInfo;
+  ASSERT_TRUE(badILEstimator.estimate(badILInfo));
+  ASSERT_EQ(badILInfo.ilStep, 2);
+  ASSERT_EQ(badILInfo.xlStep, 3);
+  ASSERT_EQ(badILInfo.ilMin, 100);
+  ASSERT_EQ(badILInfo.ilMax, 112);
+  ASSERT_EQ(badILInfo.nIL, size_t(nil));
+  ASSERT_EQ(badILInfo.nXL, size_t(nxl));
+  ASSERT_NEAR(badILInfo.origin_x, 1000, 1e-6);
+  ASSERT_NEAR(badILInfo.origin_y, 2000, 1e-6);
+  ASSERT_NEAR(badILInfo.orientation, orientation, 1e-6);
+  ASSERT_NEAR(badILInfo.ilSpacing, ilSpacing, 1e-6);
+  ASSERT_NEAR(badILInfo.xlSpacing, xlSpacing, 1e-6);
+  ASSERT_EQ(h5geo::getSurveyCellIndexes(
+              badILInfo, HDR_badIL.col(0).segment(10, 1),
+              HDR_badIL.col(1).segment(10, 1))(0), -1);
+
+  Eigen::VectorX<ptrdiff_t> cells =
+      h5geo::getSurveyCellIndexes(info, HDR.col(0), HDR.col(1));
+  ASSERT_EQ(cells.size(), n);
+  ASSERT_EQ(cells(0), 0);
+  ASSERT_EQ(cells(3*nxl+3), 3*nxl+3);
+  ASSERT_EQ(cells(3*nxl+4), 3*nxl+5);
+  ASSERT_EQ(cells(n-1), nil*nxl-1);
+
+  Eigen::VectorXd il(2), xl(2);
+  il << 101, 100;
+  xl << 10, 43;
+  cells = h5geo::getSurveyCellIndexes(info, il, xl);
+  ASSERT_EQ(cells(0), -1);
+  ASSERT_EQ(cells(1), -1);
+}
+
+TEST_F(H5CoreFixture, calcWindowAttribute){
+  Eigen::VectorXf v(5);
+  v << 1, -4, std::nan("nan"), 2, -999;
+  ASSERT_NEAR(h5geo::calcWindowAttribute(v, h5geo::WindowAttribute::RMS, -999), std::sqrt(21.0/3), 1e-6);
+  ASSERT_NEAR(h5geo::calcWindowAttribute(v, h5geo::WindowAttribute::MEAN, -999), -1.0/3, 1e-6);
+  ASSERT_EQ(h5geo::calcWindowAttribute(v, h5geo::WindowAttribute::MAX, -999), 2);
+  ASSERT_EQ(h5geo::calcWindowAttribute(v, h5geo::WindowAttribute::MIN, -999), -4);
+  ASSERT_EQ(h5geo::calcWindowAttribute(v, h5geo::WindowAttribute::MAX_ABS, -999), 4);
+  ASSERT_EQ(h5geo::calcWindowAttribute(v, h5geo::WindowAttribute::MIN), -999);
+  ASSERT_TRUE(std::isnan(h5geo::calcWindowAttribute(
+                           v.segment(2, 1), h5geo::WindowAttribute::RMS)));
+
+  // 4x3 grid rotated by 90 degrees: X axis goes to North
+  Eigen::VectorXd x(3), y(3);
+  x << 1000, 1000 - 2*12.5 - 4, 1000 + 20;
+  y << 2000, 2000 + 3*25 + 6, 2000;
+  Eigen::VectorX<ptrdiff_t> ind = h5geo::calcGridNodeIndexes(
+        x, y, 1000, 25, 4, 2000, 12.5, 3, M_PI/2);
+  ASSERT_EQ(ind.size(), 3);
+  ASSERT_EQ(ind(0), 0);
+  ASSERT_EQ(ind(1), 2*4+3);
+  ASSERT_EQ(ind(2), -1);
+}
+
+TEST_F(H5CoreFixture, getConversionFactor){
+  h5geo::clearConversionFactors();
+  ASSERT_NEAR(h5geo::getConversionFactor("km", "m"), 1000, 1e-9);
+  ASSERT_NEAR(h5geo::getConversionFactor("ft", "m"), 0.3048, 1e-9);
+  ASSERT_NEAR(h5geo::getConversionFactor("ft", "m"), 0.3048, 1e-9);
+  ASSERT_TRUE(std::isnan(h5geo::getConversionFactor("m", "sec")));
+
+  // concurrent lookups of new and cached pairs
+  std::vector<double> coef(1000);
+#pragma omp parallel for
+  for (ptrdiff_t i = 0; i < ptrdiff_t(coef.size()); i++)
+    coef[i] = h5geo::getConversionFactor(i % 2 ? "ms" : "us", "sec");
+
+  for (size_t i = 0; i < coef.size(); i++)
+    ASSERT_NEAR(coef[i], i % 2 ? 1e-3 : 1e-6, 1e-15);
+}
+
+#ifdef H5GEO_USE_GDAL
+TEST_F(H5CoreFixture, SRContext){
+  h5geo::SRContext ctx;
+  ctx.setSpatialReferenceFromUserInput("EPSG", "32631");
+  ctx.setLengthUnits("meter");
+
+  // copy is independent of the original
+  h5geo::SRContext ctx2(ctx);
+  ctx2.setLengthUnits("km");
+  ASSERT_EQ(ctx.getLengthUnits(), "meter");
+  ASSERT_EQ(ctx2.getLengthUnits(), "km");
+  ASSERT_EQ(ctx2.getAuthName(), "EPSG");
+  ASSERT_EQ(ctx2.getAuthCode(), "32631");
+
+  // concurrent transformations using cached objects
+  std::vector<Eigen::MatrixXd> x(8), y(8);
+  std::vector<int> ok(8);
+#pragma omp parallel for
+  for (ptrdiff_t i = 0; i < 8; i++){
+    x[i] = Eigen::MatrixXd::Constant(100, 1, 400 + i);
+    y[i] = Eigen::MatrixXd::Constant(100, 1, 5000);
+    ok[i] = ctx.transformCoordFrom(x[i], y[i], "km", "EPSG:32631");
+  }
+
+  for (ptrdiff_t i = 0; i < 8; i++){
+    ASSERT_TRUE(ok[i]);
+    ASSERT_TRUE(x[i].isApproxToConstant((400 + i)*1000.0, 1e-9));
+    ASSERT_TRUE(y[i].isApproxToConstant(5000*1000.0, 1e-9));
+  }
+
+  h5geo::clearCoordinateTransformations();
+  ASSERT_TRUE(ctx2.transformCoordTo(x[0], y[0], "meter", "EPSG:32631"));
+  ASSERT_NEAR(x[0](0), 400*1000.0*1000.0, 1e-3);
+  ASSERT_FALSE(ctx.transformCoordFrom(x[0], y[0], "km", "not a crs"));
+}
+#endif
+
+#ifdef H5GEO_USE_PROFILING
+TEST_F(H5CoreFixture, profiler){
+  h5geo::Profiler& prof = h5geo::Profiler::instance();
+  prof.reset();
+  prof.setEnabled(true);
+  prof.setTraceEnabled(true);
+
+  Eigen::VectorXd v = Eigen::VectorXd::LinSpaced(100, 99, 0);
+  h5geo::sort(v);
+  h5geo::sort(v);
+  prof.setEnabled(false);
+  h5geo::sort(v);
+
+  auto stats = prof.snapshot();
+  ASSERT_EQ(stats.count("h5geo::sort"), 1);
+  ASSERT_EQ(stats["h5geo::sort"].calls, 2);
+  ASSERT_EQ(stats["h5geo::sort"].items, 200);
+
+  std::string traceFile = "profiler_trace.json";
+  ASSERT_TRUE(prof.writeChromeTrace(traceFile));
+  ASSERT_GT(std::filesystem::file_size(traceFile), 0);
+  std::filesystem::remove(traceFile);
+
+  prof.setTraceEnabled(false);
+  prof.reset();
+  ASSERT_TRUE(prof.snapshot().empty());
+}
+#endif
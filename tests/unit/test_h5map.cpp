@@ -165,6 +165,57 @@ TEST_F(H5MapFixture, writeAndGetDataFromMap){
   ASSERT_TRUE(m.isApprox(M/1000));
 }
 
+TEST_F(H5MapFixture, writeAndGetFloatCompressedData){
+  H5MapParam pf = p;
+  pf.floatData = true;
+  pf.compression_level = 4;
+  pf.nullValue = -999.25;
+
+  H5Map_ptr map(
+        mapContainer1->createMap(
+          MAP_NAME2, pf, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(map != nullptr);
+
+  // unwritten nodes are filled with `nullValue`
+  Eigen::MatrixXd M = map->getData();
+  ASSERT_EQ(M.size(), p.nX*p.nY);
+  ASSERT_TRUE((M.array() == pf.nullValue).all());
+
+  Eigen::MatrixXd m = Eigen::MatrixXd::Random(p.nX, p.nY);
+  ASSERT_TRUE(map->writeData(m));
+  M = map->getData("mm/sec");
+  ASSERT_TRUE(m.isApprox(M/1000, 1e-6));
+
+  H5MapParam pOut = map->getParam();
+  ASSERT_TRUE(pOut.floatData);
+  ASSERT_EQ(pOut.compression_level, pf.compression_level);
+}
+
+TEST_F(H5MapFixture, writeAndGetDataWindow){
+  // rows along X, cols along Y
+  Eigen::MatrixXd m = Eigen::MatrixXd::Random(p.nX, p.nY);
+
+  H5Map_ptr map(
+        mapContainer1->createMap(
+          MAP_NAME2, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(map != nullptr);
+  ASSERT_TRUE(map->writeData(m));
+
+  Eigen::MatrixXd block = Eigen::MatrixXd::Random(4, 7);
+  ASSERT_TRUE(map->writeData(block, 3, 5, "km/s"));
+  m.block(3, 5, 4, 7) = block*1000;
+  ASSERT_FALSE(map->writeData(block, p.nX-2, 0));
+
+  Eigen::MatrixXd M = map->getData(2, 1, 7, 15, 3);
+  ASSERT_EQ(M.rows(), 3);
+  ASSERT_EQ(M.cols(), 5);
+  for (ptrdiff_t i = 0; i < M.rows(); i++)
+    for (ptrdiff_t j = 0; j < M.cols(); j++)
+      ASSERT_DOUBLE_EQ(M(i,j), m(2+i*3, 1+j*3));
+
+  ASSERT_TRUE(map->getData(8, 0, 3, 1).size() == 0);
+}
+
 TEST_F(H5MapFixture, addAndGetAttribute){
   H5Map_ptr map1(mapContainer1->createMap(MAP_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
   ASSERT_TRUE(map1 != nullptr);
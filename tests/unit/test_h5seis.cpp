@@ -2,13 +2,21 @@
 #include <gmock/gmock.h>
 #include <h5geo/h5seiscontainer.h>
 #include <h5geo/h5seis.h>
+#include <h5geo/h5volcontainer.h>
+#include <h5geo/h5vol.h>
 #include <h5geo/h5horizon.h>
 #include <h5geo/h5core.h>
+#include <h5geo/private/h5ioqueue.h>
 
 #include <h5gt/H5File.hpp>
 #include <h5gt/H5Group.hpp>
 #include <h5gt/H5DataSet.hpp>
 
+#ifdef H5GEO_USE_GDAL
+#include <gdal_priv.h>
+#endif
+
+#include <cmath>
 #include <cstring>
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -328,6 +336,75 @@ TEST_F(H5SeisFixture, writeAndGetTraceHeader){
       << "Read and compare single header (CDP for example)";
 }
 
+TEST_F(H5SeisFixture, readTraceAndTraceHeaderInPlace){
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr);
+
+  Eigen::MatrixXf traces = Eigen::MatrixXf::Random(
+        seis->getNSamp(), seis->getNTrc());
+  Eigen::MatrixXd trcHdr = Eigen::MatrixXi::Random(
+        seis->getNTrc(), seis->getNTrcHdr()).cast<double>();
+  ASSERT_TRUE(seis->writeTrace(traces, 0));
+  ASSERT_TRUE(seis->writeTraceHeader(trcHdr, 0));
+
+  // the same buffer is reused for consecutive blocks
+  Eigen::MatrixXf TRACE(5, 10);
+  Eigen::MatrixXd HDR(10, 3);
+  for (size_t fromTrc = 0; fromTrc + 10 <= seis->getNTrc(); fromTrc += 10){
+    ASSERT_TRUE(seis->readTrace(TRACE, fromTrc, 2));
+    ASSERT_TRUE(TRACE.isApprox(traces.block(2, fromTrc, 5, 10)));
+    ASSERT_TRUE(seis->readTraceHeader(HDR, fromTrc, 4));
+    ASSERT_TRUE(HDR.isApprox(trcHdr.block(fromTrc, 4, 10, 3)));
+  }
+
+  // columns of a bigger matrix are read in place too
+  Eigen::MatrixXd hdr2(seis->getNTrc(), 2);
+  ASSERT_TRUE(seis->readTraceHeader("CDP", hdr2.col(1), 0));
+  ASSERT_TRUE(hdr2.col(1).isApprox(seis->getTraceHeader("CDP", 0, seis->getNTrc())));
+
+  // out of limits
+  ASSERT_FALSE(seis->readTrace(TRACE, seis->getNTrc() - 5));
+  ASSERT_FALSE(seis->readTraceHeader(HDR, 0, seis->getNTrcHdr() - 2));
+  ASSERT_FALSE(seis->readTrace(TRACE, 0, 0, "not_a_unit"));
+}
+
+TEST_F(H5SeisFixture, getTraceAsync){
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr);
+
+  Eigen::MatrixXf traces = Eigen::MatrixXf::Random(
+        seis->getNSamp(), seis->getNTrc());
+  ASSERT_TRUE(seis->writeTrace(traces, 0));
+
+  // keep the I/O thread busy so that requests are coalesced
+  std::promise<void> gate;
+  std::shared_future<void> gateFut = gate.get_future().share();
+  h5geo::IOQueue::instance().post([gateFut](){ gateFut.wait(); });
+
+  std::vector<std::future<Eigen::MatrixXf>> futs;
+  for (size_t fromTrc = 0; fromTrc + 10 <= seis->getNTrc(); fromTrc += 10)
+    futs.push_back(seis->getTraceAsync(fromTrc, 10, 2, 5));
+  auto futAll = seis->getTraceAsync(0, seis->getNTrc());
+  auto futOut = seis->getTraceAsync(seis->getNTrc());
+  gate.set_value();
+
+  for (size_t i = 0; i < futs.size(); i++)
+    ASSERT_TRUE(futs[i].get().isApprox(traces.block(2, i*10, 5, 10)));
+  ASSERT_TRUE(futAll.get().isApprox(traces));
+  ASSERT_EQ(futOut.get().size(), 0);
+
+  // requests not yet processed fail when the object is closed
+  std::promise<void> gate2;
+  std::shared_future<void> gateFut2 = gate2.get_future().share();
+  h5geo::IOQueue::instance().post([gateFut2](){ gateFut2.wait(); });
+  auto futPending = seis->getTraceAsync(0);
+  seis.reset();
+  gate2.set_value();
+  ASSERT_THROW(futPending.get(), std::runtime_error);
+}
+
 TEST_F(H5SeisFixture, writeAndGetSortedData){
   H5Seis_ptr seis(seisContainer->createSeis(
                     SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
@@ -391,6 +468,278 @@ TEST_F(H5SeisFixture, writeAndGetSortedData){
       << "Read and compare single header (CDP for example)";
 }
 
+TEST_F(H5SeisFixture, writeAndGetSortedDataWithCompositeSort){
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr) << "CREATE_OR_OVERWRITE";
+
+  Eigen::MatrixXf traces = Eigen::MatrixXf::Random(
+        seis->getNSamp(), seis->getNTrc());
+
+  ASSERT_TRUE(seis->writeTrace(traces, 0))
+      << "Write all traces at once";
+
+  Eigen::MatrixXd trcHdr = Eigen::MatrixXd::Random(
+        seis->getNTrc(), seis->getNTrcHdr());
+  trcHdr = ((trcHdr.array() + 1)*2.5).round();
+
+  ASSERT_TRUE(seis->writeTraceHeader(trcHdr, 0))
+      << "Write all trace headers at once";
+
+  std::vector<std::string> keyList({"FFID", "CDP", "DSREG"});
+  std::vector<double> minList({1, 1, 2});
+  std::vector<double> maxList({4, 4, 5});
+
+  ASSERT_TRUE(seis->addPKeySort("FFID"));
+
+  Eigen::MatrixXf trc_expected;
+  Eigen::MatrixXd hdr_expected;
+  Eigen::VectorX<size_t> trc_ind_expected = seis->getSortedData(
+        trc_expected, hdr_expected, keyList, minList, maxList, 2);
+
+  ASSERT_FALSE(seis->hasCompositeSort(keyList));
+  ASSERT_TRUE(seis->addCompositeSort(keyList));
+  ASSERT_TRUE(seis->hasCompositeSort(keyList));
+  ASSERT_THAT(seis->getCompositeSortNames(),
+              ::testing::ElementsAre("FFID-CDP-DSREG"));
+
+  Eigen::MatrixXf trc_sorted;
+  Eigen::MatrixXd hdr_sorted;
+  Eigen::VectorX<size_t> trc_ind = seis->getSortedData(
+        trc_sorted, hdr_sorted, keyList, minList, maxList, 2);
+
+  ASSERT_TRUE(trc_ind == trc_ind_expected)
+      << "Composite sort must give the same trace order as PKey sort";
+  ASSERT_TRUE(hdr_sorted.isApprox(hdr_expected));
+  ASSERT_TRUE(trc_sorted.isApprox(trc_expected));
+
+  ASSERT_TRUE(seis->removeCompositeSort(keyList));
+  ASSERT_FALSE(seis->hasCompositeSort(keyList));
+
+  // sort becomes stale when any of its keys is written
+  std::vector<std::string> ilxlList({"INLINE", "XLINE"});
+  ASSERT_TRUE(seis->addCompositeSort(keyList));
+  ASSERT_TRUE(seis->addCompositeSort(ilxlList));
+  Eigen::MatrixXd cdp = trcHdr.col(0);
+  ASSERT_TRUE(seis->writeTraceHeader("CDP", cdp));
+  ASSERT_FALSE(seis->hasCompositeSort(keyList));
+  ASSERT_TRUE(seis->hasCompositeSort(ilxlList));
+  ASSERT_TRUE(seis->setNTrc(seis->getNTrc()+1));
+  ASSERT_FALSE(seis->hasCompositeSort(ilxlList));
+
+  // `-` separates keys within the sort name
+  ASSERT_FALSE(seis->addCompositeSort({"FFID", "CDP-DSREG"}));
+}
+
+TEST_F(H5SeisFixture, exportToVolWithMissingTraces){
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr);
+
+  // 6x6 grid (IL 100:105, XL 20:25) without corner `IL>=104 && XL>=23`
+  Eigen::MatrixXd il(p.nTrc, 1), xl(p.nTrc, 1), x(p.nTrc, 1), y(p.nTrc, 1);
+  size_t n = 0;
+  for (size_t i = 0; i < 6; i++){
+    for (size_t j = 0; j < 6; j++){
+      if (i >= 4 && j >= 3)
+        continue;
+      il(n) = 100+i;
+      xl(n) = 20+j;
+      x(n) = 1000+25*j;
+      y(n) = 2000+12.5*i;
+      n++;
+    }
+  }
+  ASSERT_EQ(n, p.nTrc);
+
+  Eigen::MatrixXf traces = Eigen::MatrixXf::Random(
+        seis->getNSamp(), seis->getNTrc());
+  ASSERT_TRUE(seis->writeTrace(traces, 0));
+  ASSERT_TRUE(seis->writeTraceHeader("INLINE", il));
+  ASSERT_TRUE(seis->writeTraceHeader("XLINE", xl));
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_X", x));
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_Y", y));
+
+  h5geo::SurveyInfo info;
+  ASSERT_TRUE(seis->calcSurveyInfo(info));
+  ASSERT_EQ(info.nIL, 6);
+  ASSERT_EQ(info.nXL, 6);
+  ASSERT_FALSE(info.isRegular());
+
+  h5gt::File volFile("seis_vol.h5", h5gt::File::OpenOrCreate |
+                     h5gt::File::Overwrite);
+  H5VolCnt_ptr volContainer(h5geo::createVolContainer(
+                              volFile, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(volContainer != nullptr);
+
+  H5VolParam vp;
+  vp.nX = 1;
+  vp.nY = 1;
+  vp.nZ = 1;
+  vp.xChunkSize = 2;
+  vp.yChunkSize = 2;
+  vp.zChunkSize = 64;
+  H5Vol_ptr vol(volContainer->createVol(
+                  "vol", vp, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(vol != nullptr);
+
+  ASSERT_TRUE(seis->exportToVol(vol.get()));
+  ASSERT_EQ(vol->getNX(), 6);
+  ASSERT_EQ(vol->getNY(), 6);
+  ASSERT_EQ(vol->getNZ(), seis->getNSamp());
+
+  Eigen::MatrixXf data = vol->getData(0, 0, 0, 6, 6, vol->getNZ());
+  n = 0;
+  for (size_t i = 0; i < 6; i++){
+    for (size_t j = 0; j < 6; j++){
+      if (i >= 4 && j >= 3){
+        ASSERT_TRUE(data.row(i*6+j).array().isNaN().all());
+        continue;
+      }
+      ASSERT_TRUE(data.row(i*6+j).transpose().isApprox(traces.col(n)));
+      n++;
+    }
+  }
+
+  // chunk `X:4-5, Y:4-5` has no traces and must not be allocated
+  hsize_t nChunks = 0;
+  ASSERT_TRUE(H5Dget_num_chunks(vol->getVolD()->getId(), H5S_ALL, &nChunks) >= 0);
+  ASSERT_EQ(nChunks, 8);
+}
+
+TEST_F(H5SeisFixture, calcWindowAttribute){
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr);
+
+  // 5x6 grid (IL 100:104, XL 20:25)
+  Eigen::MatrixXd il(p.nTrc, 1), xl(p.nTrc, 1), x(p.nTrc, 1), y(p.nTrc, 1);
+  for (size_t i = 0; i < 5; i++){
+    for (size_t j = 0; j < 6; j++){
+      il(i*6+j) = 100+i;
+      xl(i*6+j) = 20+j;
+      x(i*6+j) = 1000+25*j;
+      y(i*6+j) = 2000+12.5*i;
+    }
+  }
+
+  Eigen::MatrixXf traces = Eigen::MatrixXf::Random(
+        seis->getNSamp(), seis->getNTrc());
+  ASSERT_TRUE(seis->writeTrace(traces, 0));
+  ASSERT_TRUE(seis->writeTraceHeader("INLINE", il));
+  ASSERT_TRUE(seis->writeTraceHeader("XLINE", xl));
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_X", x));
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_Y", y));
+  ASSERT_TRUE(seis->setSampRate(2));
+  ASSERT_TRUE(seis->setFirstSample(0));
+
+  // points are shifted from the traces, the last one is outside the survey
+  Eigen::VectorXd px(p.nTrc+1), py(p.nTrc+1), pz(p.nTrc+1);
+  px.head(p.nTrc) = x.col(0).array() + 5;
+  py.head(p.nTrc) = y.col(0).array() - 3;
+  pz.head(p.nTrc).setConstant(6);
+  px(p.nTrc) = 0;
+  py(p.nTrc) = 0;
+  pz(p.nTrc) = 6;
+
+  // window [4, 10] ms includes samples 2..5
+  Eigen::VectorXd rms = seis->calcWindowAttribute(
+        px, py, pz, 2, 4, h5geo::WindowAttribute::RMS);
+  ASSERT_EQ(rms.size(), p.nTrc+1);
+  for (size_t i = 0; i < p.nTrc; i++)
+    ASSERT_NEAR(rms(i), std::sqrt(traces.col(i).segment(2, 4).squaredNorm() / 4), 1e-6);
+  ASSERT_TRUE(std::isnan(rms(p.nTrc)));
+
+  Eigen::VectorXd maxAmp = seis->calcWindowAttribute(
+        px, py, pz, 2, 4, h5geo::WindowAttribute::MAX);
+  for (size_t i = 0; i < p.nTrc; i++)
+    ASSERT_NEAR(maxAmp(i), traces.col(i).segment(2, 4).maxCoeff(), 1e-6);
+
+  H5HorizonParam p_hrz;
+  p_hrz.components["X"] = 0;
+  p_hrz.components["Y"] = 1;
+  p_hrz.components["Z"] = 2;
+  p_hrz.nPoints = p.nTrc+1;
+  p_hrz.pointsChunkSize = 10;
+  p_hrz.domain = p.domain;
+  p_hrz.lengthUnits = p.lengthUnits;
+  p_hrz.temporalUnits = p.temporalUnits;
+
+  std::string hrzName = "hrz";
+  H5Horizon_ptr hrz(seis->createHorizon(
+                      hrzName, p_hrz, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(hrz != nullptr);
+  ASSERT_TRUE(hrz->writeComponent("X", px));
+  ASSERT_TRUE(hrz->writeComponent("Y", py));
+  ASSERT_TRUE(hrz->writeComponent("Z", pz));
+
+  ASSERT_TRUE(seis->calcHorizonWindowAttribute(
+                hrz.get(), "RMS", 2, 4, h5geo::WindowAttribute::RMS));
+  ASSERT_EQ(hrz->getNComponents(), 4);
+  Eigen::VectorXd hrzRms = hrz->getComponent("RMS");
+  ASSERT_TRUE(hrzRms.head(p.nTrc).isApprox(rms.head(p.nTrc)));
+  ASSERT_TRUE(hrz->getComponent("Z").isApprox(pz));
+}
+
+TEST_F(H5SeisFixture, extractAlongTrajectory){
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr);
+
+  // 5x6 grid (IL 100:104, XL 20:25)
+  Eigen::MatrixXd il(p.nTrc, 1), xl(p.nTrc, 1), x(p.nTrc, 1), y(p.nTrc, 1);
+  for (size_t i = 0; i < 5; i++){
+    for (size_t j = 0; j < 6; j++){
+      il(i*6+j) = 100+i;
+      xl(i*6+j) = 20+j;
+      x(i*6+j) = 1000+25*j;
+      y(i*6+j) = 2000+12.5*i;
+    }
+  }
+
+  // amplitude is linear along the trace: interpolation is exact
+  Eigen::MatrixXf traces(seis->getNSamp(), seis->getNTrc());
+  for (size_t j = 0; j < seis->getNTrc(); j++)
+    for (size_t i = 0; i < seis->getNSamp(); i++)
+      traces(i, j) = 100*j + i;
+
+  ASSERT_TRUE(seis->writeTrace(traces, 0));
+  ASSERT_TRUE(seis->writeTraceHeader("INLINE", il));
+  ASSERT_TRUE(seis->writeTraceHeader("XLINE", xl));
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_X", x));
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_Y", y));
+  ASSERT_TRUE(seis->setSampRate(2));
+  ASSERT_TRUE(seis->setFirstSample(0));
+
+  // vertical well next to trace 7
+  Eigen::MatrixXd M(2, 6);
+  M << 0, 1027, 2011, 0, 0, 0,
+      2000, 1027, 2011, 2000, 0, 0;
+  h5geo::Trajectory traj(M);
+
+  // `OWT = TVDSS/100`, samples 0, 0.75, 2.75, 5, 9, 9.5 (outside)
+  h5geo::TimeDepthCurve tdCurve;
+  tdCurve.velocity = 100;
+  Eigen::VectorXd md(6);
+  md << 0, 150, 550, 1000, 1800, 1900;
+
+  Eigen::VectorXd amp = seis->extractAlongTrajectory(traj, md, tdCurve);
+  ASSERT_EQ(amp.size(), md.size());
+  Eigen::VectorXd expected(5);
+  expected << 700, 700.75, 702.75, 705, 709;
+  ASSERT_TRUE(amp.head(5).isApprox(expected));
+  ASSERT_TRUE(std::isnan(amp(5)));
+
+  // the same in meters and seconds
+  tdCurve.velocity = 100;
+  Eigen::VectorXd ampSI = seis->extractAlongTrajectory(
+        h5geo::Trajectory(M/1000), md/1000, tdCurve, "meter", "second");
+  ASSERT_TRUE(ampSI.head(5).isApprox(expected));
+
+  // without time-depth curve time can't be calculated
+  ASSERT_TRUE(seis->extractAlongTrajectory(traj, md).array().isNaN().all());
+}
+
 TEST_F(H5SeisFixture, boundary){
   H5Seis_ptr seis(seisContainer->createSeis(
                     SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
@@ -442,6 +791,55 @@ TEST_F(H5SeisFixture, boundary){
   ASSERT_TRUE(boundary.col(1).isApprox(Y));
 }
 
+TEST_F(H5SeisFixture, updateBoundary){
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr);
+
+  // L-shaped survey: traces out of the L are moved to its bottom
+  Eigen::MatrixX2d xy(p.nTrc, 2);
+  for (size_t k = 0; k < p.nTrc; k++){
+    size_t i = k / 6, j = k % 6;
+    xy(k, 0) = j*10;
+    xy(k, 1) = i >= 2 && j >= 2 ? 0 : i*10;
+  }
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_X", xy.col(0)));
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_Y", xy.col(1)));
+
+  auto area = [](const Eigen::MatrixXd& b){
+    double a = 0;
+    for (ptrdiff_t i = 0; i+1 < b.rows(); i++)
+      a += b(i,0)*b(i+1,1) - b(i+1,0)*b(i,1);
+    return std::fabs(a/2);
+  };
+
+  // streaming by small blocks gives the same hull
+  ASSERT_FALSE(seis->getBoundaryD().has_value());
+  ASSERT_TRUE(seis->updateBoundary(h5geo::BoundaryType::CONVEX, 0, 7));
+  ASSERT_TRUE(seis->getBoundaryD().has_value());
+  Eigen::MatrixXd convex = seis->calcBoundary();
+  ASSERT_TRUE(convex.isApprox(Eigen::MatrixXd(h5geo::quickHull2D(xy))));
+  ASSERT_NEAR(area(convex), 1400, 1e-6);
+
+  ASSERT_TRUE(seis->updateBoundary(h5geo::BoundaryType::CONCAVE, 10, 7));
+  Eigen::MatrixXd concave = seis->calcBoundary();
+  ASSERT_TRUE(concave.rows() > convex.rows());
+  ASSERT_TRUE(concave.row(0).isApprox(concave.row(concave.rows()-1)));
+  ASSERT_NEAR(area(concave), 850, 1e-6);
+
+  // changing coordinates removes saved boundary
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_X", xy.col(0)));
+  ASSERT_FALSE(seis->getBoundaryD().has_value());
+
+  // `calcBoundary` doesn't write anything
+  ASSERT_TRUE(seis->calcBoundary().isApprox(convex));
+  ASSERT_FALSE(seis->getBoundaryD().has_value());
+  ASSERT_TRUE(seis->updateBoundary());
+  ASSERT_TRUE(seis->getBoundaryD().has_value());
+  ASSERT_TRUE(seis->removeBoundary());
+  ASSERT_FALSE(seis->getBoundaryD().has_value());
+}
+
 TEST_F(H5SeisFixture, generateGeometry){
   H5Seis_ptr seis(seisContainer->createSeis(
                     SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
@@ -534,6 +932,14 @@ TEST_F(H5SeisFixture, SEGY){
                 false, nSamp, nTrc, format, endian)); // for testing purpose I need to set value not less than 24 trc (10000) as OMP may save traces in different order
   Eigen::VectorXf trace22 = seis2->getTrace(trcInd);
   ASSERT_TRUE(trace.isApprox(trace22));
+  // blocks finished by threads in any order are still written in place
+  ASSERT_TRUE(h5geo::readSEGYTracesMMap(
+                seis2.get(),
+                TEST_DATA_DIR"/1.segy",
+                false, nSamp, nTrc, format, endian,
+                std::vector<std::string>(), 5));
+  ASSERT_TRUE(seis2->getTrace(0, nTrc).isApprox(
+                h5geo::readSEGYTraces(TEST_DATA_DIR"/1.segy")));
 
   // NOT MAPPED (read with H5Seis::methods)
   H5Seis_ptr seis3(seisContainer->createSeis(
@@ -731,3 +1137,59 @@ TEST_F(H5SeisFixture, DISABLED_READ_ARBITRARY_TRACES){
   get_time_slice_and_show_elapsed_time(seis.get(), 0, 100000, 0, 1);
   get_time_slice_and_show_elapsed_time(seis.get(), 0, 1000000, 0, 1);
 }
+
+#ifdef H5GEO_USE_GDAL
+TEST_F(H5SeisFixture, reprojectXYTraceHeaders){
+  p.spatialReference = "EPSG:32631";
+  H5Seis_ptr seis(seisContainer->createSeis(
+                    SEIS_NAME1, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(seis != nullptr);
+
+  // UTM coordinates in millimeters
+  Eigen::MatrixX2d xy(p.nTrc, 2);
+  for (size_t i = 0; i < p.nTrc; i++){
+    xy(i, 0) = (500000 + 100*i)*1000.0;
+    xy(i, 1) = (5000000 + 50*i)*1000.0;
+  }
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_X", xy.col(0)));
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_Y", xy.col(1)));
+  ASSERT_TRUE(seis->writeTraceHeader("SRCX", xy.col(0)));
+  ASSERT_TRUE(seis->writeTraceHeader("SRCY", xy.col(1)));
+  ASSERT_TRUE(seis->writeTraceHeader("GRPX", xy.col(0)));
+  ASSERT_TRUE(seis->writeTraceHeader("GRPY", xy.col(1)));
+
+  Eigen::MatrixXd expected = xy;
+  OGRCT_ptr coordTrans(h5geo::createCoordinateTransformation(
+                         "EPSG:32631", "millimeter", "EPSG:32632", "millimeter"));
+  ASSERT_TRUE(coordTrans != nullptr);
+  coordTrans->Transform(expected.rows(), expected.col(0).data(), expected.col(1).data());
+
+  // blocks of 7 traces: the last block is incomplete
+  ASSERT_TRUE(seis->reprojectXYTraceHeaders(
+                "EPSG:32632", {{"CDP_X", "CDP_Y"}, {"SRCX", "SRCY"}, {"GRPX", "GRPY"}}, 7));
+  ASSERT_EQ(seis->getSpatialReference(), "EPSG:32632");
+  ASSERT_TRUE(seis->getXYTraceHeaders({"CDP_X", "CDP_Y"}).isApprox(expected));
+  ASSERT_TRUE(seis->getXYTraceHeaders({"SRCX", "SRCY"}).isApprox(expected));
+  ASSERT_TRUE(seis->getXYTraceHeaders({"GRPX", "GRPY"}).isApprox(expected));
+
+  // only some pairs: headers are reprojected but seis CRS is kept
+  Eigen::VectorXd srcx = seis->getTraceHeader("SRCX");
+  ASSERT_TRUE(seis->reprojectXYTraceHeaders(
+                "EPSG:32631", {{"CDP_X", "CDP_Y"}}, 4));
+  ASSERT_TRUE(seis->getXYTraceHeaders({"CDP_X", "CDP_Y"}).isApprox(xy, 1e-10));
+  ASSERT_TRUE(seis->getTraceHeader("SRCX").isApprox(srcx));
+  ASSERT_EQ(seis->getSpatialReference(), "EPSG:32632");
+
+  // failed points aren't written back and CRS isn't changed
+  Eigen::VectorXd cdpx = seis->getTraceHeader("CDP_X");
+  Eigen::VectorXd bad = cdpx;
+  bad(0) = HUGE_VAL;
+  ASSERT_TRUE(seis->writeTraceHeader("CDP_X", bad));
+  ASSERT_FALSE(seis->reprojectXYTraceHeaders(
+                 "EPSG:32631", {{"CDP_X", "CDP_Y"}, {"SRCX", "SRCY"}, {"GRPX", "GRPY"}}, 100));
+  ASSERT_EQ(seis->getSpatialReference(), "EPSG:32632");
+  ASSERT_TRUE(seis->getTraceHeader("SRCX").isApprox(srcx));
+
+  ASSERT_FALSE(seis->reprojectXYTraceHeaders("EPSG:32632", {{"CDP_X", "NOT_A_HEADER"}}));
+}
+#endif
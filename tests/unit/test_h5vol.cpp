@@ -5,6 +5,7 @@
 #include <h5geo/h5seis.h>
 #include <h5geo/h5well.h>
 #include <h5geo/h5vol.h>
+#include <h5geo/private/h5ioqueue.h>
 
 #include <h5gt/H5File.hpp>
 #include <h5gt/H5Group.hpp>
@@ -173,6 +174,145 @@ TEST_F(H5VolFixture, writeAndGetDataFromVol){
 
   Eigen::MatrixXf M = vol->getData(0,0,0,p.nX,p.nY,p.nZ,"mm/sec");
   ASSERT_TRUE(m.isApprox(M/1000));
+
+  // preallocated buffer is filled in place
+  Eigen::MatrixXf buf(p.nX*p.nY, p.nZ);
+  float* ptr = buf.data();
+  ASSERT_TRUE(vol->readData(buf,0,0,0,p.nX,p.nY,p.nZ,"mm/sec"));
+  ASSERT_EQ(buf.data(), ptr);
+  ASSERT_TRUE(buf.isApprox(M));
+  ASSERT_FALSE(vol->readData(buf,0,0,0,p.nX,p.nY,p.nZ+1));
+}
+
+TEST_F(H5VolFixture, writeDataWithUnits){
+  Eigen::MatrixXf m = Eigen::MatrixXf::Random(p.nX, p.nY*p.nZ);
+  Eigen::MatrixXf m_copy = m;
+
+  H5Vol_ptr vol(
+        volContainer1->createVol(
+          VOL_NAME2, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(vol != nullptr);
+  ASSERT_TRUE(vol->writeData(m,0,0,0,p.nX,p.nY,p.nZ,"mm/sec"));
+  // user's data isn't scaled
+  ASSERT_TRUE(m == m_copy);
+
+  Eigen::MatrixXf M = vol->getData(0,0,0,p.nX,p.nY,p.nZ);
+  ASSERT_TRUE(M.isApprox(m/1000));
+  M = vol->getData(0,0,0,p.nX,p.nY,p.nZ,"mm/sec");
+  ASSERT_TRUE(M.isApprox(m));
+}
+
+TEST_F(H5VolFixture, getDataAsync){
+  Eigen::MatrixXf m = Eigen::MatrixXf::Random(p.nX*p.nY, p.nZ);
+
+  H5Vol_ptr vol(
+        volContainer1->createVol(
+          VOL_NAME2, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(vol != nullptr);
+  ASSERT_TRUE(vol->writeData(m,0,0,0,p.nX,p.nY,p.nZ));
+
+  // keep the I/O thread busy so that requests are coalesced
+  std::promise<void> gate;
+  std::shared_future<void> gateFut = gate.get_future().share();
+  h5geo::IOQueue::instance().post([gateFut](){ gateFut.wait(); });
+
+  // bricks covering `Z` range are read together while the brick
+  // touching them but crossing the volume end gets nothing
+  std::vector<std::future<Eigen::MatrixXf>> futs;
+  for (size_t iZ = 0; iZ < p.nZ; iZ++)
+    futs.push_back(vol->getDataAsync(0,0,iZ,p.nX,p.nY,1));
+  auto futOut = vol->getDataAsync(0,0,p.nZ-1,p.nX,p.nY,2);
+  gate.set_value();
+
+  for (size_t iZ = 0; iZ < p.nZ; iZ++){
+    Eigen::MatrixXf brick = futs[iZ].get();
+    ASSERT_EQ(brick.rows(), m.rows());
+    ASSERT_EQ(brick.cols(), 1);
+    ASSERT_TRUE(brick.isApprox(m.col(iZ)));
+  }
+  ASSERT_EQ(futOut.get().size(), 0);
+}
+
+TEST_F(H5VolFixture, chunkCache){
+  Eigen::MatrixXf m = Eigen::MatrixXf::Random(p.nX, p.nY*p.nZ);
+
+  // cache settings actually used by the opened dataset
+  auto readCache = [](const h5gt::DataSet& dset){
+    H5ChunkCacheParam cacheP;
+    hid_t dapl = H5Dget_access_plist(dset.getId());
+    H5Pget_chunk_cache(dapl, &cacheP.nSlots, &cacheP.nBytes, &cacheP.w0);
+    H5Pclose(dapl);
+    return cacheP;
+  };
+
+  H5Vol_ptr vol(
+        volContainer1->createVol(
+          VOL_NAME2, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(vol != nullptr);
+  ASSERT_TRUE(vol->writeData(m,0,0,0,p.nX,p.nY,p.nZ));
+
+  // the only chunk must fit the cache
+  auto dsetOpt = vol->getVolD();
+  ASSERT_TRUE(dsetOpt.has_value());
+  H5ChunkCacheParam cacheP = h5geo::getAutoChunkCacheParam(dsetOpt.value());
+  ASSERT_EQ(cacheP.nBytes, p.xChunkSize*p.yChunkSize*p.zChunkSize*sizeof(float));
+  ASSERT_GE(cacheP.nSlots, 521);
+
+  vol->setChunkCache(H5ChunkCacheParam());
+  ASSERT_EQ(readCache(vol->getVolD().value()).nBytes, cacheP.nBytes);
+  ASSERT_TRUE(m.isApprox(vol->getData(0,0,0,p.nX,p.nY,p.nZ)));
+  vol->resetChunkCache();
+  ASSERT_TRUE(m.isApprox(vol->getData(0,0,0,p.nX,p.nY,p.nZ)));
+
+  // layer of bricks orthogonal to `Z` is 2x2 chunks
+  H5VolParam pChunked = p;
+  pChunked.xChunkSize = 2;
+  pChunked.yChunkSize = 2;
+  pChunked.zChunkSize = 2;
+  size_t chunkBytes = 2*2*2*sizeof(float);
+  vol = H5Vol_ptr(
+        volContainer1->createVol(
+          VOL_NAME2, pChunked, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(vol != nullptr);
+  ASSERT_TRUE(vol->writeData(m,0,0,0,p.nX,p.nY,p.nZ));
+
+  dsetOpt = vol->getVolD();
+  ASSERT_TRUE(dsetOpt.has_value());
+  cacheP = h5geo::getAutoChunkCacheParam(dsetOpt.value());
+  ASSERT_EQ(cacheP.nBytes, 4*chunkBytes);
+  ASSERT_EQ(h5geo::getAutoChunkCacheParam(dsetOpt.value(), 3*chunkBytes).nBytes, 3*chunkBytes);
+  ASSERT_EQ(h5geo::getAutoChunkCacheParam(dsetOpt.value(), 1).nBytes, chunkBytes);
+
+  vol->setChunkCache(H5ChunkCacheParam());
+  H5ChunkCacheParam usedP = readCache(vol->getVolD().value());
+  ASSERT_EQ(usedP.nBytes, cacheP.nBytes);
+  ASSERT_EQ(usedP.nSlots, cacheP.nSlots);
+  ASSERT_TRUE(m.isApprox(vol->getData(0,0,0,p.nX,p.nY,p.nZ)));
+
+  // user defined size is kept, only slots are picked
+  H5ChunkCacheParam userP;
+  userP.nBytes = 64*chunkBytes;
+  vol->setChunkCache(userP);
+  usedP = readCache(vol->getVolD().value());
+  ASSERT_EQ(usedP.nBytes, userP.nBytes);
+  ASSERT_EQ(usedP.nSlots, h5geo::getAutoChunkCacheSlots(dsetOpt.value(), userP.nBytes));
+  ASSERT_GT(usedP.nSlots, cacheP.nSlots);
+
+  userP.nSlots = 1009;
+  userP.w0 = 0.5;
+  vol->setChunkCache(userP);
+  usedP = readCache(vol->getVolD().value());
+  ASSERT_EQ(usedP.nBytes, userP.nBytes);
+  ASSERT_EQ(usedP.nSlots, userP.nSlots);
+  ASSERT_DOUBLE_EQ(usedP.w0, userP.w0);
+  ASSERT_TRUE(m.isApprox(vol->getData(0,0,0,p.nX,p.nY,p.nZ)));
+  vol->resetChunkCache();
+
+  H5FileAccessParam accessP =
+      h5geo::getDefaultFileAccessParam(h5geo::ContainerType::VOLUME);
+  ASSERT_GE(accessP.chunkCache.nBytes, cacheP.nBytes);
+  auto fileOpt = h5geo::openFile(FILE_NAME1, accessP);
+  ASSERT_TRUE(fileOpt.has_value());
 }
 
 // prefix `DISABLED_` is to skip test
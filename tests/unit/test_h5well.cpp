@@ -8,6 +8,7 @@
 #include <h5geo/h5welltops.h>
 #include <h5geo/private/h5deviation.h>
 #include <h5geo/h5core.h>
+#include <h5geo/private/h5enum_string.h>
 
 #include <h5gt/H5File.hpp>
 #include <h5gt/H5Group.hpp>
@@ -180,6 +181,128 @@ TEST_F(H5WellFixture, openWellByUWI){
   ASSERT_TRUE(wellByUwi2 != nullptr);
 }
 
+TEST_F(H5WellFixture, objectCatalog){
+  H5WellParam p = wellParam;
+  std::string wellNameA = "catalog/well_a";
+  std::string wellNameB = "catalog/well_b";
+  p.uwi = "catalog_uwi_a";
+  H5Well_ptr wellA(
+        wellContainer->createWell(
+          wellNameA, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(wellA != nullptr);
+  p.uwi = "catalog_uwi_b";
+  H5Well_ptr wellB(
+        wellContainer->createWell(
+          wellNameB, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(wellB != nullptr);
+  H5LogCurve_ptr logCurve(
+        wellA->createLogCurve(
+          LOG_TYPE, LOG_NAME,
+          logCurveParam, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(logCurve != nullptr);
+
+  h5gt::File file = wellContainer->getH5File();
+  ASSERT_TRUE(h5geo::hasCatalog(file));
+  ASSERT_THAT(wellContainer->getObjNameList(h5geo::ObjectType::WELL, true),
+              ::testing::IsSupersetOf({wellNameA, wellNameB}));
+
+  H5Well_ptr wellByUwi(wellContainer->openWellByUWI("catalog_uwi_b"));
+  ASSERT_TRUE(wellByUwi != nullptr);
+  ASSERT_TRUE(*wellByUwi == *wellB);
+  ASSERT_TRUE(wellB->setUWI("catalog_uwi_c"));
+  wellByUwi.reset(wellContainer->openWellByUWI("catalog_uwi_c"));
+  ASSERT_TRUE(wellByUwi != nullptr);
+
+  // overwritten objects are only marked removed: the catalog is
+  // compacted before removed entries outnumber the others
+  size_t nWell = wellContainer->getObjCount(h5geo::ObjectType::WELL, true);
+  size_t nLog = wellContainer->getObjCount(h5geo::ObjectType::LOGCURVE, true);
+  size_t nCatalog = h5geo::readCatalog(file).value().size();
+  for (size_t i = 0; i < 20; i++){
+    p.uwi = "catalog_uwi_b";
+    wellB.reset(wellContainer->createWell(
+                  wellNameB, p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+    ASSERT_TRUE(wellB != nullptr);
+  }
+  ASSERT_EQ(h5geo::readCatalog(file).value().size(), nCatalog);
+  h5gt::DataSet catalogPathD = file.getGroup(std::string{h5geo::detail::catalog}).
+      getDataSet(std::string{h5geo::detail::catalog_path});
+  ASSERT_LE(catalogPathD.getElementCount(), 2*nCatalog+1);
+  ASSERT_EQ(wellContainer->getObjCount(h5geo::ObjectType::WELL, true), nWell);
+
+  // older files don't have catalog: listing traverses the file
+  // without writing anything until the catalog is rebuilt
+  file.unlink(std::string{h5geo::detail::catalog});
+  ASSERT_FALSE(h5geo::hasCatalog(file));
+  ASSERT_FALSE(h5geo::readCatalog(file).has_value());
+  ASSERT_EQ(wellContainer->getObjCount(h5geo::ObjectType::WELL, true), nWell);
+  ASSERT_FALSE(h5geo::hasCatalog(file));
+  ASSERT_TRUE(wellContainer->rebuildCatalog());
+  ASSERT_TRUE(h5geo::hasCatalog(file));
+  ASSERT_EQ(wellContainer->getObjCount(h5geo::ObjectType::LOGCURVE, true), nLog);
+
+  // the file may be modified by other tools
+  file.unlink(wellNameB);
+  ASSERT_EQ(wellContainer->getObjCount(h5geo::ObjectType::WELL, true), nWell-1);
+  ASSERT_THAT(wellContainer->getObjNameList(h5geo::ObjectType::WELL, true),
+              ::testing::Not(::testing::Contains(wellNameB)));
+  ASSERT_TRUE(wellContainer->rebuildCatalog());
+  nWell--;
+
+  ASSERT_TRUE(wellContainer->removeObject(wellNameA));
+  ASSERT_EQ(wellContainer->getObjCount(h5geo::ObjectType::WELL, true), nWell-1);
+  ASSERT_EQ(wellContainer->getObjCount(h5geo::ObjectType::LOGCURVE, true), nLog-1);
+  wellByUwi.reset(wellContainer->openWellByUWI("catalog_uwi_a"));
+  ASSERT_TRUE(wellByUwi == nullptr);
+}
+
+TEST_F(H5WellFixture, getLogCurvesOfManyWells){
+  std::vector<std::string> wellNames;
+  for (size_t i = 0; i < 5; i++){
+    std::string wellName = "bulk/well_" + std::to_string(i);
+    H5Well_ptr well(
+          wellContainer->createWell(
+            wellName, wellParam, h5geo::CreationType::CREATE_OR_OVERWRITE));
+    ASSERT_TRUE(well != nullptr);
+    wellNames.push_back(wellName);
+
+    // the last well has no log
+    if (i == 4)
+      continue;
+
+    H5LogCurve_ptr logCurve(
+          well->createLogCurve(
+            LOG_TYPE, LOG_NAME,
+            logCurveParam, h5geo::CreationType::CREATE_OR_OVERWRITE));
+    ASSERT_TRUE(logCurve != nullptr);
+    Eigen::VectorXd md = LOG_MD_GR.col(0).head(100*(i+1));
+    Eigen::VectorXd val = LOG_MD_GR.col(1).head(100*(i+1));
+    ASSERT_TRUE(logCurve->writeCurve(h5geo::LogDataType::MD, md));
+    ASSERT_TRUE(logCurve->writeCurve(h5geo::LogDataType::VAL, val));
+  }
+
+  H5WellLogs logs = wellContainer->getLogCurves(
+        LOG_TYPE, LOG_NAME, wellNames, "m");
+  ASSERT_EQ(logs.getNWells(), 4);
+  ASSERT_EQ(logs.offsets.size(), 5);
+  ASSERT_EQ(logs.md.size(), 100+200+300+400);
+  ASSERT_EQ(logs.val.size(), logs.md.size());
+  for (size_t i = 0; i < logs.getNWells(); i++){
+    ptrdiff_t n = logs.offsets(i+1) - logs.offsets(i);
+    ASSERT_EQ(logs.wellNames[i], "/" + wellNames[i]);
+    ASSERT_EQ(n, ptrdiff_t(100*(i+1)));
+    // log curve length units are `cm`
+    ASSERT_TRUE(logs.md.segment(logs.offsets(i), n).isApprox(
+                  LOG_MD_GR.col(0).head(n)/100));
+    ASSERT_TRUE(logs.val.segment(logs.offsets(i), n).isApprox(
+                  LOG_MD_GR.col(1).head(n)));
+  }
+
+  // all wells of the container
+  logs = wellContainer->getLogCurves(LOG_TYPE, LOG_NAME);
+  ASSERT_GE(logs.getNWells(), 4);
+}
+
 TEST_F(H5WellFixture, createDevCurveWithDifferentCreateFlags){
   H5Well_ptr well(
         wellContainer->createWell(
@@ -266,6 +389,73 @@ TEST_F(H5WellFixture, writeReadDevCurve){
   ASSERT_TRUE(tvd_norm < MD_X_Y_Z_TVD_DX_DY_AZ_INCL(Eigen::last, 4)*0.005); // less than 0,5 % of max TVD
 }
 
+TEST_F(H5WellFixture, trajectoryLookups){
+  H5Well_ptr well(
+        wellContainer->createWell(
+          WELL_NAME, wellParam, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(well != nullptr);
+
+  H5DevCurve_ptr devCurve(
+        well->createDevCurve(
+          DEV_NAME, devCurveParam, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(devCurve != nullptr);
+
+  ASSERT_TRUE(devCurve->writeMD(MD_X_Y_Z_TVD_DX_DY_AZ_INCL.col(0)));
+  ASSERT_TRUE(devCurve->writeAZIM(MD_X_Y_Z_TVD_DX_DY_AZ_INCL.col(7)));
+  ASSERT_TRUE(devCurve->writeINCL(MD_X_Y_Z_TVD_DX_DY_AZ_INCL.col(8)));
+  devCurve->updateTvdDxDy();
+
+  auto trajectory = devCurve->getTrajectory();
+  ASSERT_TRUE(trajectory != nullptr);
+  ASSERT_EQ(trajectory->getNSamp(), devCurve->getNSamp());
+  // cached
+  ASSERT_EQ(trajectory, devCurve->getTrajectory());
+
+  // at stations lookups must reproduce the stored curves
+  Eigen::VectorXd md = devCurve->getCurve(h5geo::DevDataType::MD);
+  Eigen::MatrixXd xyTvd = devCurve->mdToXYTvd(md);
+  Eigen::MatrixXd xyTvdExpected(md.size(), 4);
+  xyTvdExpected.col(0) = devCurve->getCurve(h5geo::DevDataType::X);
+  xyTvdExpected.col(1) = devCurve->getCurve(h5geo::DevDataType::Y);
+  xyTvdExpected.col(2) = devCurve->getCurve(h5geo::DevDataType::TVD);
+  xyTvdExpected.col(3) = devCurve->getCurve(h5geo::DevDataType::TVDSS);
+  ASSERT_TRUE(xyTvd.isApprox(xyTvdExpected));
+
+  // between stations and back
+  Eigen::VectorXd mdMid =
+      (md.head(md.size()-1) + md.tail(md.size()-1)) / 2;
+  Eigen::MatrixXd xyTvdMid = devCurve->mdToXYTvd(mdMid);
+  Eigen::VectorXd tvdMid = xyTvdMid.col(2);
+  ASSERT_TRUE(xyTvdMid.allFinite());
+  ASSERT_TRUE(devCurve->tvdToMd(tvdMid).isApprox(mdMid, 1e-6));
+
+  // outside of the trajectory
+  Eigen::VectorXd mdOut(1);
+  mdOut << md(Eigen::last) + 1;
+  ASSERT_TRUE(devCurve->mdToXYTvd(mdOut).hasNaN());
+
+  // units
+  Eigen::MatrixXd xyTvdCm = devCurve->mdToXYTvd(md*100, "cm");
+  ASSERT_TRUE(xyTvdCm.isApprox(xyTvd*100));
+
+  // writing curves and changing well head drop the cache
+  ASSERT_TRUE(devCurve->writeMD(md));
+  ASSERT_NE(trajectory, devCurve->getTrajectory());
+  trajectory = devCurve->getTrajectory();
+  Eigen::Vector2d headXY(0, 0);
+  ASSERT_TRUE(well->setHeadCoord(headXY));
+  ASSERT_NE(trajectory, devCurve->getTrajectory());
+  ASSERT_TRUE(devCurve->mdToXYTvd(md).col(0).isApprox(
+                devCurve->getCurve(h5geo::DevDataType::DX)));
+
+  // resampled stations lie on the minimum curvature arcs
+  auto resampled = devCurve->getTrajectory("", 1);
+  ASSERT_TRUE(resampled != nullptr);
+  ASSERT_GT(resampled->getNSamp(), trajectory->getNSamp());
+  ASSERT_TRUE(resampled->mdToXYTvd(md, false).isApprox(
+                devCurve->mdToXYTvd(md), 1e-6));
+}
+
 TEST_F(H5WellFixture, MdAzIncl2MdXYTvd){
   wellContainer->getH5File().createDataSet<double>(
         "MD_X_Y_Z_TVD_DX_DY_AZ_INCL", h5gt::DataSpace(
@@ -483,6 +673,49 @@ TEST_F(H5WellFixture, TvdssDxDy2MdXYTvd_XNorth){
   ASSERT_TRUE(std_dev/MD_max < 0.05); // less than 5 %
 }
 
+TEST_F(H5WellFixture, traj2ALLManyWells){
+  size_t nWell = 10;
+  std::vector<Eigen::MatrixXd> MdAzIncl(nWell), TvdDxDy(nWell);
+  Eigen::VectorXd x0(nWell), y0(nWell), kb(nWell);
+  for (size_t i = 0; i < nWell; i++){
+    MdAzIncl[i] = MD_X_Y_Z_TVD_DX_DY_AZ_INCL(Eigen::all, {0, 7, 8});
+    MdAzIncl[i].col(1).array() += 10*i;
+    TvdDxDy[i] = MD_X_Y_Z_TVD_DX_DY_AZ_INCL(Eigen::all, {4, 5, 6});
+    x0(i) = wellParam.headX + 100*i;
+    y0(i) = wellParam.headY - 100*i;
+    kb(i) = wellParam.kb + i;
+  }
+  // wrong input for a single well doesn't break others
+  MdAzIncl.push_back(Eigen::MatrixXd(3, 2));
+  x0.conservativeResize(nWell+1);
+  y0.conservativeResize(nWell+1);
+  kb.conservativeResize(nWell+1);
+
+  std::vector<Eigen::MatrixXd> ALL = h5geo::traj2ALL(
+        MdAzIncl, x0, y0, kb, "degree", "radian",
+        h5geo::TrajectoryFormat::MD_AZIM_INCL, false);
+  ASSERT_EQ(ALL.size(), nWell+1);
+  ASSERT_EQ(ALL.back().size(), 0);
+  for (size_t i = 0; i < nWell; i++)
+    ASSERT_TRUE(ALL[i].isApprox(h5geo::traj2ALL(
+                                  MdAzIncl[i], x0(i), y0(i), kb(i), "degree", "radian",
+                                  h5geo::TrajectoryFormat::MD_AZIM_INCL, false)));
+
+  ALL = h5geo::traj2ALL(
+        TvdDxDy, x0.head(nWell), y0.head(nWell), kb.head(nWell), "", "degree",
+        h5geo::TrajectoryFormat::TVD_DX_DY, true);
+  ASSERT_EQ(ALL.size(), nWell);
+  for (size_t i = 0; i < nWell; i++)
+    ASSERT_TRUE(ALL[i].isApprox(h5geo::traj2ALL(
+                                  TvdDxDy[i], x0(i), y0(i), kb(i), "", "degree",
+                                  h5geo::TrajectoryFormat::TVD_DX_DY, true)));
+
+  // sizes mismatch
+  ASSERT_TRUE(h5geo::traj2ALL(
+                TvdDxDy, x0, y0, kb, "", "degree",
+                h5geo::TrajectoryFormat::TVD_DX_DY, true).empty());
+}
+
 TEST_F(H5WellFixture, writeReadLogCurve){
   H5Well_ptr well(
         wellContainer->createWell(
@@ -507,6 +740,87 @@ TEST_F(H5WellFixture, writeReadLogCurve){
                 logCurve->getCurve(h5geo::LogDataType::VAL)));
 }
 
+TEST_F(H5WellFixture, writeLogCurvesInBatch){
+  {
+    H5BatchSession session(wellContainer.get());
+    ASSERT_TRUE(wellContainer->isBatchActive());
+
+    // nested session doesn't end the outer one
+    ASSERT_TRUE(wellContainer->beginBatch());
+    ASSERT_TRUE(wellContainer->endBatch());
+    ASSERT_TRUE(wellContainer->isBatchActive());
+
+    for (size_t i = 0; i < 10; i++){
+      std::string wellName = WELL_NAME + std::to_string(i);
+      H5Well_ptr well(
+            wellContainer->createWell(
+              wellName, wellParam, h5geo::CreationType::CREATE_OR_OVERWRITE));
+      ASSERT_TRUE(well != nullptr);
+
+      H5LogCurve_ptr logCurve(
+            well->createLogCurve(
+              LOG_TYPE, LOG_NAME,
+              logCurveParam, h5geo::CreationType::CREATE_OR_OVERWRITE));
+      ASSERT_TRUE(logCurve != nullptr);
+      ASSERT_TRUE(logCurve->writeCurve(h5geo::LogDataType::MD,
+                                       LOG_MD_GR.col(0)));
+      ASSERT_TRUE(logCurve->writeCurve(h5geo::LogDataType::VAL,
+                                       LOG_MD_GR.col(1)));
+    }
+    ASSERT_TRUE(session.commit());
+  }
+  ASSERT_FALSE(wellContainer->isBatchActive());
+  ASSERT_FALSE(wellContainer->endBatch());
+
+  H5Well_ptr well(wellContainer->openWell(WELL_NAME + std::to_string(9)));
+  ASSERT_TRUE(well != nullptr);
+  H5LogCurve_ptr logCurve(well->openLogCurve(LOG_TYPE, LOG_NAME));
+  ASSERT_TRUE(logCurve != nullptr);
+  ASSERT_TRUE(LOG_MD_GR.col(1).isApprox(
+                logCurve->getCurve(h5geo::LogDataType::VAL)));
+}
+
+TEST_F(H5WellFixture, batchIsDroppedWithClosedFile){
+  std::string fileName = "batch_closed.h5";
+  {
+    h5gt::File file(fileName, h5gt::File::OpenOrCreate | h5gt::File::Overwrite);
+    ASSERT_TRUE(h5geo::beginBatch(file));
+    ASSERT_TRUE(h5geo::isBatchActive(file));
+    // file is closed without `endBatch`
+  }
+
+  h5gt::File file(fileName, h5gt::File::ReadWrite);
+  ASSERT_FALSE(h5geo::isBatchActive(file));
+  ASSERT_FALSE(h5geo::endBatch(file));
+}
+
+TEST_F(H5WellFixture, writeFixedSizeLogCurve){
+  H5Well_ptr well(
+        wellContainer->createWell(
+          WELL_NAME, wellParam, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(well != nullptr);
+
+  H5LogCurveParam p = logCurveParam;
+  p.nSamp = LOG_MD_GR.rows();
+  H5LogCurve_ptr logCurve(
+        well->createLogCurve(
+          LOG_TYPE, LOG_NAME,
+          p, h5geo::CreationType::CREATE_OR_OVERWRITE));
+  ASSERT_TRUE(logCurve != nullptr);
+  ASSERT_EQ(logCurve->getNSamp(), p.nSamp);
+  ASSERT_EQ(logCurve->getParam().nSamp, p.nSamp);
+  ASSERT_TRUE(logCurve->writeCurve(h5geo::LogDataType::MD,
+                                   LOG_MD_GR.col(0)));
+  ASSERT_TRUE(logCurve->writeCurve(h5geo::LogDataType::VAL,
+                                   LOG_MD_GR.col(1)));
+  ASSERT_TRUE(LOG_MD_GR.col(1).isApprox(
+                logCurve->getCurve(h5geo::LogDataType::VAL)));
+
+  // fixed-size curve can't be resized
+  Eigen::VectorXd v = LOG_MD_GR.col(1).head(LOG_MD_GR.rows()/2);
+  ASSERT_FALSE(logCurve->writeCurve(h5geo::LogDataType::VAL, v));
+}
+
 TEST_F(H5WellFixture, getWellFromCurve){
   H5Well_ptr well(
         wellContainer->createWell(